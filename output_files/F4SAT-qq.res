@@ -0,0 +1,11 @@
+#Reduced Groebner basis data
+#---
+#field characteristic: 0
+#variable order:       x, y, z
+#monomial order:       graded reverse lexicographical
+#length of basis:      3 elements sorted by increasing leading monomials
+#---
+[37*y-14*z-13, 
+37*x-28*z-26, 
+70*z^2+130*z-233
+]:
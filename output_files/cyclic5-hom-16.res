@@ -0,0 +1,45 @@
+#Reduced Groebner basis data
+#---
+#field characteristic: 65521
+#variable order:       x1, x2, x3, x4, x5, x6
+#monomial order:       graded reverse lexicographical
+#length of basis:      38 elements sorted by increasing leading monomials
+#---
+[1*x1^1+1*x2^1+1*x3^1+1*x4^1+1*x5^1,
+1*x2^2+1*x2^1*x4^1+65520*x3^1*x4^1+2*x2^1*x5^1+1*x3^1*x5^1+1*x5^2,
+1*x2^1*x3^2+65520*x2^1*x3^1*x4^1+1*x3^2*x4^1+65520*x3^2*x5^1+1*x2^1*x4^1*x5^1+1*x3^1*x4^1*x5^1+1*x4^2*x5^1+65520*x2^1*x5^2+65519*x3^1*x5^2+1*x4^1*x5^2+65520*x5^3,
+1*x2^1*x3^1*x4^2+1*x2^1*x3^1*x4^1*x5^1+1*x3^2*x4^1*x5^1+65520*x2^1*x4^2*x5^1+1*x3^1*x4^2*x5^1+65520*x4^3*x5^1+65520*x2^1*x3^1*x5^2+65520*x2^1*x4^1*x5^2+65519*x4^2*x5^2+1*x2^1*x5^3+1*x3^1*x5^3+65520*x4^1*x5^3+1*x5^4,
+1*x3^3*x4^1+65520*x3^2*x4^2+65520*x3^3*x5^1+65520*x2^1*x3^1*x4^1*x5^1+3*x3^2*x4^1*x5^1+1*x2^1*x4^2*x5^1+1*x4^3*x5^1+65520*x2^1*x3^1*x5^2+65517*x3^2*x5^2+4*x2^1*x4^1*x5^2+2*x3^1*x4^1*x5^2+5*x4^2*x5^2+65518*x2^1*x5^3+65515*x3^1*x5^3+3*x4^1*x5^3+65518*x5^4,
+1*x2^1*x3^1*x4^1*x5^2+32761*x3^2*x4^1*x5^2+1*x3^1*x4^2*x5^2+32760*x2^1*x3^1*x5^3+65520*x2^1*x4^1*x5^3+32760*x3^1*x4^1*x5^3+32760*x4^2*x5^3+32761*x2^1*x5^4+32761*x3^1*x5^4+65520*x4^1*x5^4+32761*x5^5+32760*x6^5,
+1*x3^2*x4^2*x5^1+65520*x2^1*x4^3*x5^1+65518*x3^1*x4^3*x5^1+65520*x4^4*x5^1+1*x3^3*x5^2+32760*x3^2*x4^1*x5^2+65519*x2^1*x4^2*x5^2+65520*x3^1*x4^2*x5^2+65516*x4^3*x5^2+32764*x2^1*x3^1*x5^3+5*x3^2*x5^3+65518*x2^1*x4^1*x5^3+32763*x3^1*x4^1*x5^3+32754*x4^2*x5^3+32763*x2^1*x5^4+32767*x3^1*x5^4+65520*x4^1*x5^4+32763*x5^5+32760*x6^5,
+1*x3^2*x4^3+65520*x2^1*x4^3*x5^1+65520*x4^4*x5^1+65520*x2^1*x4^2*x5^2+65518*x4^3*x5^2+2*x2^1*x3^1*x5^3+1*x3^2*x5^3+3*x3^1*x4^1*x5^3+65519*x4^2*x5^3+1*x3^1*x5^4+1*x4^1*x5^4+65520*x6^5,
+1*x3^3*x5^3+32760*x3^2*x4^1*x5^3+65519*x2^1*x4^2*x5^3+65519*x3^1*x4^2*x5^3+65520*x4^3*x5^3+32761*x2^1*x3^1*x5^4+3*x3^2*x5^4+65520*x2^1*x4^1*x5^4+32759*x3^1*x4^1*x5^4+32758*x4^2*x5^4+32762*x2^1*x5^5+32764*x3^1*x5^5+65520*x4^1*x5^5+32762*x5^6+1*x2^1*x6^5+65520*x3^1*x6^5+32761*x5^1*x6^5,
+1*x3^1*x4^3*x5^2+32760*x2^1*x4^2*x5^3+32760*x3^1*x4^2*x5^3+32761*x4^3*x5^3+32760*x2^1*x3^1*x5^4+32760*x3^2*x5^4+1*x2^1*x4^1*x5^4+32760*x3^1*x4^1*x5^4+1*x4^2*x5^4+32760*x2^1*x5^5+65520*x3^1*x5^5+32761*x4^1*x5^5+32760*x5^6+32761*x2^1*x6^5+32760*x4^1*x6^5+32761*x5^1*x6^5,
+1*x2^1*x4^3*x5^2+1*x4^4*x5^2+32760*x3^2*x4^1*x5^3+32763*x2^1*x4^2*x5^3+32762*x3^1*x4^2*x5^3+32763*x4^3*x5^3+32761*x3^2*x5^4+65518*x2^1*x4^1*x5^4+65519*x3^1*x4^1*x5^4+32760*x4^2*x5^4+1*x2^1*x5^5+32762*x3^1*x5^5+32758*x4^1*x5^5+1*x5^6+32759*x2^1*x6^5+65520*x3^1*x6^5+32762*x4^1*x6^5+65518*x5^1*x6^5,
+1*x3^4*x5^2+65520*x4^4*x5^2+2*x3^2*x4^1*x5^3+32763*x2^1*x4^2*x5^3+32763*x3^1*x4^2*x5^3+32757*x4^3*x5^3+32767*x2^1*x3^1*x5^4+32759*x3^2*x5^4+32772*x3^1*x4^1*x5^4+65519*x4^2*x5^4+32757*x2^1*x5^5+65517*x3^1*x5^5+32764*x4^1*x5^5+32757*x5^6+32755*x2^1*x6^5+6*x3^1*x6^5+32757*x4^1*x6^5+32753*x5^1*x6^5,
+1*x3^1*x4^4*x5^1+65520*x4^4*x5^2+32762*x3^2*x4^1*x5^3+32749*x2^1*x4^2*x5^3+32755*x3^1*x4^2*x5^3+32753*x4^3*x5^3+32759*x3^2*x5^4+8*x2^1*x4^1*x5^4+4*x3^1*x4^1*x5^4+32760*x4^2*x5^4+65518*x2^1*x5^5+32756*x3^1*x5^5+32767*x4^1*x5^5+65518*x5^6+32767*x2^1*x6^5+5*x3^1*x6^5+32753*x4^1*x6^5+13*x5^1*x6^5,
+1*x2^1*x4^4*x5^1+1*x4^5*x5^1+6*x4^4*x5^2+32756*x3^2*x4^1*x5^3+34*x2^1*x4^2*x5^3+16*x3^1*x4^2*x5^3+23*x4^3*x5^3+32761*x2^1*x3^1*x5^4+5*x3^2*x5^4+65494*x2^1*x4^1*x5^4+32746*x3^1*x4^1*x5^4+32760*x4^2*x5^4+32770*x2^1*x5^5+32775*x3^1*x5^5+65499*x4^1*x5^5+32770*x5^6+65503*x2^1*x6^5+65506*x3^1*x6^5+22*x4^1*x6^5+32720*x5^1*x6^5,
+1*x2^1*x3^1*x5^5+32761*x3^2*x5^5+65520*x2^1*x4^1*x5^5+32760*x4^2*x5^5+32761*x3^1*x5^6+32760*x4^1*x5^6+65520*x2^1*x3^1*x6^5+32760*x3^2*x6^5+1*x2^1*x4^1*x6^5+32761*x4^2*x6^5+32760*x3^1*x5^1*x6^5+32761*x4^1*x5^1*x6^5,
+1*x4^3*x5^4+19656*x3^2*x5^5+39313*x2^1*x4^1*x5^5+65520*x3^1*x4^1*x5^5+6554*x4^2*x5^5+39312*x2^1*x5^6+58968*x3^1*x5^6+58969*x4^1*x5^6+39312*x5^7+65519*x2^1*x3^1*x6^5+45863*x3^2*x6^5+26210*x2^1*x4^1*x6^5+58970*x4^2*x6^5+26209*x2^1*x5^1*x6^5+6550*x3^1*x5^1*x6^5+6552*x4^1*x5^1*x6^5+26211*x5^2*x6^5,
+1*x3^1*x4^2*x5^4+58969*x3^2*x5^5+13103*x2^1*x4^1*x5^5+26207*x3^1*x4^1*x5^5+6552*x4^2*x5^5+52417*x2^1*x5^6+45865*x3^1*x5^6+6551*x4^1*x5^6+52417*x5^7+6552*x3^2*x6^5+52417*x2^1*x4^1*x6^5+39313*x3^1*x4^1*x6^5+58969*x4^2*x6^5+13105*x2^1*x5^1*x6^5+19656*x3^1*x5^1*x6^5+58970*x4^1*x5^1*x6^5+13104*x5^2*x6^5,
+1*x2^1*x4^2*x5^4+58969*x3^2*x5^5+52417*x2^1*x4^1*x5^5+1*x3^1*x4^1*x5^5+19656*x4^2*x5^5+52417*x2^1*x5^6+45865*x3^1*x5^6+45865*x4^1*x5^6+52417*x5^7+1*x2^1*x3^1*x6^5+6553*x3^2*x6^5+13103*x2^1*x4^1*x6^5+45864*x4^2*x6^5+13103*x2^1*x5^1*x6^5+19657*x3^1*x5^1*x6^5+19656*x4^1*x5^1*x6^5+13102*x5^2*x6^5,
+1*x4^4*x5^3+65520*x3^2*x4^1*x5^4+39314*x3^2*x5^5+65516*x2^1*x4^1*x5^5+52416*x3^1*x4^1*x5^5+52410*x4^2*x5^5+13107*x2^1*x5^6+52421*x3^1*x5^6+39309*x4^1*x5^6+13107*x5^7+3*x2^1*x3^1*x6^5+26211*x3^2*x6^5+13103*x3^1*x4^1*x6^5+13103*x4^2*x6^5+52416*x2^1*x5^1*x6^5+13108*x3^1*x5^1*x6^5+26212*x4^1*x5^1*x6^5+52412*x5^2*x6^5,
+1*x4^5*x5^2+2*x3^2*x4^1*x5^4+45862*x3^2*x5^5+52426*x2^1*x4^1*x5^5+26209*x3^1*x4^1*x5^5+45878*x4^2*x5^5+26203*x2^1*x5^6+6544*x3^1*x5^6+32767*x4^1*x5^6+26203*x5^7+65512*x2^1*x3^1*x6^5+19648*x3^2*x6^5+13106*x2^1*x4^1*x6^5+39314*x3^1*x4^1*x6^5+19663*x4^2*x6^5+39316*x2^1*x5^1*x6^5+58957*x3^1*x5^1*x6^5+32754*x4^1*x5^1*x6^5+39324*x5^2*x6^5,
+1*x3^3*x6^5+1*x2^1*x3^1*x4^1*x6^5+65519*x2^1*x4^2*x6^5+65520*x3^1*x4^2*x6^5+65520*x4^3*x6^5+3*x3^2*x5^1*x6^5+65519*x2^1*x4^1*x5^1*x6^5+65519*x3^1*x4^1*x5^1*x6^5+65518*x4^2*x5^1*x6^5+3*x2^1*x5^2*x6^5+3*x3^1*x5^2*x6^5+65519*x4^1*x5^2*x6^5+2*x5^3*x6^5,
+1*x4^2*x5^6+28*x2^1*x3^1*x4^1*x6^5+14*x3^2*x4^1*x6^5+65500*x2^1*x4^2*x6^5+65509*x3^1*x4^2*x6^5+65509*x4^3*x6^5+65510*x2^1*x3^1*x5^1*x6^5+3*x3^2*x5^1*x6^5+9*x2^1*x4^1*x5^1*x6^5+17*x3^1*x4^1*x5^1*x6^5+65491*x4^2*x5^1*x6^5+65516*x2^1*x5^2*x6^5+29*x3^1*x5^2*x6^5+65493*x4^1*x5^2*x6^5+18*x5^3*x6^5,
+1*x3^1*x4^1*x5^6+42*x2^1*x3^1*x4^1*x6^5+21*x3^2*x4^1*x6^5+65501*x2^1*x4^2*x6^5+65498*x3^1*x4^2*x6^5+65506*x4^3*x6^5+65510*x2^1*x3^1*x5^1*x6^5+10*x3^2*x5^1*x6^5+13*x2^1*x4^1*x5^1*x6^5+38*x3^1*x4^1*x5^1*x6^5+65475*x4^2*x5^1*x6^5+65497*x2^1*x5^2*x6^5+46*x3^1*x5^2*x6^5+65479*x4^1*x5^2*x6^5+10*x5^3*x6^5,
+1*x2^1*x4^1*x5^6+1*x4^1*x5^7+65453*x2^1*x3^1*x4^1*x6^5+65487*x3^2*x4^1*x6^5+32*x2^1*x4^2*x6^5+37*x3^1*x4^2*x6^5+24*x4^3*x6^5+18*x2^1*x3^1*x5^1*x6^5+65505*x3^2*x5^1*x6^5+65499*x2^1*x4^1*x5^1*x6^5+65458*x3^1*x4^1*x5^1*x6^5+74*x4^2*x5^1*x6^5+39*x2^1*x5^2*x6^5+65447*x3^1*x5^2*x6^5+67*x4^1*x5^2*x6^5+65505*x5^3*x6^5,
+1*x3^2*x5^6+2*x2^1*x5^7+3*x3^1*x5^7+1*x4^1*x5^7+2*x5^8+65421*x2^1*x3^1*x4^1*x6^5+65471*x3^2*x4^1*x6^5+13*x2^1*x4^2*x6^5+70*x3^1*x4^2*x6^5+26*x4^3*x6^5+11*x2^1*x3^1*x5^1*x6^5+65481*x3^2*x5^1*x6^5+65490*x2^1*x4^1*x5^1*x6^5+65388*x3^1*x4^1*x5^1*x6^5+115*x4^2*x5^1*x6^5+105*x2^1*x5^2*x6^5+65403*x3^1*x5^2*x6^5+99*x4^1*x5^2*x6^5+24*x5^3*x6^5,
+1*x3^2*x4^1*x5^5+65505*x2^1*x3^1*x4^1*x6^5+65512*x3^2*x4^1*x6^5+8*x2^1*x4^2*x6^5+9*x3^1*x4^2*x6^5+6*x4^3*x6^5+4*x2^1*x3^1*x5^1*x6^5+65517*x3^2*x5^1*x6^5+65516*x2^1*x4^1*x5^1*x6^5+65506*x3^1*x4^1*x5^1*x6^5+18*x4^2*x5^1*x6^5+9*x2^1*x5^2*x6^5+65503*x3^1*x5^2*x6^5+16*x4^1*x5^2*x6^5+65517*x5^3*x6^5,
+1*x4^4*x6^5+14*x2^1*x3^1*x4^1*x5^1*x6^5+6*x3^2*x4^1*x5^1*x6^5+65494*x2^1*x4^2*x5^1*x6^5+2*x3^1*x4^2*x5^1*x6^5+65506*x4^3*x5^1*x6^5+65520*x2^1*x3^1*x5^2*x6^5+7*x3^2*x5^2*x6^5+65511*x2^1*x4^1*x5^2*x6^5+65512*x3^1*x4^1*x5^2*x6^5+65488*x4^2*x5^2*x6^5+24*x2^1*x5^3*x6^5+33*x3^1*x5^3*x6^5+65507*x4^1*x5^3*x6^5+22*x5^4*x6^5,
+1*x3^1*x4^3*x6^5+65519*x2^1*x3^1*x4^1*x5^1*x6^5+65520*x3^2*x4^1*x5^1*x6^5+5*x2^1*x4^2*x5^1*x6^5+4*x4^3*x5^1*x6^5+65520*x2^1*x3^1*x5^2*x6^5+65519*x3^2*x5^2*x6^5+2*x2^1*x4^1*x5^2*x6^5+7*x4^2*x5^2*x6^5+65517*x2^1*x5^3*x6^5+65514*x3^1*x5^3*x6^5+2*x4^1*x5^3*x6^5+65517*x5^4*x6^5,
+1*x2^1*x4^3*x6^5+65516*x2^1*x3^1*x4^1*x5^1*x6^5+65519*x3^2*x4^1*x5^1*x6^5+10*x2^1*x4^2*x5^1*x6^5+1*x3^1*x4^2*x5^1*x6^5+6*x4^3*x5^1*x6^5+65518*x3^2*x5^2*x6^5+2*x2^1*x4^1*x5^2*x6^5+2*x3^1*x4^1*x5^2*x6^5+13*x4^2*x5^2*x6^5+65513*x2^1*x5^3*x6^5+65508*x3^1*x5^3*x6^5+4*x4^1*x5^3*x6^5+65513*x5^4*x6^5,
+1*x3^2*x4^2*x6^5+1*x2^1*x3^1*x4^1*x5^1*x6^5+65519*x2^1*x4^2*x5^1*x6^5+2*x3^1*x4^2*x5^1*x6^5+65520*x4^3*x5^1*x6^5+65519*x2^1*x4^1*x5^2*x6^5+65519*x3^1*x4^1*x5^2*x6^5+65519*x4^2*x5^2*x6^5+3*x2^1*x5^3*x6^5+2*x3^1*x5^3*x6^5+65519*x4^1*x5^3*x6^5+2*x5^4*x6^5,
+1*x2^1*x5^5*x6^5+65520*x3^1*x5^5*x6^5+65520*x2^1*x6^10+1*x3^1*x6^10,
+1*x3^1*x4^2*x5^3*x6^5+21841*x4^3*x5^3*x6^5+21839*x2^1*x3^1*x5^4*x6^5+21839*x3^2*x5^4*x6^5+43681*x2^1*x4^1*x5^4*x6^5+43679*x3^1*x4^1*x5^4*x6^5+2*x4^2*x5^4*x6^5+34943*x3^1*x5^5*x6^5+13104*x4^1*x5^5*x6^5+17472*x5^6*x6^5+1*x2^1*x6^10+30576*x3^1*x6^10+52417*x4^1*x6^10+26210*x5^1*x6^10,
+1*x2^1*x4^2*x5^3*x6^5+43681*x4^3*x5^3*x6^5+43681*x2^1*x3^1*x5^4*x6^5+43681*x3^2*x5^4*x6^5+21840*x2^1*x4^1*x5^4*x6^5+21841*x3^1*x4^1*x5^4*x6^5+43680*x3^1*x5^5*x6^5+21840*x5^6*x6^5+65520*x2^1*x6^10+21841*x3^1*x6^10+65520*x5^1*x6^10,
+1*x3^1*x4^1*x5^5*x6^5+32761*x4^2*x5^5*x6^5+4*x3^1*x5^6*x6^5+32761*x4^1*x5^6*x6^5+32762*x5^7*x6^5+65520*x3^1*x4^1*x6^10+32760*x4^2*x6^10+65517*x3^1*x5^1*x6^10+32760*x4^1*x5^1*x6^10+32759*x5^2*x6^10,
+1*x3^2*x5^5*x6^5+3*x3^1*x5^6*x6^5+1*x5^7*x6^5+65520*x3^2*x6^10+65518*x3^1*x5^1*x6^10+65520*x5^2*x6^10,
+1*x5^8*x6^5+42*x2^1*x3^1*x4^1*x6^10+21*x3^2*x4^1*x6^10+65356*x2^1*x4^2*x6^10+42*x3^1*x4^2*x6^10+65466*x4^3*x6^10+65445*x2^1*x3^1*x5^1*x6^10+65466*x3^2*x5^1*x6^10+13*x2^1*x4^1*x5^1*x6^10+65390*x3^1*x4^1*x5^1*x6^10+65500*x4^2*x5^1*x6^10+186*x2^1*x5^2*x6^10+21*x3^1*x5^2*x6^10+65479*x4^1*x5^2*x6^10+219*x5^3*x6^10,
+1*x4^1*x5^7*x6^5+65411*x2^1*x3^1*x4^1*x6^10+65466*x3^2*x4^1*x6^10+52*x2^1*x4^2*x6^10+60*x3^1*x4^2*x6^10+39*x4^3*x6^10+29*x2^1*x3^1*x5^1*x6^10+65495*x3^2*x5^1*x6^10+65487*x2^1*x4^1*x5^1*x6^10+65419*x3^1*x4^1*x5^1*x6^10+120*x4^2*x5^1*x6^10+63*x2^1*x5^2*x6^10+65401*x3^1*x5^2*x6^10+109*x4^1*x5^2*x6^10+65495*x5^3*x6^10,
+1*x3^1*x5^7*x6^5+65505*x2^1*x3^1*x4^1*x6^10+65513*x3^2*x4^1*x6^10+63*x2^1*x4^2*x6^10+65505*x3^1*x4^2*x6^10+21*x4^3*x6^10+29*x2^1*x3^1*x5^1*x6^10+21*x3^2*x5^1*x6^10+65516*x2^1*x4^1*x5^1*x6^10+50*x3^1*x4^1*x5^1*x6^10+8*x4^2*x5^1*x6^10+65450*x2^1*x5^2*x6^10+65512*x3^1*x5^2*x6^10+16*x4^1*x5^2*x6^10+65437*x5^3*x6^10]:
@@ -0,0 +1,45 @@
+#Reduced Groebner basis data
+#---
+#field characteristic: 1073741827
+#variable order:       x1, x2, x3, x4, x5, x6
+#monomial order:       graded reverse lexicographical
+#length of basis:      38 elements sorted by increasing leading monomials
+#---
+[1*x1^1+1*x2^1+1*x3^1+1*x4^1+1*x5^1,
+1*x2^2+1*x2^1*x4^1+1073741826*x3^1*x4^1+2*x2^1*x5^1+1*x3^1*x5^1+1*x5^2,
+1*x2^1*x3^2+1073741826*x2^1*x3^1*x4^1+1*x3^2*x4^1+1073741826*x3^2*x5^1+1*x2^1*x4^1*x5^1+1*x3^1*x4^1*x5^1+1*x4^2*x5^1+1073741826*x2^1*x5^2+1073741825*x3^1*x5^2+1*x4^1*x5^2+1073741826*x5^3,
+1*x2^1*x3^1*x4^2+1*x2^1*x3^1*x4^1*x5^1+1*x3^2*x4^1*x5^1+1073741826*x2^1*x4^2*x5^1+1*x3^1*x4^2*x5^1+1073741826*x4^3*x5^1+1073741826*x2^1*x3^1*x5^2+1073741826*x2^1*x4^1*x5^2+1073741825*x4^2*x5^2+1*x2^1*x5^3+1*x3^1*x5^3+1073741826*x4^1*x5^3+1*x5^4,
+1*x3^3*x4^1+1073741826*x3^2*x4^2+1073741826*x3^3*x5^1+1073741826*x2^1*x3^1*x4^1*x5^1+3*x3^2*x4^1*x5^1+1*x2^1*x4^2*x5^1+1*x4^3*x5^1+1073741826*x2^1*x3^1*x5^2+1073741823*x3^2*x5^2+4*x2^1*x4^1*x5^2+2*x3^1*x4^1*x5^2+5*x4^2*x5^2+1073741824*x2^1*x5^3+1073741821*x3^1*x5^3+3*x4^1*x5^3+1073741824*x5^4,
+1*x2^1*x3^1*x4^1*x5^2+536870914*x3^2*x4^1*x5^2+1*x3^1*x4^2*x5^2+536870913*x2^1*x3^1*x5^3+1073741826*x2^1*x4^1*x5^3+536870913*x3^1*x4^1*x5^3+536870913*x4^2*x5^3+536870914*x2^1*x5^4+536870914*x3^1*x5^4+1073741826*x4^1*x5^4+536870914*x5^5+536870913*x6^5,
+1*x3^2*x4^2*x5^1+1073741826*x2^1*x4^3*x5^1+1073741824*x3^1*x4^3*x5^1+1073741826*x4^4*x5^1+1*x3^3*x5^2+536870913*x3^2*x4^1*x5^2+1073741825*x2^1*x4^2*x5^2+1073741826*x3^1*x4^2*x5^2+1073741822*x4^3*x5^2+536870917*x2^1*x3^1*x5^3+5*x3^2*x5^3+1073741824*x2^1*x4^1*x5^3+536870916*x3^1*x4^1*x5^3+536870907*x4^2*x5^3+536870916*x2^1*x5^4+536870920*x3^1*x5^4+1073741826*x4^1*x5^4+536870916*x5^5+536870913*x6^5,
+1*x3^2*x4^3+1073741826*x2^1*x4^3*x5^1+1073741826*x4^4*x5^1+1073741826*x2^1*x4^2*x5^2+1073741824*x4^3*x5^2+2*x2^1*x3^1*x5^3+1*x3^2*x5^3+3*x3^1*x4^1*x5^3+1073741825*x4^2*x5^3+1*x3^1*x5^4+1*x4^1*x5^4+1073741826*x6^5,
+1*x3^3*x5^3+536870913*x3^2*x4^1*x5^3+1073741825*x2^1*x4^2*x5^3+1073741825*x3^1*x4^2*x5^3+1073741826*x4^3*x5^3+536870914*x2^1*x3^1*x5^4+3*x3^2*x5^4+1073741826*x2^1*x4^1*x5^4+536870912*x3^1*x4^1*x5^4+536870911*x4^2*x5^4+536870915*x2^1*x5^5+536870917*x3^1*x5^5+1073741826*x4^1*x5^5+536870915*x5^6+1*x2^1*x6^5+1073741826*x3^1*x6^5+536870914*x5^1*x6^5,
+1*x3^1*x4^3*x5^2+536870913*x2^1*x4^2*x5^3+536870913*x3^1*x4^2*x5^3+536870914*x4^3*x5^3+536870913*x2^1*x3^1*x5^4+536870913*x3^2*x5^4+1*x2^1*x4^1*x5^4+536870913*x3^1*x4^1*x5^4+1*x4^2*x5^4+536870913*x2^1*x5^5+1073741826*x3^1*x5^5+536870914*x4^1*x5^5+536870913*x5^6+536870914*x2^1*x6^5+536870913*x4^1*x6^5+536870914*x5^1*x6^5,
+1*x2^1*x4^3*x5^2+1*x4^4*x5^2+536870913*x3^2*x4^1*x5^3+536870916*x2^1*x4^2*x5^3+536870915*x3^1*x4^2*x5^3+536870916*x4^3*x5^3+536870914*x3^2*x5^4+1073741824*x2^1*x4^1*x5^4+1073741825*x3^1*x4^1*x5^4+536870913*x4^2*x5^4+1*x2^1*x5^5+536870915*x3^1*x5^5+536870911*x4^1*x5^5+1*x5^6+536870912*x2^1*x6^5+1073741826*x3^1*x6^5+536870915*x4^1*x6^5+1073741824*x5^1*x6^5,
+1*x3^4*x5^2+1073741826*x4^4*x5^2+2*x3^2*x4^1*x5^3+536870916*x2^1*x4^2*x5^3+536870916*x3^1*x4^2*x5^3+536870910*x4^3*x5^3+536870920*x2^1*x3^1*x5^4+536870912*x3^2*x5^4+536870925*x3^1*x4^1*x5^4+1073741825*x4^2*x5^4+536870910*x2^1*x5^5+1073741823*x3^1*x5^5+536870917*x4^1*x5^5+536870910*x5^6+536870908*x2^1*x6^5+6*x3^1*x6^5+536870910*x4^1*x6^5+536870906*x5^1*x6^5,
+1*x3^1*x4^4*x5^1+1073741826*x4^4*x5^2+536870915*x3^2*x4^1*x5^3+536870902*x2^1*x4^2*x5^3+536870908*x3^1*x4^2*x5^3+536870906*x4^3*x5^3+536870912*x3^2*x5^4+8*x2^1*x4^1*x5^4+4*x3^1*x4^1*x5^4+536870913*x4^2*x5^4+1073741824*x2^1*x5^5+536870909*x3^1*x5^5+536870920*x4^1*x5^5+1073741824*x5^6+536870920*x2^1*x6^5+5*x3^1*x6^5+536870906*x4^1*x6^5+13*x5^1*x6^5,
+1*x2^1*x4^4*x5^1+1*x4^5*x5^1+6*x4^4*x5^2+536870909*x3^2*x4^1*x5^3+34*x2^1*x4^2*x5^3+16*x3^1*x4^2*x5^3+23*x4^3*x5^3+536870914*x2^1*x3^1*x5^4+5*x3^2*x5^4+1073741800*x2^1*x4^1*x5^4+536870899*x3^1*x4^1*x5^4+536870913*x4^2*x5^4+536870923*x2^1*x5^5+536870928*x3^1*x5^5+1073741805*x4^1*x5^5+536870923*x5^6+1073741809*x2^1*x6^5+1073741812*x3^1*x6^5+22*x4^1*x6^5+536870873*x5^1*x6^5,
+1*x2^1*x3^1*x5^5+536870914*x3^2*x5^5+1073741826*x2^1*x4^1*x5^5+536870913*x4^2*x5^5+536870914*x3^1*x5^6+536870913*x4^1*x5^6+1073741826*x2^1*x3^1*x6^5+536870913*x3^2*x6^5+1*x2^1*x4^1*x6^5+536870914*x4^2*x6^5+536870913*x3^1*x5^1*x6^5+536870914*x4^1*x5^1*x6^5,
+1*x4^3*x5^4+966367644*x3^2*x5^5+858993462*x2^1*x4^1*x5^5+1073741826*x3^1*x4^1*x5^5+322122550*x4^2*x5^5+858993461*x2^1*x5^6+751619278*x3^1*x5^6+751619279*x4^1*x5^6+858993461*x5^7+1073741825*x2^1*x3^1*x6^5+107374181*x3^2*x6^5+214748367*x2^1*x4^1*x6^5+751619280*x4^2*x6^5+214748366*x2^1*x5^1*x6^5+322122546*x3^1*x5^1*x6^5+322122548*x4^1*x5^1*x6^5+214748368*x5^2*x6^5,
+1*x3^1*x4^2*x5^4+751619279*x3^2*x5^5+644245095*x2^1*x4^1*x5^5+214748364*x3^1*x4^1*x5^5+322122548*x4^2*x5^5+429496731*x2^1*x5^6+107374183*x3^1*x5^6+322122547*x4^1*x5^6+429496731*x5^7+322122548*x3^2*x6^5+429496731*x2^1*x4^1*x6^5+858993462*x3^1*x4^1*x6^5+751619279*x4^2*x6^5+644245097*x2^1*x5^1*x6^5+966367644*x3^1*x5^1*x6^5+751619280*x4^1*x5^1*x6^5+644245096*x5^2*x6^5,
+1*x2^1*x4^2*x5^4+751619279*x3^2*x5^5+429496731*x2^1*x4^1*x5^5+1*x3^1*x4^1*x5^5+966367644*x4^2*x5^5+429496731*x2^1*x5^6+107374183*x3^1*x5^6+107374183*x4^1*x5^6+429496731*x5^7+1*x2^1*x3^1*x6^5+322122549*x3^2*x6^5+644245095*x2^1*x4^1*x6^5+107374182*x4^2*x6^5+644245095*x2^1*x5^1*x6^5+966367645*x3^1*x5^1*x6^5+966367644*x4^1*x5^1*x6^5+644245094*x5^2*x6^5,
+1*x4^4*x5^3+1073741826*x3^2*x4^1*x5^4+858993463*x3^2*x5^5+1073741822*x2^1*x4^1*x5^5+429496730*x3^1*x4^1*x5^5+429496724*x4^2*x5^5+644245099*x2^1*x5^6+429496735*x3^1*x5^6+858993458*x4^1*x5^6+644245099*x5^7+3*x2^1*x3^1*x6^5+214748368*x3^2*x6^5+644245095*x3^1*x4^1*x6^5+644245095*x4^2*x6^5+429496730*x2^1*x5^1*x6^5+644245100*x3^1*x5^1*x6^5+214748369*x4^1*x5^1*x6^5+429496726*x5^2*x6^5,
+1*x4^5*x5^2+2*x3^2*x4^1*x5^4+107374180*x3^2*x5^5+429496740*x2^1*x4^1*x5^5+214748366*x3^1*x4^1*x5^5+107374196*x4^2*x5^5+214748360*x2^1*x5^6+322122540*x3^1*x5^6+536870920*x4^1*x5^6+214748360*x5^7+1073741818*x2^1*x3^1*x6^5+966367636*x3^2*x6^5+644245098*x2^1*x4^1*x6^5+858993463*x3^1*x4^1*x6^5+966367651*x4^2*x6^5+858993465*x2^1*x5^1*x6^5+751619267*x3^1*x5^1*x6^5+536870907*x4^1*x5^1*x6^5+858993473*x5^2*x6^5,
+1*x3^3*x6^5+1*x2^1*x3^1*x4^1*x6^5+1073741825*x2^1*x4^2*x6^5+1073741826*x3^1*x4^2*x6^5+1073741826*x4^3*x6^5+3*x3^2*x5^1*x6^5+1073741825*x2^1*x4^1*x5^1*x6^5+1073741825*x3^1*x4^1*x5^1*x6^5+1073741824*x4^2*x5^1*x6^5+3*x2^1*x5^2*x6^5+3*x3^1*x5^2*x6^5+1073741825*x4^1*x5^2*x6^5+2*x5^3*x6^5,
+1*x4^2*x5^6+28*x2^1*x3^1*x4^1*x6^5+14*x3^2*x4^1*x6^5+1073741806*x2^1*x4^2*x6^5+1073741815*x3^1*x4^2*x6^5+1073741815*x4^3*x6^5+1073741816*x2^1*x3^1*x5^1*x6^5+3*x3^2*x5^1*x6^5+9*x2^1*x4^1*x5^1*x6^5+17*x3^1*x4^1*x5^1*x6^5+1073741797*x4^2*x5^1*x6^5+1073741822*x2^1*x5^2*x6^5+29*x3^1*x5^2*x6^5+1073741799*x4^1*x5^2*x6^5+18*x5^3*x6^5,
+1*x3^1*x4^1*x5^6+42*x2^1*x3^1*x4^1*x6^5+21*x3^2*x4^1*x6^5+1073741807*x2^1*x4^2*x6^5+1073741804*x3^1*x4^2*x6^5+1073741812*x4^3*x6^5+1073741816*x2^1*x3^1*x5^1*x6^5+10*x3^2*x5^1*x6^5+13*x2^1*x4^1*x5^1*x6^5+38*x3^1*x4^1*x5^1*x6^5+1073741781*x4^2*x5^1*x6^5+1073741803*x2^1*x5^2*x6^5+46*x3^1*x5^2*x6^5+1073741785*x4^1*x5^2*x6^5+10*x5^3*x6^5,
+1*x2^1*x4^1*x5^6+1*x4^1*x5^7+1073741759*x2^1*x3^1*x4^1*x6^5+1073741793*x3^2*x4^1*x6^5+32*x2^1*x4^2*x6^5+37*x3^1*x4^2*x6^5+24*x4^3*x6^5+18*x2^1*x3^1*x5^1*x6^5+1073741811*x3^2*x5^1*x6^5+1073741805*x2^1*x4^1*x5^1*x6^5+1073741764*x3^1*x4^1*x5^1*x6^5+74*x4^2*x5^1*x6^5+39*x2^1*x5^2*x6^5+1073741753*x3^1*x5^2*x6^5+67*x4^1*x5^2*x6^5+1073741811*x5^3*x6^5,
+1*x3^2*x5^6+2*x2^1*x5^7+3*x3^1*x5^7+1*x4^1*x5^7+2*x5^8+1073741727*x2^1*x3^1*x4^1*x6^5+1073741777*x3^2*x4^1*x6^5+13*x2^1*x4^2*x6^5+70*x3^1*x4^2*x6^5+26*x4^3*x6^5+11*x2^1*x3^1*x5^1*x6^5+1073741787*x3^2*x5^1*x6^5+1073741796*x2^1*x4^1*x5^1*x6^5+1073741694*x3^1*x4^1*x5^1*x6^5+115*x4^2*x5^1*x6^5+105*x2^1*x5^2*x6^5+1073741709*x3^1*x5^2*x6^5+99*x4^1*x5^2*x6^5+24*x5^3*x6^5,
+1*x3^2*x4^1*x5^5+1073741811*x2^1*x3^1*x4^1*x6^5+1073741818*x3^2*x4^1*x6^5+8*x2^1*x4^2*x6^5+9*x3^1*x4^2*x6^5+6*x4^3*x6^5+4*x2^1*x3^1*x5^1*x6^5+1073741823*x3^2*x5^1*x6^5+1073741822*x2^1*x4^1*x5^1*x6^5+1073741812*x3^1*x4^1*x5^1*x6^5+18*x4^2*x5^1*x6^5+9*x2^1*x5^2*x6^5+1073741809*x3^1*x5^2*x6^5+16*x4^1*x5^2*x6^5+1073741823*x5^3*x6^5,
+1*x4^4*x6^5+14*x2^1*x3^1*x4^1*x5^1*x6^5+6*x3^2*x4^1*x5^1*x6^5+1073741800*x2^1*x4^2*x5^1*x6^5+2*x3^1*x4^2*x5^1*x6^5+1073741812*x4^3*x5^1*x6^5+1073741826*x2^1*x3^1*x5^2*x6^5+7*x3^2*x5^2*x6^5+1073741817*x2^1*x4^1*x5^2*x6^5+1073741818*x3^1*x4^1*x5^2*x6^5+1073741794*x4^2*x5^2*x6^5+24*x2^1*x5^3*x6^5+33*x3^1*x5^3*x6^5+1073741813*x4^1*x5^3*x6^5+22*x5^4*x6^5,
+1*x3^1*x4^3*x6^5+1073741825*x2^1*x3^1*x4^1*x5^1*x6^5+1073741826*x3^2*x4^1*x5^1*x6^5+5*x2^1*x4^2*x5^1*x6^5+4*x4^3*x5^1*x6^5+1073741826*x2^1*x3^1*x5^2*x6^5+1073741825*x3^2*x5^2*x6^5+2*x2^1*x4^1*x5^2*x6^5+7*x4^2*x5^2*x6^5+1073741823*x2^1*x5^3*x6^5+1073741820*x3^1*x5^3*x6^5+2*x4^1*x5^3*x6^5+1073741823*x5^4*x6^5,
+1*x2^1*x4^3*x6^5+1073741822*x2^1*x3^1*x4^1*x5^1*x6^5+1073741825*x3^2*x4^1*x5^1*x6^5+10*x2^1*x4^2*x5^1*x6^5+1*x3^1*x4^2*x5^1*x6^5+6*x4^3*x5^1*x6^5+1073741824*x3^2*x5^2*x6^5+2*x2^1*x4^1*x5^2*x6^5+2*x3^1*x4^1*x5^2*x6^5+13*x4^2*x5^2*x6^5+1073741819*x2^1*x5^3*x6^5+1073741814*x3^1*x5^3*x6^5+4*x4^1*x5^3*x6^5+1073741819*x5^4*x6^5,
+1*x3^2*x4^2*x6^5+1*x2^1*x3^1*x4^1*x5^1*x6^5+1073741825*x2^1*x4^2*x5^1*x6^5+2*x3^1*x4^2*x5^1*x6^5+1073741826*x4^3*x5^1*x6^5+1073741825*x2^1*x4^1*x5^2*x6^5+1073741825*x3^1*x4^1*x5^2*x6^5+1073741825*x4^2*x5^2*x6^5+3*x2^1*x5^3*x6^5+2*x3^1*x5^3*x6^5+1073741825*x4^1*x5^3*x6^5+2*x5^4*x6^5,
+1*x2^1*x5^5*x6^5+1073741826*x3^1*x5^5*x6^5+1073741826*x2^1*x6^10+1*x3^1*x6^10,
+1*x3^1*x4^2*x5^3*x6^5+357913943*x4^3*x5^3*x6^5+357913941*x2^1*x3^1*x5^4*x6^5+357913941*x3^2*x5^4*x6^5+715827885*x2^1*x4^1*x5^4*x6^5+715827883*x3^1*x4^1*x5^4*x6^5+2*x4^2*x5^4*x6^5+1002159037*x3^1*x5^5*x6^5+644245096*x4^1*x5^5*x6^5+501079519*x5^6*x6^5+1*x2^1*x6^10+71582788*x3^1*x6^10+429496731*x4^1*x6^10+214748367*x5^1*x6^10,
+1*x2^1*x4^2*x5^3*x6^5+715827885*x4^3*x5^3*x6^5+715827885*x2^1*x3^1*x5^4*x6^5+715827885*x3^2*x5^4*x6^5+357913942*x2^1*x4^1*x5^4*x6^5+357913943*x3^1*x4^1*x5^4*x6^5+715827884*x3^1*x5^5*x6^5+357913942*x5^6*x6^5+1073741826*x2^1*x6^10+357913943*x3^1*x6^10+1073741826*x5^1*x6^10,
+1*x3^1*x4^1*x5^5*x6^5+536870914*x4^2*x5^5*x6^5+4*x3^1*x5^6*x6^5+536870914*x4^1*x5^6*x6^5+536870915*x5^7*x6^5+1073741826*x3^1*x4^1*x6^10+536870913*x4^2*x6^10+1073741823*x3^1*x5^1*x6^10+536870913*x4^1*x5^1*x6^10+536870912*x5^2*x6^10,
+1*x3^2*x5^5*x6^5+3*x3^1*x5^6*x6^5+1*x5^7*x6^5+1073741826*x3^2*x6^10+1073741824*x3^1*x5^1*x6^10+1073741826*x5^2*x6^10,
+1*x5^8*x6^5+42*x2^1*x3^1*x4^1*x6^10+21*x3^2*x4^1*x6^10+1073741662*x2^1*x4^2*x6^10+42*x3^1*x4^2*x6^10+1073741772*x4^3*x6^10+1073741751*x2^1*x3^1*x5^1*x6^10+1073741772*x3^2*x5^1*x6^10+13*x2^1*x4^1*x5^1*x6^10+1073741696*x3^1*x4^1*x5^1*x6^10+1073741806*x4^2*x5^1*x6^10+186*x2^1*x5^2*x6^10+21*x3^1*x5^2*x6^10+1073741785*x4^1*x5^2*x6^10+219*x5^3*x6^10,
+1*x4^1*x5^7*x6^5+1073741717*x2^1*x3^1*x4^1*x6^10+1073741772*x3^2*x4^1*x6^10+52*x2^1*x4^2*x6^10+60*x3^1*x4^2*x6^10+39*x4^3*x6^10+29*x2^1*x3^1*x5^1*x6^10+1073741801*x3^2*x5^1*x6^10+1073741793*x2^1*x4^1*x5^1*x6^10+1073741725*x3^1*x4^1*x5^1*x6^10+120*x4^2*x5^1*x6^10+63*x2^1*x5^2*x6^10+1073741707*x3^1*x5^2*x6^10+109*x4^1*x5^2*x6^10+1073741801*x5^3*x6^10,
+1*x3^1*x5^7*x6^5+1073741811*x2^1*x3^1*x4^1*x6^10+1073741819*x3^2*x4^1*x6^10+63*x2^1*x4^2*x6^10+1073741811*x3^1*x4^2*x6^10+21*x4^3*x6^10+29*x2^1*x3^1*x5^1*x6^10+21*x3^2*x5^1*x6^10+1073741822*x2^1*x4^1*x5^1*x6^10+50*x3^1*x4^1*x5^1*x6^10+8*x4^2*x5^1*x6^10+1073741756*x2^1*x5^2*x6^10+1073741818*x3^1*x5^2*x6^10+16*x4^1*x5^2*x6^10+1073741743*x5^3*x6^10]:
@@ -0,0 +1,45 @@
+#Reduced Groebner basis data
+#---
+#field characteristic: 251
+#variable order:       x1, x2, x3, x4, x5, x6
+#monomial order:       graded reverse lexicographical
+#length of basis:      38 elements sorted by increasing leading monomials
+#---
+[1*x1^1+1*x2^1+1*x3^1+1*x4^1+1*x5^1,
+1*x2^2+1*x2^1*x4^1+250*x3^1*x4^1+2*x2^1*x5^1+1*x3^1*x5^1+1*x5^2,
+1*x2^1*x3^2+250*x2^1*x3^1*x4^1+1*x3^2*x4^1+250*x3^2*x5^1+1*x2^1*x4^1*x5^1+1*x3^1*x4^1*x5^1+1*x4^2*x5^1+250*x2^1*x5^2+249*x3^1*x5^2+1*x4^1*x5^2+250*x5^3,
+1*x2^1*x3^1*x4^2+1*x2^1*x3^1*x4^1*x5^1+1*x3^2*x4^1*x5^1+250*x2^1*x4^2*x5^1+1*x3^1*x4^2*x5^1+250*x4^3*x5^1+250*x2^1*x3^1*x5^2+250*x2^1*x4^1*x5^2+249*x4^2*x5^2+1*x2^1*x5^3+1*x3^1*x5^3+250*x4^1*x5^3+1*x5^4,
+1*x3^3*x4^1+250*x3^2*x4^2+250*x3^3*x5^1+250*x2^1*x3^1*x4^1*x5^1+3*x3^2*x4^1*x5^1+1*x2^1*x4^2*x5^1+1*x4^3*x5^1+250*x2^1*x3^1*x5^2+247*x3^2*x5^2+4*x2^1*x4^1*x5^2+2*x3^1*x4^1*x5^2+5*x4^2*x5^2+248*x2^1*x5^3+245*x3^1*x5^3+3*x4^1*x5^3+248*x5^4,
+1*x2^1*x3^1*x4^1*x5^2+126*x3^2*x4^1*x5^2+1*x3^1*x4^2*x5^2+125*x2^1*x3^1*x5^3+250*x2^1*x4^1*x5^3+125*x3^1*x4^1*x5^3+125*x4^2*x5^3+126*x2^1*x5^4+126*x3^1*x5^4+250*x4^1*x5^4+126*x5^5+125*x6^5,
+1*x3^2*x4^2*x5^1+250*x2^1*x4^3*x5^1+248*x3^1*x4^3*x5^1+250*x4^4*x5^1+1*x3^3*x5^2+125*x3^2*x4^1*x5^2+249*x2^1*x4^2*x5^2+250*x3^1*x4^2*x5^2+246*x4^3*x5^2+129*x2^1*x3^1*x5^3+5*x3^2*x5^3+248*x2^1*x4^1*x5^3+128*x3^1*x4^1*x5^3+119*x4^2*x5^3+128*x2^1*x5^4+132*x3^1*x5^4+250*x4^1*x5^4+128*x5^5+125*x6^5,
+1*x3^2*x4^3+250*x2^1*x4^3*x5^1+250*x4^4*x5^1+250*x2^1*x4^2*x5^2+248*x4^3*x5^2+2*x2^1*x3^1*x5^3+1*x3^2*x5^3+3*x3^1*x4^1*x5^3+249*x4^2*x5^3+1*x3^1*x5^4+1*x4^1*x5^4+250*x6^5,
+1*x3^3*x5^3+125*x3^2*x4^1*x5^3+249*x2^1*x4^2*x5^3+249*x3^1*x4^2*x5^3+250*x4^3*x5^3+126*x2^1*x3^1*x5^4+3*x3^2*x5^4+250*x2^1*x4^1*x5^4+124*x3^1*x4^1*x5^4+123*x4^2*x5^4+127*x2^1*x5^5+129*x3^1*x5^5+250*x4^1*x5^5+127*x5^6+1*x2^1*x6^5+250*x3^1*x6^5+126*x5^1*x6^5,
+1*x3^1*x4^3*x5^2+125*x2^1*x4^2*x5^3+125*x3^1*x4^2*x5^3+126*x4^3*x5^3+125*x2^1*x3^1*x5^4+125*x3^2*x5^4+1*x2^1*x4^1*x5^4+125*x3^1*x4^1*x5^4+1*x4^2*x5^4+125*x2^1*x5^5+250*x3^1*x5^5+126*x4^1*x5^5+125*x5^6+126*x2^1*x6^5+125*x4^1*x6^5+126*x5^1*x6^5,
+1*x2^1*x4^3*x5^2+1*x4^4*x5^2+125*x3^2*x4^1*x5^3+128*x2^1*x4^2*x5^3+127*x3^1*x4^2*x5^3+128*x4^3*x5^3+126*x3^2*x5^4+248*x2^1*x4^1*x5^4+249*x3^1*x4^1*x5^4+125*x4^2*x5^4+1*x2^1*x5^5+127*x3^1*x5^5+123*x4^1*x5^5+1*x5^6+124*x2^1*x6^5+250*x3^1*x6^5+127*x4^1*x6^5+248*x5^1*x6^5,
+1*x3^4*x5^2+250*x4^4*x5^2+2*x3^2*x4^1*x5^3+128*x2^1*x4^2*x5^3+128*x3^1*x4^2*x5^3+122*x4^3*x5^3+132*x2^1*x3^1*x5^4+124*x3^2*x5^4+137*x3^1*x4^1*x5^4+249*x4^2*x5^4+122*x2^1*x5^5+247*x3^1*x5^5+129*x4^1*x5^5+122*x5^6+120*x2^1*x6^5+6*x3^1*x6^5+122*x4^1*x6^5+118*x5^1*x6^5,
+1*x3^1*x4^4*x5^1+250*x4^4*x5^2+127*x3^2*x4^1*x5^3+114*x2^1*x4^2*x5^3+120*x3^1*x4^2*x5^3+118*x4^3*x5^3+124*x3^2*x5^4+8*x2^1*x4^1*x5^4+4*x3^1*x4^1*x5^4+125*x4^2*x5^4+248*x2^1*x5^5+121*x3^1*x5^5+132*x4^1*x5^5+248*x5^6+132*x2^1*x6^5+5*x3^1*x6^5+118*x4^1*x6^5+13*x5^1*x6^5,
+1*x2^1*x4^4*x5^1+1*x4^5*x5^1+6*x4^4*x5^2+121*x3^2*x4^1*x5^3+34*x2^1*x4^2*x5^3+16*x3^1*x4^2*x5^3+23*x4^3*x5^3+126*x2^1*x3^1*x5^4+5*x3^2*x5^4+224*x2^1*x4^1*x5^4+111*x3^1*x4^1*x5^4+125*x4^2*x5^4+135*x2^1*x5^5+140*x3^1*x5^5+229*x4^1*x5^5+135*x5^6+233*x2^1*x6^5+236*x3^1*x6^5+22*x4^1*x6^5+85*x5^1*x6^5,
+1*x2^1*x3^1*x5^5+126*x3^2*x5^5+250*x2^1*x4^1*x5^5+125*x4^2*x5^5+126*x3^1*x5^6+125*x4^1*x5^6+250*x2^1*x3^1*x6^5+125*x3^2*x6^5+1*x2^1*x4^1*x6^5+126*x4^2*x6^5+125*x3^1*x5^1*x6^5+126*x4^1*x5^1*x6^5,
+1*x4^3*x5^4+75*x3^2*x5^5+151*x2^1*x4^1*x5^5+250*x3^1*x4^1*x5^5+27*x4^2*x5^5+150*x2^1*x5^6+225*x3^1*x5^6+226*x4^1*x5^6+150*x5^7+249*x2^1*x3^1*x6^5+174*x3^2*x6^5+102*x2^1*x4^1*x6^5+227*x4^2*x6^5+101*x2^1*x5^1*x6^5+23*x3^1*x5^1*x6^5+25*x4^1*x5^1*x6^5+103*x5^2*x6^5,
+1*x3^1*x4^2*x5^4+226*x3^2*x5^5+49*x2^1*x4^1*x5^5+99*x3^1*x4^1*x5^5+25*x4^2*x5^5+201*x2^1*x5^6+176*x3^1*x5^6+24*x4^1*x5^6+201*x5^7+25*x3^2*x6^5+201*x2^1*x4^1*x6^5+151*x3^1*x4^1*x6^5+226*x4^2*x6^5+51*x2^1*x5^1*x6^5+75*x3^1*x5^1*x6^5+227*x4^1*x5^1*x6^5+50*x5^2*x6^5,
+1*x2^1*x4^2*x5^4+226*x3^2*x5^5+201*x2^1*x4^1*x5^5+1*x3^1*x4^1*x5^5+75*x4^2*x5^5+201*x2^1*x5^6+176*x3^1*x5^6+176*x4^1*x5^6+201*x5^7+1*x2^1*x3^1*x6^5+26*x3^2*x6^5+49*x2^1*x4^1*x6^5+175*x4^2*x6^5+49*x2^1*x5^1*x6^5+76*x3^1*x5^1*x6^5+75*x4^1*x5^1*x6^5+48*x5^2*x6^5,
+1*x4^4*x5^3+250*x3^2*x4^1*x5^4+152*x3^2*x5^5+246*x2^1*x4^1*x5^5+200*x3^1*x4^1*x5^5+194*x4^2*x5^5+53*x2^1*x5^6+205*x3^1*x5^6+147*x4^1*x5^6+53*x5^7+3*x2^1*x3^1*x6^5+103*x3^2*x6^5+49*x3^1*x4^1*x6^5+49*x4^2*x6^5+200*x2^1*x5^1*x6^5+54*x3^1*x5^1*x6^5+104*x4^1*x5^1*x6^5+196*x5^2*x6^5,
+1*x4^5*x5^2+2*x3^2*x4^1*x5^4+173*x3^2*x5^5+210*x2^1*x4^1*x5^5+101*x3^1*x4^1*x5^5+189*x4^2*x5^5+95*x2^1*x5^6+17*x3^1*x5^6+132*x4^1*x5^6+95*x5^7+242*x2^1*x3^1*x6^5+67*x3^2*x6^5+52*x2^1*x4^1*x6^5+152*x3^1*x4^1*x6^5+82*x4^2*x6^5+154*x2^1*x5^1*x6^5+214*x3^1*x5^1*x6^5+119*x4^1*x5^1*x6^5+162*x5^2*x6^5,
+1*x3^3*x6^5+1*x2^1*x3^1*x4^1*x6^5+249*x2^1*x4^2*x6^5+250*x3^1*x4^2*x6^5+250*x4^3*x6^5+3*x3^2*x5^1*x6^5+249*x2^1*x4^1*x5^1*x6^5+249*x3^1*x4^1*x5^1*x6^5+248*x4^2*x5^1*x6^5+3*x2^1*x5^2*x6^5+3*x3^1*x5^2*x6^5+249*x4^1*x5^2*x6^5+2*x5^3*x6^5,
+1*x4^2*x5^6+28*x2^1*x3^1*x4^1*x6^5+14*x3^2*x4^1*x6^5+230*x2^1*x4^2*x6^5+239*x3^1*x4^2*x6^5+239*x4^3*x6^5+240*x2^1*x3^1*x5^1*x6^5+3*x3^2*x5^1*x6^5+9*x2^1*x4^1*x5^1*x6^5+17*x3^1*x4^1*x5^1*x6^5+221*x4^2*x5^1*x6^5+246*x2^1*x5^2*x6^5+29*x3^1*x5^2*x6^5+223*x4^1*x5^2*x6^5+18*x5^3*x6^5,
+1*x3^1*x4^1*x5^6+42*x2^1*x3^1*x4^1*x6^5+21*x3^2*x4^1*x6^5+231*x2^1*x4^2*x6^5+228*x3^1*x4^2*x6^5+236*x4^3*x6^5+240*x2^1*x3^1*x5^1*x6^5+10*x3^2*x5^1*x6^5+13*x2^1*x4^1*x5^1*x6^5+38*x3^1*x4^1*x5^1*x6^5+205*x4^2*x5^1*x6^5+227*x2^1*x5^2*x6^5+46*x3^1*x5^2*x6^5+209*x4^1*x5^2*x6^5+10*x5^3*x6^5,
+1*x2^1*x4^1*x5^6+1*x4^1*x5^7+183*x2^1*x3^1*x4^1*x6^5+217*x3^2*x4^1*x6^5+32*x2^1*x4^2*x6^5+37*x3^1*x4^2*x6^5+24*x4^3*x6^5+18*x2^1*x3^1*x5^1*x6^5+235*x3^2*x5^1*x6^5+229*x2^1*x4^1*x5^1*x6^5+188*x3^1*x4^1*x5^1*x6^5+74*x4^2*x5^1*x6^5+39*x2^1*x5^2*x6^5+177*x3^1*x5^2*x6^5+67*x4^1*x5^2*x6^5+235*x5^3*x6^5,
+1*x3^2*x5^6+2*x2^1*x5^7+3*x3^1*x5^7+1*x4^1*x5^7+2*x5^8+151*x2^1*x3^1*x4^1*x6^5+201*x3^2*x4^1*x6^5+13*x2^1*x4^2*x6^5+70*x3^1*x4^2*x6^5+26*x4^3*x6^5+11*x2^1*x3^1*x5^1*x6^5+211*x3^2*x5^1*x6^5+220*x2^1*x4^1*x5^1*x6^5+118*x3^1*x4^1*x5^1*x6^5+115*x4^2*x5^1*x6^5+105*x2^1*x5^2*x6^5+133*x3^1*x5^2*x6^5+99*x4^1*x5^2*x6^5+24*x5^3*x6^5,
+1*x3^2*x4^1*x5^5+235*x2^1*x3^1*x4^1*x6^5+242*x3^2*x4^1*x6^5+8*x2^1*x4^2*x6^5+9*x3^1*x4^2*x6^5+6*x4^3*x6^5+4*x2^1*x3^1*x5^1*x6^5+247*x3^2*x5^1*x6^5+246*x2^1*x4^1*x5^1*x6^5+236*x3^1*x4^1*x5^1*x6^5+18*x4^2*x5^1*x6^5+9*x2^1*x5^2*x6^5+233*x3^1*x5^2*x6^5+16*x4^1*x5^2*x6^5+247*x5^3*x6^5,
+1*x4^4*x6^5+14*x2^1*x3^1*x4^1*x5^1*x6^5+6*x3^2*x4^1*x5^1*x6^5+224*x2^1*x4^2*x5^1*x6^5+2*x3^1*x4^2*x5^1*x6^5+236*x4^3*x5^1*x6^5+250*x2^1*x3^1*x5^2*x6^5+7*x3^2*x5^2*x6^5+241*x2^1*x4^1*x5^2*x6^5+242*x3^1*x4^1*x5^2*x6^5+218*x4^2*x5^2*x6^5+24*x2^1*x5^3*x6^5+33*x3^1*x5^3*x6^5+237*x4^1*x5^3*x6^5+22*x5^4*x6^5,
+1*x3^1*x4^3*x6^5+249*x2^1*x3^1*x4^1*x5^1*x6^5+250*x3^2*x4^1*x5^1*x6^5+5*x2^1*x4^2*x5^1*x6^5+4*x4^3*x5^1*x6^5+250*x2^1*x3^1*x5^2*x6^5+249*x3^2*x5^2*x6^5+2*x2^1*x4^1*x5^2*x6^5+7*x4^2*x5^2*x6^5+247*x2^1*x5^3*x6^5+244*x3^1*x5^3*x6^5+2*x4^1*x5^3*x6^5+247*x5^4*x6^5,
+1*x2^1*x4^3*x6^5+246*x2^1*x3^1*x4^1*x5^1*x6^5+249*x3^2*x4^1*x5^1*x6^5+10*x2^1*x4^2*x5^1*x6^5+1*x3^1*x4^2*x5^1*x6^5+6*x4^3*x5^1*x6^5+248*x3^2*x5^2*x6^5+2*x2^1*x4^1*x5^2*x6^5+2*x3^1*x4^1*x5^2*x6^5+13*x4^2*x5^2*x6^5+243*x2^1*x5^3*x6^5+238*x3^1*x5^3*x6^5+4*x4^1*x5^3*x6^5+243*x5^4*x6^5,
+1*x3^2*x4^2*x6^5+1*x2^1*x3^1*x4^1*x5^1*x6^5+249*x2^1*x4^2*x5^1*x6^5+2*x3^1*x4^2*x5^1*x6^5+250*x4^3*x5^1*x6^5+249*x2^1*x4^1*x5^2*x6^5+249*x3^1*x4^1*x5^2*x6^5+249*x4^2*x5^2*x6^5+3*x2^1*x5^3*x6^5+2*x3^1*x5^3*x6^5+249*x4^1*x5^3*x6^5+2*x5^4*x6^5,
+1*x2^1*x5^5*x6^5+250*x3^1*x5^5*x6^5+250*x2^1*x6^10+1*x3^1*x6^10,
+1*x3^1*x4^2*x5^3*x6^5+168*x4^3*x5^3*x6^5+166*x2^1*x3^1*x5^4*x6^5+166*x3^2*x5^4*x6^5+84*x2^1*x4^1*x5^4*x6^5+82*x3^1*x4^1*x5^4*x6^5+2*x4^2*x5^4*x6^5+216*x3^1*x5^5*x6^5+50*x4^1*x5^5*x6^5+234*x5^6*x6^5+1*x2^1*x6^10+33*x3^1*x6^10+201*x4^1*x6^10+102*x5^1*x6^10,
+1*x2^1*x4^2*x5^3*x6^5+84*x4^3*x5^3*x6^5+84*x2^1*x3^1*x5^4*x6^5+84*x3^2*x5^4*x6^5+167*x2^1*x4^1*x5^4*x6^5+168*x3^1*x4^1*x5^4*x6^5+83*x3^1*x5^5*x6^5+167*x5^6*x6^5+250*x2^1*x6^10+168*x3^1*x6^10+250*x5^1*x6^10,
+1*x3^1*x4^1*x5^5*x6^5+126*x4^2*x5^5*x6^5+4*x3^1*x5^6*x6^5+126*x4^1*x5^6*x6^5+127*x5^7*x6^5+250*x3^1*x4^1*x6^10+125*x4^2*x6^10+247*x3^1*x5^1*x6^10+125*x4^1*x5^1*x6^10+124*x5^2*x6^10,
+1*x3^2*x5^5*x6^5+3*x3^1*x5^6*x6^5+1*x5^7*x6^5+250*x3^2*x6^10+248*x3^1*x5^1*x6^10+250*x5^2*x6^10,
+1*x5^8*x6^5+42*x2^1*x3^1*x4^1*x6^10+21*x3^2*x4^1*x6^10+86*x2^1*x4^2*x6^10+42*x3^1*x4^2*x6^10+196*x4^3*x6^10+175*x2^1*x3^1*x5^1*x6^10+196*x3^2*x5^1*x6^10+13*x2^1*x4^1*x5^1*x6^10+120*x3^1*x4^1*x5^1*x6^10+230*x4^2*x5^1*x6^10+186*x2^1*x5^2*x6^10+21*x3^1*x5^2*x6^10+209*x4^1*x5^2*x6^10+219*x5^3*x6^10,
+1*x4^1*x5^7*x6^5+141*x2^1*x3^1*x4^1*x6^10+196*x3^2*x4^1*x6^10+52*x2^1*x4^2*x6^10+60*x3^1*x4^2*x6^10+39*x4^3*x6^10+29*x2^1*x3^1*x5^1*x6^10+225*x3^2*x5^1*x6^10+217*x2^1*x4^1*x5^1*x6^10+149*x3^1*x4^1*x5^1*x6^10+120*x4^2*x5^1*x6^10+63*x2^1*x5^2*x6^10+131*x3^1*x5^2*x6^10+109*x4^1*x5^2*x6^10+225*x5^3*x6^10,
+1*x3^1*x5^7*x6^5+235*x2^1*x3^1*x4^1*x6^10+243*x3^2*x4^1*x6^10+63*x2^1*x4^2*x6^10+235*x3^1*x4^2*x6^10+21*x4^3*x6^10+29*x2^1*x3^1*x5^1*x6^10+21*x3^2*x5^1*x6^10+246*x2^1*x4^1*x5^1*x6^10+50*x3^1*x4^1*x5^1*x6^10+8*x4^2*x5^1*x6^10+180*x2^1*x5^2*x6^10+242*x3^1*x5^2*x6^10+16*x4^1*x5^2*x6^10+167*x5^3*x6^10]:
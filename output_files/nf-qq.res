@@ -0,0 +1,2 @@
+[7/5*x3^2+14/5*x2*x4+32/5*x3*x4+27/5*x4^2+4/5*x2*x5+26/5*x3*x5+52/5*x4*x5+27/5*x5^2-1/5*x2-4/5*x3-9/5*x4-9/5*x5,
+-12/5*x3^2-24/5*x2*x4-42/5*x3*x4-32/5*x4^2+6/5*x2*x5-16/5*x3*x5-42/5*x4*x5-12/5*x5^2+1/5*x2+4/5*x3+9/5*x4+4/5*x5]:
@@ -0,0 +1,3 @@
+[0, [1,
+[[[2606494943347515047138634809021796624166384390841758692672282559828202832506225 / 2^255, 5212989886695030094277269618043593248332768781683517385344565119656405665012451 / 2^256], [19613276288264956083908691349424102592877149849370739618118444337517838188983 / 2^256, 2451659536033119510488586418678012824109643731171342452264805542189729773623 / 2^253], [34920674592991439017236863052172999544704796936776352401783769005730613839267441 / 2^254, 139682698371965756068947452208691998178819187747105409607135076022922455357069765 / 2^256], [540885538069380287087984134095240059718584175084373749355321366122278204017073653 / 2^255, 1081771076138760574175968268190480119437168350168747498710642732244556408034147307 / 2^256]], [[1231195483166375101033967204361512516913 / 2^127, 2462390966332750202067934408723025033827 / 2^128], [61890123607913306301466379005685955835 / 2^128, 15472530901978326575366594751421488959 / 2^126], [5291288561048193107176309412527934968339 / 2^127, 10582577122096386214352618825055869936679 / 2^128], [33904817720423727345775268306844647680281 / 2^128, 16952408860211863672887634153422323840141 / 2^127]], [[5081213661087957008899163023563018985577302626965683450466068119344905472392583 / 2^255, 10162427322175914017798326047126037971154605253931366900932136238689810944785167 / 2^256], [-1165860587047760961471161023725318656297950420615745115690818207740145808227 / 2^252, -18653769392764175383538576379605098500767206729851921851053091323842332931631 / 2^256], [159383682635610700541051059816417782516155228456080888366570071543966450235295 / 2^255, 318767365271221401082102119632835565032310456912161776733140143087932900470591 / 2^256], [-60938501059019781199085718659537673651589965757589537718195682802602874312551 / 2^256, -30469250529509890599542859329768836825794982878794768859097841401301437156275 / 2^255]], [[29433305770899831525447638201843798761827 / 2^128, 7358326442724957881361909550460949690457 / 2^126], [7348326763861920280739804349370071173 / 2^125, 58786614110895362245918434794960569385 / 2^128], [468389485463247297316288699630786806479 / 2^127, 936778970926494594632577399261573612959 / 2^128], [-181434156373594113533553379330236815789 / 2^128, -45358539093398528383388344832559203947 / 2^126]], [[356940859447054316780803362719188489363 / 2^128, 89235214861763579195200840679797122341 / 2^126], [142430410186240245305984728867120695099 / 2^127, 284860820372480490611969457734241390199 / 2^128], [33912934784428598456257843545888262523 / 2^126, 135651739137714393825031374183553050093 / 2^128], [22866916215983776639567034994840870223 / 2^124, 365870659455740426233072559917453923569 / 2^128]], [[32206964971402775921687490567204882675 / 2^126, 128827859885611103686749962268819530701 / 2^128], [284134068049382510972053292908280701939 / 2^127, 568268136098765021944106585816561403879 / 2^128], [126533637587942174964991773214392191429 / 2^127, 253067275175884349929983546428784382859 / 2^128], [-37397810579198249416961518632295913211 / 2^127, -74795621158396498833923037264591826421 / 2^128]], [[242344122145962323916462752377567108931 / 2^128, 60586030536490580979115688094391777233 / 2^126], [87679263662514071805775484194976937619 / 2^126, 350717054650056287223101936779907750477 / 2^128], [29426402253650524731890616914230017175 / 2^126, 117705609014602098927562467656920068701 / 2^128], [-120973757258183838635580510727502330413 / 2^127, -241947514516367677271161021455004660825 / 2^128]], [[270987986933647118154757782905255024781 / 2^128, 135493993466823559077378891452627512391 / 2^127], [-496113705386580270675790922564246201423 / 2^128, -248056852693290135337895461282123100711 / 2^127], [179498992570772467225653690447674792067 / 2^127, 358997985141544934451307380895349584135 / 2^128], [11656345330678603060300343061045370363 / 2^124, 186501525290857648964805488976725925809 / 2^128]], [[57147295709468540957619583419442219169 / 2^128, 28573647854734270478809791709721109585 / 2^127], [-874593438639079062616877477807025914033 / 2^128, -54662089914942441413554842362939119627 / 2^124], [75506928187311091411038255659557397835 / 2^126, 302027712749244365644153022638229591341 / 2^128], [34479770462018814968289149501513663753 / 2^127, 68959540924037629936578299003027327507 / 2^128]], [[616697302479105464219603864265542945103 / 2^127, 1233394604958210928439207728531085890207 / 2^128], [36789291819117441728410105257375194043 / 2^128, 9197322954779360432102526314343798511 / 2^126], [2729319341614279898723659905584030185729 / 2^128, 1364659670807139949361829952792015092865 / 2^127], [-6270637535330271692444200364014446781829 / 2^128, -1567659383832567923111050091003611695457 / 2^126]]]
+]]:
@@ -0,0 +1,3 @@
+[0, [1,
+[[[115792089237316195423570985008687907853269984665640564039457584007913129639935 / 2^256, 115792089237316195423570985008687907853269984665640564039457584007913129639937 / 2^256], [-195588797382542491125158180006061917121274880650461442720794586281483643715925749832381 / 2^285, -48897199345635622781289545001515479280318720162615360680198646570370910928981437458095 / 2^283], [347376267711948586270712955026063723559809953996921692118372752023739388919807 / 2^256, 347376267711948586270712955026063723559809953996921692118372752023739388919809 / 2^256]], [[340282366920938463463374607431768211455 / 2^128, 340282366920938463463374607431768211457 / 2^128], [-1730470561453623354849717862660544652463 / 2^132, -3460941122907246709699435725321089304925 / 2^133], [1020847100762815390390123822295304634367 / 2^128, 1020847100762815390390123822295304634369 / 2^128]], [[115792089237316195423570985008687907853269984665640564039457584007913129639935 / 2^256, 115792089237316195423570985008687907853269984665640564039457584007913129639937 / 2^256], [294424309269222127197411312010300101843249109089409722386965015304216629192125 / 2^259, 147212154634611063598705656005150050921624554544704861193482507652108314596063 / 2^258], [173688133855974293135356477513031861779904976998460846059186376011869694459903 / 2^255, 173688133855974293135356477513031861779904976998460846059186376011869694459905 / 2^255]], [[340282366920938463463374607431768211455 / 2^128, 340282366920938463463374607431768211457 / 2^128], [9874710768274018174577359138060953228837828078786740538393 / 2^191, 4937355384137009087288679569030476614418914039393370269197 / 2^190], [1020847100762815390390123822295304634367 / 2^128, 1020847100762815390390123822295304634369 / 2^128]]]
+]]:
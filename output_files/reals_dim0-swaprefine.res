@@ -0,0 +1,3 @@
+[0, [1,
+[[[340282366920938463463374607431768211455 / 2^128, 340282366920938463463374607431768211457 / 2^128], [-4937355384137009087288679569030476614418914039393370269197 / 2^190, -9874710768274018174577359138060953228837828078786740538393 / 2^191], [1020847100762815390390123822295304634367 / 2^128, 1020847100762815390390123822295304634369 / 2^128]], [[340282366920938463463374607431768211455 / 2^128, 340282366920938463463374607431768211457 / 2^128], [-1730470561453623354849717862660544652463 / 2^132, -3460941122907246709699435725321089304925 / 2^133], [1020847100762815390390123822295304634367 / 2^128, 1020847100762815390390123822295304634369 / 2^128]], [[340282366920938463463374607431768211455 / 2^128, 340282366920938463463374607431768211457 / 2^128], [3460941122907246709699435725321089304925 / 2^133, 1730470561453623354849717862660544652463 / 2^132], [1020847100762815390390123822295304634367 / 2^128, 1020847100762815390390123822295304634369 / 2^128]], [[340282366920938463463374607431768211455 / 2^128, 340282366920938463463374607431768211457 / 2^128], [9874710768274018174577359138060953228837828078786740538393 / 2^191, 4937355384137009087288679569030476614418914039393370269197 / 2^190], [1020847100762815390390123822295304634367 / 2^128, 1020847100762815390390123822295304634369 / 2^128]]]
+]]:
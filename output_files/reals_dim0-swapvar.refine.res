@@ -0,0 +1,3 @@
+[0, [1,
+[[[1, 1], [-2, -2], [3, 3]], [[1, 1], [2, 2], [3, 3]]]
+]]:
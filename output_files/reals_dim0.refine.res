@@ -0,0 +1,3 @@
+[0, [1,
+[[[73018715818125263072259336873146140024974974134201166606002351317893271212109 / 2^256, 36509357909062631536129668436573070012487487067100583303001175658946635606057 / 2^255], [36509357909062631536129668436573070012487487067100583303001175658946635606055 / 2^256, 36509357909062631536129668436573070012487487067100583303001175658946635606057 / 2^256], [-60490684797868661441895377475208744393359927205523538345094237255746825568573 / 2^258, -120981369595737322883790754950417488786719854411047076690188474511493651137145 / 2^259]], [[1, 1], [0, 0], [0, 0]], [[13115823192644309359686467995721747638913934932459658428194931773016134239587 / 2^255, 26231646385288618719372935991443495277827869864919316856389863546032268479351 / 2^256], [13115823192644309359686467995721747638913934932459658428194931773016134239609 / 2^256, 6557911596322154679843233997860873819456967466229829214097465886508067119827 / 2^255], [31664398233369478992412556512900458648807122467900965163338928457924296340705 / 2^256, 15832199116684739496206278256450229324403561233950482581669464228962148170353 / 2^255]], [[7089215977519551322153637654828504405 / 2^124, 113427455640312821154458202477256070491 / 2^128], [-1 / 2^127, 1 / 2^127], [1814839290245005138471331239636097127765 / 2^132, 907419645122502569235665619818048563883 / 2^131]]]
+]]:
@@ -191,290 +191,31 @@ void nmod_berlekamp_massey_add_point_modif(
     B->points->length = old_length + 1;
 }
 
-//shift ne sert pas 
-int nmod_em_gcd(nmod_berlekamp_massey_t B, long shift){
-  slong i, l, k, queue_len, queue_lo, queue_hi;
-  queue_lo = B->npoints; // vaut 0 en entree
-  queue_hi = B->points->length; //vaut 2*dim ou dim est la dimension du quotient
-  queue_len = queue_hi - queue_lo;
-  FLINT_ASSERT(queue_len >= 0);
-  nmod_poly_zero(B->rt);
-  for (i = 0; i < queue_len; i++)
-    {
-      nmod_poly_set_coeff_ui(B->rt, queue_len - i - 1,
-                             B->points->coeffs[queue_lo + i]);
-    }
-  B->npoints = queue_hi;
-
-  //  nmod_poly_fprint_pretty(stderr, B->R0, "x");fprintf(stderr, "\n");
-
-  /* Ri = Ri * x^queue_len + Vi*rt */
-  //R0 vaut x^queue_len-1 avec queue_len = 2*dim - 1
-  nmod_poly_shift_left(B->R0, B->R0, queue_len);
-
-  nmod_poly_mul(B->qt, B->V0, B->rt);
-  nmod_poly_add(B->R0, B->R0, B->qt);
-  nmod_poly_mul(B->qt, B->V1, B->rt);
-  nmod_poly_shift_left(B->R1, B->R1, queue_len);
-  nmod_poly_add(B->R1, B->R1, B->qt);
-
-  /* now start reducing R0, R1 */
-  if (2*nmod_poly_degree(B->R1) < B->npoints)
-    {
-      /* already have deg(R1) < B->npoints/2 */
-      return 0;
-    }
-  /* one iteration of euclid to get deg(R0) >= B->npoints/2 */
-  nmod_poly_divrem(B->qt, B->rt, B->R0, B->R1);
-  nmod_poly_swap(B->R0, B->R1);
-  nmod_poly_swap(B->R1, B->rt);
-  nmod_poly_mul(B->rt, B->qt, B->V1);
-  nmod_poly_sub(B->qt, B->V0, B->rt);
-  nmod_poly_swap(B->V0, B->V1);
-  nmod_poly_swap(B->V1, B->qt);
-
-  l = nmod_poly_degree(B->R0);
-  FLINT_ASSERT(B->npoints <= 2*l && l < B->npoints);
-
-  k = B->npoints - l;
-  FLINT_ASSERT(0 <= k && k <= l);
-
-  /*
-    (l - k)/2 is the expected number of required euclidean iterations.
-    Either branch is OK anytime. TODO: find cutoff
-  */
-  if (l - k < 10)
-    {
-      while (B->npoints <= 2*nmod_poly_degree(B->R1))
-        {
-          nmod_poly_divrem(B->qt, B->rt, B->R0, B->R1);
-          nmod_poly_swap(B->R0, B->R1);
-          nmod_poly_swap(B->R1, B->rt);
-          nmod_poly_mul(B->rt, B->qt, B->V1);
-          nmod_poly_sub(B->qt, B->V0, B->rt);
-          nmod_poly_swap(B->V0, B->V1);
-          nmod_poly_swap(B->V1, B->qt);
-        }
-    }
-  else
-    {
-      slong sgnM;
-      nmod_poly_t m11, m12, m21, m22, r0, r1, t0, t1;
-      nmod_poly_init_mod(m11, B->V1->mod);
-      nmod_poly_init_mod(m12, B->V1->mod);
-      nmod_poly_init_mod(m21, B->V1->mod);
-      nmod_poly_init_mod(m22, B->V1->mod);
-      nmod_poly_init_mod(r0, B->V1->mod);
-      nmod_poly_init_mod(r1, B->V1->mod);
-      nmod_poly_init_mod(t0, B->V1->mod);
-      nmod_poly_init_mod(t1, B->V1->mod);
-      
-      nmod_poly_shift_right(r0, B->R0, k);
-      nmod_poly_shift_right(r1, B->R1, k);
-      sgnM = nmod_poly_hgcd(m11, m12, m21, m22, t0, t1, r0, r1);
-      
-      /* multiply [[V0 R0] [V1 R1]] by M^(-1) on the left */
-      nmod_poly_mul(B->rt, m22, B->V0);
-      nmod_poly_mul(B->qt, m12, B->V1);
-      sgnM > 0 ? nmod_poly_sub(r0, B->rt, B->qt)
-        : nmod_poly_sub(r0, B->qt, B->rt);
-      nmod_poly_mul(B->rt, m11, B->V1);
-      nmod_poly_mul(B->qt, m21, B->V0);
-      sgnM > 0 ? nmod_poly_sub(r1, B->rt, B->qt)
-        : nmod_poly_sub(r1, B->qt, B->rt);
-      nmod_poly_swap(B->V0, r0);
-      nmod_poly_swap(B->V1, r1);
-      
-      nmod_poly_mul(B->rt, m22, B->R0);
-      nmod_poly_mul(B->qt, m12, B->R1);
-      sgnM > 0 ? nmod_poly_sub(r0, B->rt, B->qt)
-        : nmod_poly_sub(r0, B->qt, B->rt);
-      nmod_poly_mul(B->rt, m11, B->R1);
-      nmod_poly_mul(B->qt, m21, B->R0);
-      sgnM > 0 ? nmod_poly_sub(r1, B->rt, B->qt)
-        : nmod_poly_sub(r1, B->qt, B->rt);
-      nmod_poly_swap(B->R0, r0);
-      nmod_poly_swap(B->R1, r1);
-      
-      nmod_poly_clear(m11);
-      nmod_poly_clear(m12);
-      nmod_poly_clear(m21);
-      nmod_poly_clear(m22);
-      nmod_poly_clear(r0);
-      nmod_poly_clear(r1);
-      nmod_poly_clear(t0);
-      nmod_poly_clear(t1);
-    }
-  
-  FLINT_ASSERT(nmod_poly_degree(B->V1) >= 0);
-  FLINT_ASSERT(2*nmod_poly_degree(B->V1) <= B->npoints);
-  FLINT_ASSERT(2*nmod_poly_degree(B->R0) >= B->npoints);
-  FLINT_ASSERT(2*nmod_poly_degree(B->R1) <  B->npoints);
-
-  
-  return 1;
-}
-
-
-//shift ne sert pas 
-int nmod_em_gcd_preinstantiated(nmod_berlekamp_massey_t B, long shift){
-  slong l, k, queue_len, queue_lo, queue_hi;
-  queue_lo = B->npoints; // vaut 0 en entree
-  queue_hi = B->points->length; //vaut 2*dim ou dim est la dimension du quotient
-  queue_len = queue_hi - queue_lo + shift;
-  FLINT_ASSERT(queue_len >= 0);
-  //On a deja fait ce job de maniere appropriee avant l'appel.
-  /* nmod_poly_zero(B->rt); */
-  /* for (i = 0; i < queue_len; i++) */
-  /*   { */
-  /*     nmod_poly_set_coeff_ui(B->rt, queue_len - i - 1, */
-  /*                            B->points->coeffs[queue_lo + i]); */
-  /*   } */
-  B->npoints = queue_hi;
-
-  //  nmod_poly_fprint_pretty(stderr, B->R0, "x");fprintf(stderr, "\n");
-
-  /* Ri = Ri * x^queue_len + Vi*rt */
-  //R0 vaut x^queue_len-1 avec queue_len = 2*dim - 1
-  nmod_poly_shift_left(B->R0, B->R0, queue_len);
-
-  nmod_poly_mul(B->qt, B->V0, B->rt);
-  nmod_poly_add(B->R0, B->R0, B->qt);
-  nmod_poly_mul(B->qt, B->V1, B->rt);
-  nmod_poly_shift_left(B->R1, B->R1, queue_len);
-  nmod_poly_add(B->R1, B->R1, B->qt);
-
-  /* now start reducing R0, R1 */
-  if (2*nmod_poly_degree(B->R1) < B->npoints)
-    {
-      /* already have deg(R1) < B->npoints/2 */
-      return 0;
-    }
-  /* one iteration of euclid to get deg(R0) >= B->npoints/2 */
-  nmod_poly_divrem(B->qt, B->rt, B->R0, B->R1);
-  nmod_poly_swap(B->R0, B->R1);
-  nmod_poly_swap(B->R1, B->rt);
-  nmod_poly_mul(B->rt, B->qt, B->V1);
-  nmod_poly_sub(B->qt, B->V0, B->rt);
-  nmod_poly_swap(B->V0, B->V1);
-  nmod_poly_swap(B->V1, B->qt);
-
-  l = nmod_poly_degree(B->R0);
-  FLINT_ASSERT(B->npoints <= 2*l && l < B->npoints);
-
-  k = B->npoints - l;
-  FLINT_ASSERT(0 <= k && k <= l);
-
-  /*
-    (l - k)/2 is the expected number of required euclidean iterations.
-    Either branch is OK anytime. TODO: find cutoff
-  */
-  if (l - k < 10)
-    {
-      while (B->npoints <= 2*nmod_poly_degree(B->R1))
-        {
-          nmod_poly_divrem(B->qt, B->rt, B->R0, B->R1);
-          nmod_poly_swap(B->R0, B->R1);
-          nmod_poly_swap(B->R1, B->rt);
-          nmod_poly_mul(B->rt, B->qt, B->V1);
-          nmod_poly_sub(B->qt, B->V0, B->rt);
-          nmod_poly_swap(B->V0, B->V1);
-          nmod_poly_swap(B->V1, B->qt);
-        }
-    }
-  else
-    {
-      slong sgnM;
-      nmod_poly_t m11, m12, m21, m22, r0, r1, t0, t1;
-      nmod_poly_init_mod(m11, B->V1->mod);
-      nmod_poly_init_mod(m12, B->V1->mod);
-      nmod_poly_init_mod(m21, B->V1->mod);
-      nmod_poly_init_mod(m22, B->V1->mod);
-      nmod_poly_init_mod(r0, B->V1->mod);
-      nmod_poly_init_mod(r1, B->V1->mod);
-      nmod_poly_init_mod(t0, B->V1->mod);
-      nmod_poly_init_mod(t1, B->V1->mod);
-      
-      nmod_poly_shift_right(r0, B->R0, k);
-      nmod_poly_shift_right(r1, B->R1, k);
-      sgnM = nmod_poly_hgcd(m11, m12, m21, m22, t0, t1, r0, r1);
-      
-      /* multiply [[V0 R0] [V1 R1]] by M^(-1) on the left */
-      nmod_poly_mul(B->rt, m22, B->V0);
-      nmod_poly_mul(B->qt, m12, B->V1);
-      sgnM > 0 ? nmod_poly_sub(r0, B->rt, B->qt)
-        : nmod_poly_sub(r0, B->qt, B->rt);
-      nmod_poly_mul(B->rt, m11, B->V1);
-      nmod_poly_mul(B->qt, m21, B->V0);
-      sgnM > 0 ? nmod_poly_sub(r1, B->rt, B->qt)
-        : nmod_poly_sub(r1, B->qt, B->rt);
-      nmod_poly_swap(B->V0, r0);
-      nmod_poly_swap(B->V1, r1);
-      
-      nmod_poly_mul(B->rt, m22, B->R0);
-      nmod_poly_mul(B->qt, m12, B->R1);
-      sgnM > 0 ? nmod_poly_sub(r0, B->rt, B->qt)
-        : nmod_poly_sub(r0, B->qt, B->rt);
-      nmod_poly_mul(B->rt, m11, B->R1);
-      nmod_poly_mul(B->qt, m21, B->R0);
-      sgnM > 0 ? nmod_poly_sub(r1, B->rt, B->qt)
-        : nmod_poly_sub(r1, B->qt, B->rt);
-      nmod_poly_swap(B->R0, r0);
-      nmod_poly_swap(B->R1, r1);
-      
-      nmod_poly_clear(m11);
-      nmod_poly_clear(m12);
-      nmod_poly_clear(m21);
-      nmod_poly_clear(m22);
-      nmod_poly_clear(r0);
-      nmod_poly_clear(r1);
-      nmod_poly_clear(t0);
-      nmod_poly_clear(t1);
-    }
-  
-  FLINT_ASSERT(nmod_poly_degree(B->V1) >= 0);
-  FLINT_ASSERT(2*nmod_poly_degree(B->V1) <= B->npoints);
-  FLINT_ASSERT(2*nmod_poly_degree(B->R0) >= B->npoints);
-  FLINT_ASSERT(2*nmod_poly_degree(B->R1) <  B->npoints);
-
-  
-  return 1;
-}
-
-
-
-
+/*
+    Below BM_HGCD_CUTOFF * log2(l) expected quotients, where l = deg(R0) after
+    the first euclidean step, the remainders are reduced one quotient at a
+    time. Above it, a single half-gcd on the top coefficients gives all the
+    quotients at once, which is quasi-linear in the number of points and pays
+    off for large quotient dimensions.
+*/
+#ifndef BM_HGCD_CUTOFF
+#define BM_HGCD_CUTOFF 2
+#endif
 
+/*
+    Adds the queue_len points reversed in B->rt to the internal polynomials
+    and reduces them until deg(R1) < B->npoints/2.
 
-/* return 1 if reduction changed the master poly, 0 otherwise */
-int nmod_berlekamp_massey_reduce_modif(
-    nmod_berlekamp_massey_t B)
+    Returns 1 if reduction changed the master poly, 0 otherwise.
+*/
+static int nmod_berlekamp_massey_reduce_queue(
+    nmod_berlekamp_massey_t B,
+    slong queue_len)
 {
-    slong i, l, k, queue_len, queue_lo, queue_hi;
+    slong l, k;
 
-    /*
-        the points in B->points->coeffs[j] for queue_lo <= j < queue_hi need
-        to be added to the internal polynomials.
-        These are first reversed into rt. deg(rt) < queue_len.
-    */
-    queue_lo = B->npoints;
-    queue_hi = B->points->length;
-    queue_len = queue_hi - queue_lo;
-    FLINT_ASSERT(queue_len >= 0);
-    nmod_poly_zero(B->rt);
-    for (i = 0; i < queue_len; i++)
-    {
-        nmod_poly_set_coeff_ui(B->rt, queue_len - i - 1,
-                                      B->points->coeffs[queue_lo + i]);
-    }
-    B->npoints = queue_hi;
-    //    fprintf(stderr, "queue_len = %ld, queue_hi = %ld, queue_lo=%ld\n", queue_len, queue_hi, queue_lo);
-    //    nmod_poly_fprint_pretty(stderr, B->R0, "x");fprintf(stderr, "\n");
     /* Ri = Ri * x^queue_len + Vi*rt */
-    //R0 vaut x^queue_len
     nmod_poly_shift_left(B->R0, B->R0, queue_len);
-    //    nmod_poly_fprint_pretty(stderr, B->R0, "x");fprintf(stderr, "\n");
-    //done.
 
     nmod_poly_mul(B->qt, B->V0, B->rt);
     nmod_poly_add(B->R0, B->R0, B->qt);
@@ -506,9 +247,9 @@ int nmod_berlekamp_massey_reduce_modif(
 
     /*
         (l - k)/2 is the expected number of required euclidean iterations.
-        Either branch is OK anytime. TODO: find cutoff
+        Either branch is OK anytime.
     */
-    if (l - k < 10)
+    if (l - k < BM_HGCD_CUTOFF * FLINT_BIT_COUNT(l))
     {
         while (B->npoints <= 2*nmod_poly_degree(B->R1))
         {
@@ -578,3 +319,68 @@ int nmod_berlekamp_massey_reduce_modif(
 
     return 1;
 }
+
+//shift ne sert pas 
+int nmod_em_gcd(nmod_berlekamp_massey_t B, long shift){
+  slong i, queue_len, queue_lo, queue_hi;
+  queue_lo = B->npoints; // vaut 0 en entree
+  queue_hi = B->points->length; //vaut 2*dim ou dim est la dimension du quotient
+  queue_len = queue_hi - queue_lo;
+  FLINT_ASSERT(queue_len >= 0);
+  nmod_poly_zero(B->rt);
+  for (i = 0; i < queue_len; i++)
+    {
+      nmod_poly_set_coeff_ui(B->rt, queue_len - i - 1,
+                             B->points->coeffs[queue_lo + i]);
+    }
+  B->npoints = queue_hi;
+
+  //R0 vaut x^queue_len-1 avec queue_len = 2*dim - 1
+  return nmod_berlekamp_massey_reduce_queue(B, queue_len);
+}
+
+
+//shift ne sert pas 
+int nmod_em_gcd_preinstantiated(nmod_berlekamp_massey_t B, long shift){
+  slong queue_len, queue_lo, queue_hi;
+  queue_lo = B->npoints; // vaut 0 en entree
+  queue_hi = B->points->length; //vaut 2*dim ou dim est la dimension du quotient
+  queue_len = queue_hi - queue_lo + shift;
+  FLINT_ASSERT(queue_len >= 0);
+  //On a deja fait ce job de maniere appropriee avant l'appel.
+  B->npoints = queue_hi;
+
+  //R0 vaut x^queue_len-1 avec queue_len = 2*dim - 1
+  return nmod_berlekamp_massey_reduce_queue(B, queue_len);
+}
+
+
+
+
+
+
+/* return 1 if reduction changed the master poly, 0 otherwise */
+int nmod_berlekamp_massey_reduce_modif(
+    nmod_berlekamp_massey_t B)
+{
+    slong i, queue_len, queue_lo, queue_hi;
+
+    /*
+        the points in B->points->coeffs[j] for queue_lo <= j < queue_hi need
+        to be added to the internal polynomials.
+        These are first reversed into rt. deg(rt) < queue_len.
+    */
+    queue_lo = B->npoints;
+    queue_hi = B->points->length;
+    queue_len = queue_hi - queue_lo;
+    FLINT_ASSERT(queue_len >= 0);
+    nmod_poly_zero(B->rt);
+    for (i = 0; i < queue_len; i++)
+    {
+        nmod_poly_set_coeff_ui(B->rt, queue_len - i - 1,
+                                      B->points->coeffs[queue_lo + i]);
+    }
+    B->npoints = queue_hi;
+
+    return nmod_berlekamp_massey_reduce_queue(B, queue_len);
+}
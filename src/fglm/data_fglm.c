@@ -79,6 +79,19 @@ static inline fglm_data_t *allocate_fglm_data(szmat_t nrows, szmat_t ncols, szma
 }
 
 
+/* memory in bytes used by the fglm data of one prime: the multiplication
+ * matrix mat, the buffers of allocate_fglm_data() and the polynomials of
+ * allocate_fglm_bms_data() which are of length about twice the dimension
+ * of the quotient */
+static inline int64_t fglm_memory(const sp_matfglm_t *mat, szmat_t nvars){
+  const int64_t nrows = mat->nrows;
+  const int64_t ncols = mat->ncols;
+
+  return (nrows * ncols + (2 * nvars + 2) * ncols + nrows) * sizeof(CF_t)
+    + (ncols + nrows) * sizeof(szmat_t)
+    + 10 * ncols * sizeof(mp_limb_t);
+}
+
 static inline void free_fglm_data(fglm_data_t *data){
   free(data->vecinit);
   free(data->res);
@@ -173,28 +186,47 @@ static inline void free_fglm_param(param_t *param){
   free(param);
 }
 
+static inline void init_fglm_hankel_data(fglm_hankel_data_t *hk,
+                                         szmat_t dim, mp_limb_t prime){
+  nmod_poly_init(hk->A, prime);
+  nmod_poly_init(hk->B, prime);
+
+  nmod_poly_init2(hk->rZ1, prime, dim+1);
+  nmod_poly_init2(hk->rZ2, prime, dim+1);
+  nmod_poly_init2(hk->V, prime, dim+1);
+
+  nmod_poly_init2(hk->param, prime, dim+1);
+
+  for(len_t i = 0; i < dim + 1; i++){
+    hk->rZ1->coeffs[i] = 0;
+    hk->rZ2->coeffs[i] = 0;
+    hk->V->coeffs[i] = 0;
+    hk->param->coeffs[i] = 0;
+  }
+}
+
+static inline void clear_fglm_hankel_data(fglm_hankel_data_t *hk){
+  nmod_poly_clear(hk->A);
+  nmod_poly_clear(hk->B);
+  nmod_poly_clear(hk->rZ1);
+  nmod_poly_clear(hk->rZ2);
+  nmod_poly_clear(hk->V);
+  nmod_poly_clear(hk->param);
+}
+
 static inline fglm_bms_data_t *allocate_fglm_bms_data(szmat_t dim, mp_limb_t prime){
 
   fglm_bms_data_t * data_bms = (fglm_bms_data_t *)malloc(sizeof(fglm_bms_data_t));
-  nmod_poly_init(data_bms->A, prime);
 
-  nmod_poly_init(data_bms->B, prime);
   nmod_poly_init(data_bms->Z1, prime);
-
-  nmod_poly_init2(data_bms->rZ1, prime, dim+1);
-
   nmod_poly_init(data_bms->Z2, prime);
-  nmod_poly_init2(data_bms->rZ2, prime, dim+1);
-  nmod_poly_init2(data_bms->V, prime, dim+1);
-
-  nmod_poly_init2(data_bms->param, prime, dim+1);
 
-  for(len_t i = 0; i < dim + 1; i++){
-    data_bms->rZ1->coeffs[i] = 0;
-    data_bms->rZ2->coeffs[i] = 0;
-    data_bms->V->coeffs[i] = 0;
-    data_bms->param->coeffs[i] = 0;
-  }
+  /* more scratch sets are added by fglm_bms_data_fit_threads */
+  data_bms->dim = dim;
+  data_bms->mpdeg = 0;
+  data_bms->nhk = 1;
+  data_bms->hk  = (fglm_hankel_data_t *)malloc(sizeof(fglm_hankel_data_t));
+  init_fglm_hankel_data(data_bms->hk, dim, prime);
 
   nmod_berlekamp_massey_init(data_bms->BMS, (mp_limb_t)prime);
 
@@ -202,6 +234,21 @@ static inline fglm_bms_data_t *allocate_fglm_bms_data(szmat_t dim, mp_limb_t pri
   return data_bms;
 }
 
+/* ensures one set of Hankel scratch polynomials per thread */
+static inline void fglm_bms_data_fit_threads(fglm_bms_data_t *data_bms,
+                                             long nthrds){
+  if(nthrds <= data_bms->nhk){
+    return;
+  }
+  data_bms->hk = (fglm_hankel_data_t *)realloc(data_bms->hk,
+                                               nthrds * sizeof(fglm_hankel_data_t));
+  for(long i = data_bms->nhk; i < nthrds; i++){
+    init_fglm_hankel_data(data_bms->hk + i, data_bms->dim,
+                          data_bms->Z1->mod.n);
+  }
+  data_bms->nhk = nthrds;
+}
+
 static inline void nmod_poly_set_prime(nmod_poly_t poly,
                                        mp_limb_t prime){
   mp_limb_t ninv = n_preinvert_limb(prime);
@@ -228,28 +275,28 @@ static inline void fglm_param_set_prime(param_t *param, mp_limb_t prime){
 
 static inline void fglm_bms_data_set_prime(fglm_bms_data_t *data_bms,
                                            mp_limb_t prime){
-  nmod_poly_set_prime(data_bms->A, prime);
-  nmod_poly_set_prime(data_bms->B, prime);
   nmod_poly_set_prime(data_bms->Z1, prime);
-  nmod_poly_set_prime(data_bms->rZ1, prime);
   nmod_poly_set_prime(data_bms->Z2, prime);
-  nmod_poly_set_prime(data_bms->rZ2, prime);
-  nmod_poly_set_prime(data_bms->V, prime);
-  nmod_poly_set_prime(data_bms->param, prime);
+  for(long i = 0; i < data_bms->nhk; i++){
+    nmod_poly_set_prime(data_bms->hk[i].A, prime);
+    nmod_poly_set_prime(data_bms->hk[i].B, prime);
+    nmod_poly_set_prime(data_bms->hk[i].rZ1, prime);
+    nmod_poly_set_prime(data_bms->hk[i].rZ2, prime);
+    nmod_poly_set_prime(data_bms->hk[i].V, prime);
+    nmod_poly_set_prime(data_bms->hk[i].param, prime);
+  }
 
   nmod_berlekamp_massey_set_prime(data_bms->BMS, prime);
 
 }
 
 static inline void free_fglm_bms_data(fglm_bms_data_t *data_bms){
-  nmod_poly_clear(data_bms->A);
-  nmod_poly_clear(data_bms->B);
   nmod_poly_clear(data_bms->Z1);
   nmod_poly_clear(data_bms->Z2);
-  nmod_poly_clear(data_bms->rZ1);
-  nmod_poly_clear(data_bms->rZ2);
-  nmod_poly_clear(data_bms->V);
-  nmod_poly_clear(data_bms->param);
+  for(long i = 0; i < data_bms->nhk; i++){
+    clear_fglm_hankel_data(data_bms->hk + i);
+  }
+  free(data_bms->hk);
   nmod_poly_factor_clear(data_bms->sqf);
 
   nmod_berlekamp_massey_clear(data_bms->BMS);
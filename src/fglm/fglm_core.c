@@ -40,6 +40,9 @@ double omp_get_wtime(void) { return realtime();}
 
 #define DEBUGFGLM 0
 #define BLOCKWIED 0
+/* extra terms used beyond twice the expected degree of the minimal
+ * polynomial when the Krylov sequence is truncated */
+#define KRYLOV_EXTRA_TERMS 8
 
 #include <flint/nmod_poly.h>
 
@@ -390,56 +393,59 @@ static inline void solveHankel(nmod_poly_t param,
 /*
  Z1 and Z2 must be arrays of length d + 1
  Mirroring them will give an array of length d + 1
+ Z1 and Z2 are only read, all other polynomials are taken from hk, so
+ several coordinates can be solved in parallel.
  */
 
-static inline void solve_hankel(fglm_bms_data_t *data_bms, 
+static inline void solve_hankel(fglm_bms_data_t *data_bms,
+                                fglm_hankel_data_t *hk,
                                 szmat_t dimquot,
                                 szmat_t dim,
                                 szmat_t block_size,
                                 CF_t *res,
                                 int ncoord){
-  data_bms->V->length = dim;
+  hk->V->length = dim;
 
   for(szmat_t i = 0; i < dim; i++){
-    data_bms->V->coeffs[i] = res[ncoord-1+i*(block_size)];
+    hk->V->coeffs[i] = res[ncoord-1+i*(block_size)];
   }
 
   #if DEBUGFGLM > 0
   fprintf(stdout, "\n ncoord = %d\n", ncoord);
   fprintf(stdout, "V = ");
-  nmod_poly_fprint_pretty(stdout, data_bms->V, "x");
+  nmod_poly_fprint_pretty(stdout, hk->V, "x");
   fprintf(stdout, "\n");
   #endif
 
-  mirror_poly_inplace(data_bms->V);
-  mirror_poly_solve(data_bms->rZ1, data_bms->Z1, dim + 1);
-  mirror_poly_solve(data_bms->rZ2, data_bms->Z2, dim + 1);
+  mirror_poly_inplace(hk->V);
+  mirror_poly_solve(hk->rZ1, data_bms->Z1, dim + 1);
+  mirror_poly_solve(hk->rZ2, data_bms->Z2, dim + 1);
 
-  nmod_poly_mullow(data_bms->A, data_bms->rZ1, data_bms->V, dim); // mod t^dim
-  nmod_poly_mullow(data_bms->B, data_bms->Z2, data_bms->V, dim); // mod t^dim
+  nmod_poly_mullow(hk->A, hk->rZ1, hk->V, dim); // mod t^dim
+  nmod_poly_mullow(hk->B, data_bms->Z2, hk->V, dim); // mod t^dim
 
-  mirror_poly_solve(data_bms->rZ1, data_bms->B, dim); 
+  mirror_poly_solve(hk->rZ1, hk->B, dim); 
 
   for(szmat_t i = 0; i < dim ; i++){
-    data_bms->B->coeffs[i] = data_bms->rZ1->coeffs[i];
+    hk->B->coeffs[i] = hk->rZ1->coeffs[i];
   }
-  data_bms->B->length = data_bms->rZ1->length;
-  mirror_poly_solve(data_bms->rZ1, data_bms->A, dim); 
+  hk->B->length = hk->rZ1->length;
+  mirror_poly_solve(hk->rZ1, hk->A, dim); 
   for(szmat_t i = 0; i < dim ; i++){
-    data_bms->A->coeffs[i] = data_bms->rZ1->coeffs[i];
+    hk->A->coeffs[i] = hk->rZ1->coeffs[i];
   }
-  data_bms->A->length = data_bms->rZ1->length;
+  hk->A->length = hk->rZ1->length;
 
-  nmod_poly_mullow(data_bms->rZ1, data_bms->Z1, data_bms->B, dim);
-  nmod_poly_mullow(data_bms->rZ2, data_bms->rZ2, data_bms->A, dim);
+  nmod_poly_mullow(hk->rZ1, data_bms->Z1, hk->B, dim);
+  nmod_poly_mullow(hk->rZ2, hk->rZ2, hk->A, dim);
 
-  nmod_poly_neg(data_bms->rZ2, data_bms->rZ2);
+  nmod_poly_neg(hk->rZ2, hk->rZ2);
 
-  nmod_poly_add(data_bms->param, data_bms->rZ1, data_bms->rZ2);
+  nmod_poly_add(hk->param, hk->rZ1, hk->rZ2);
 
   mp_limb_t inv = n_invmod(data_bms->Z1->coeffs[0], (data_bms->Z1->mod).n);
 
-  nmod_poly_scalar_mul_nmod(data_bms->param, data_bms->param, inv);
+  nmod_poly_scalar_mul_nmod(hk->param, hk->param, inv);
 
 }
 
@@ -470,14 +476,9 @@ static inline void sparse_mat_fglm_mult_vec(CF_t *res, sp_matfglm_t *mat,
   for(szmat_t i = 0; i < ntriv; i++){
     res[mat->triv_idx[i]] = vec[mat->triv_pos[i]];
   }
-#ifdef HAVE_AVX2
-  _8mul_matrix_vector_product(vres, mat->dense_mat, vec, mat->dst,
+  dense_matrix_vector_product(vres, mat->dense_mat, vec, mat->dst,
                               ncols, nrows, prime, RED_32, RED_64,
-			      preinv,st);
-#else
-  non_avx_matrix_vector_product(vres, mat->dense_mat, vec,
-				ncols, nrows, prime, RED_32, RED_64,st);
-#endif
+                              preinv, st);
   /* non_avx_matrix_vector_product(vres, mat->dense_mat, vec, */
   /*                               ncols, nrows, prime, RED_32, RED_64,st); */
     for(szmat_t i = 0; i < nrows; i++){
@@ -520,17 +521,9 @@ static inline void sparse_mat_fglm_colon_mult_vec(CF_t *res, sp_matfglmcol_t *ma
   }
   /* printf ("zero\n"); */
   /* printf("ncols %u\n", ncols); */
-#ifdef HAVE_AVX2
-  /* matrix_vector_product(vres, mat->dense_mat, vec, ncols, nrows, prime, RED_32, RED_64); */
-  _8mul_matrix_vector_product(vres, mat->dense_mat, vec, mat->dst,
+  dense_matrix_vector_product(vres, mat->dense_mat, vec, mat->dst,
                               ncols, nrows, prime, RED_32, RED_64,
-			      preinv,st);
-  /* printf ("mul AVX\n"); */
-#else
-  non_avx_matrix_vector_product(vres, mat->dense_mat, vec,
-				ncols, nrows, prime, RED_32, RED_64,st);
-  /* printf ("mul non AVX\n"); */
-#endif
+                              preinv, st);
     for(szmat_t i = 0; i < nrows; i++){
       res[mat->dense_idx[i]] = vres[i];
     }
@@ -690,8 +683,8 @@ static void generate_matrix_sequence(sp_matfglm_t *matxn, fglm_data_t * data,
     Rmat[i] = 0;
   }
   for(szmat_t i = 0; i < matxn->ncols; i++){
-    Rmat[i] = (CF_t)rand() % prime;
-    Rmat[i] += (CF_t)rand() % prime;
+    Rmat[i] = (CF_t)random_number() % prime;
+    Rmat[i] += (CF_t)random_number() % prime;
   }
 
   /* allocates result matrix (matxn * Rmat) */
@@ -725,13 +718,19 @@ static void generate_matrix_sequence(sp_matfglm_t *matxn, fglm_data_t * data,
 
 }
 
-static void generate_sequence_verif(sp_matfglm_t *matrix, fglm_data_t * data,
-                                    szmat_t block_size, szmat_t dimquot,
-                                    nvars_t* squvars,
-                                    nvars_t* linvars,
-                                    nvars_t nvars,
-                                    mod_t prime,
-                                    md_t *st){
+/* computes the terms start, ..., end-1 of the sequences; when start > 0,
+ * data->vecinit must hold the Krylov vector of the term start-1, which is
+ * the case after a previous call ending at start */
+static void generate_sequence_verif_terms(sp_matfglm_t *matrix,
+                                          fglm_data_t * data,
+                                          szmat_t block_size,
+                                          nvars_t* squvars,
+                                          nvars_t* linvars,
+                                          nvars_t nvars,
+                                          mod_t prime,
+                                          szmat_t start,
+                                          szmat_t end,
+                                          md_t *st){
   uint32_t RED_32 = ((uint64_t)2<<31) % prime;
 
   uint32_t RED_64 = ((uint64_t)1<<63) % prime;
@@ -741,48 +740,18 @@ static void generate_sequence_verif(sp_matfglm_t *matrix, fglm_data_t * data,
   uint32_t pi1 = ((uint64_t)pow(2, 32)) / RED_64;
   uint32_t pi2 = (uint64_t)pow(2, 32) / RED_32;
   int dec= 0;
-  for(szmat_t j = 1; j < block_size; j++){
-    while (nvars-1-j-dec > 0 && linvars[nvars-1-j-dec] != 0) {
-      dec++;
-    }
-    data->res[j+matrix->ncols*block_size]
-      = data->vecinit[squvars[nvars-1-j-dec]];
-  }
-  for(szmat_t i = 1; i < matrix->ncols; i++){
-    sparse_mat_fglm_mult_vec(data->vvec, matrix,
-                             data->vecinit, data->vecmult,
-                             prime, RED_32, RED_64, preinv, pi1, pi2,
-			     st);
-#if DEBUGFGLM > 1
-    print_vec(stderr, data->vvec, matrix->ncols);
-#endif
-
-
-    CF_t *tmp = data->vecinit;
-    data->vecinit = data->vvec;
-    data->vvec = tmp;
-    data->res[i*block_size] = data->vecinit[0];
-
-    dec = 0;
+  const szmat_t first = start;
+  if(start == 0){
     for(szmat_t j = 1; j < block_size; j++){
-      data->res[j+i*block_size] = data->vecinit[j+1];
-      while (linvars[nvars-1-j-dec] != 0) {
+      while (nvars-1-j-dec > 0 && linvars[nvars-1-j-dec] != 0) {
         dec++;
       }
-      data->res[j+(i+matrix->ncols)*block_size]
+      data->res[j+matrix->ncols*block_size]
         = data->vecinit[squvars[nvars-1-j-dec]];
     }
-
-#if DEBUGFGLM > 1
-    print_vec(stdout, data->res, 2*block_size * matrix->ncols);
-#endif
-
-#if DEBUGFGLM > 2
-    fprintf(stderr, "res = ");
-    print_vec(stdout, data->res+i*matrix->ncols, matrix->ncols);
-#endif
+    start = 1;
   }
-  for(szmat_t i = matrix->ncols; i < 2*matrix->ncols; i++){
+  for(szmat_t i = start; i < end; i++){
     sparse_mat_fglm_mult_vec(data->vvec, matrix,
                              data->vecinit, data->vecmult,
                              prime, RED_32, RED_64, preinv, pi1, pi2,
@@ -797,6 +766,19 @@ static void generate_sequence_verif(sp_matfglm_t *matrix, fglm_data_t * data,
     data->vvec = tmp;
     data->res[i*block_size] = data->vecinit[0];
 
+    /* the coordinate sequences only need the first ncols terms */
+    if(i < matrix->ncols){
+      dec = 0;
+      for(szmat_t j = 1; j < block_size; j++){
+        data->res[j+i*block_size] = data->vecinit[j+1];
+        while (linvars[nvars-1-j-dec] != 0) {
+          dec++;
+        }
+        data->res[j+(i+matrix->ncols)*block_size]
+          = data->vecinit[squvars[nvars-1-j-dec]];
+      }
+    }
+
 #if DEBUGFGLM > 1
     print_vec(stdout, data->res, 2*block_size * matrix->ncols);
 #endif
@@ -809,12 +791,23 @@ static void generate_sequence_verif(sp_matfglm_t *matrix, fglm_data_t * data,
 
   /* now res contains our generating sequence */
 
-  for(ulong i = 0; i < 2 * dimquot; i++){
+  for(szmat_t i = first; i < end; i++){
     data->pts[i] = data->res[i*block_size];
   }
 
 }
 
+static void generate_sequence_verif(sp_matfglm_t *matrix, fglm_data_t * data,
+                                    szmat_t block_size, szmat_t dimquot,
+                                    nvars_t* squvars,
+                                    nvars_t* linvars,
+                                    nvars_t nvars,
+                                    mod_t prime,
+                                    md_t *st){
+  generate_sequence_verif_terms(matrix, data, block_size, squvars, linvars,
+                                nvars, prime, 0, 2*dimquot, st);
+}
+
 
 
 static inline void compute_elim_poly(fglm_data_t *data,
@@ -822,7 +815,8 @@ static inline void compute_elim_poly(fglm_data_t *data,
                                      long dimquot){
     nmod_berlekamp_massey_add_points(data_bms->BMS, data->pts, 2*dimquot);
 
-    nmod_berlekamp_massey_reduce(data_bms->BMS);
+    /* uses half-gcd above the crossover set in berlekamp_massey.c */
+    nmod_berlekamp_massey_reduce_modif(data_bms->BMS);
     nmod_poly_make_monic(data_bms->BMS->V1, data_bms->BMS->V1);
 }
 
@@ -896,22 +890,30 @@ static inline long make_square_free_elim_poly_colon(param_t *param,
 }
 
 
+/* the sequence stored in data->pts has 2 * seqlen terms */
 static inline void compute_minpoly(param_t *param,
                                    fglm_data_t *data,
                                    fglm_bms_data_t *data_bms,
                                    long dimquot,
+                                   long seqlen,
                                    nvars_t *linvars,
                                    uint32_t *lineqs,
                                    long nvars,
                                    long *dim,
                                    int info_level){
-  compute_elim_poly(data, data_bms, dimquot);
+  double rt = realtime();
+  compute_elim_poly(data, data_bms, seqlen);
+  if(info_level){
+    fprintf(stderr, "Berlekamp-Massey on %ld terms (elapsed): %.2f sec\n",
+            2*seqlen, realtime()-rt);
+  }
   if(data_bms->BMS->V1->length == 1){
     nmod_poly_fit_length(data_bms->BMS->V1, 2);
     data_bms->BMS->V1->length = 2;
     data_bms->BMS->V1->coeffs[0] = 0;
     data_bms->BMS->V1->coeffs[1] = 1;
   }
+  data_bms->mpdeg = data_bms->BMS->V1->length - 1;
   *dim = make_square_free_elim_poly(param, data_bms, dimquot, info_level);
 
 }
@@ -1011,7 +1013,8 @@ static int compute_parametrizations(param_t *param,
                                     szmat_t nlins,
                                     nvars_t *linvars,
                                     uint32_t *lineqs,
-                                    szmat_t nvars){
+                                    szmat_t nvars,
+                                    const int nthrds){
 
   nmod_poly_one(param->denom);
 
@@ -1027,23 +1030,14 @@ static int compute_parametrizations(param_t *param,
   if(b){
 
     szmat_t dec = 0;
+    /* position of the coordinate's sequence in data->res, 0 for coordinates
+     * given by linear forms */
+    int *ncoord = calloc(nvars, sizeof(int));
 
     for(nvars_t nc = 0; nc < nvars - 1 ; nc++){
 
       if(linvars[nvars - 2- nc] == 0){
-        solve_hankel(data_bms, dimquot, dim, block_size, data->res,
-                     nc + 2 - dec);
-
-        nmod_poly_neg(data_bms->param, data_bms->param);
-        nmod_poly_reverse(param->coords[nvars-2-nc], data_bms->param, dim);
-        nmod_poly_rem(param->coords[nvars-2-nc], param->coords[nvars-2-nc],
-                      param->elim);
-
-#if DEBUGFGLM > 0
-        nmod_poly_fprint_pretty(stdout, param->coords[nvars-2-nc], "X");
-        fprintf(stdout, "\n");
-#endif
-
+        ncoord[nc] = nc + 2 - dec;
       }
       else{
         if(param->coords[nvars-2-nc]->alloc <  param->elim->alloc - 1){
@@ -1060,6 +1054,31 @@ static int compute_parametrizations(param_t *param,
       }
     }
 
+    /* once the Hankel matrix is inverted the coordinates are independent */
+    fglm_bms_data_fit_threads(data_bms, nthrds);
+    nvars_t nc;
+#pragma omp parallel for num_threads(nthrds) private(nc) schedule(dynamic)
+    for(nc = 0; nc < nvars - 1 ; nc++){
+      if(ncoord[nc] > 0){
+        fglm_hankel_data_t *hk = data_bms->hk + omp_get_thread_num();
+        solve_hankel(data_bms, hk, dimquot, dim, block_size, data->res,
+                     ncoord[nc]);
+
+        nmod_poly_neg(hk->param, hk->param);
+        nmod_poly_reverse(param->coords[nvars-2-nc], hk->param, dim);
+        nmod_poly_rem(param->coords[nvars-2-nc], param->coords[nvars-2-nc],
+                      param->elim);
+      }
+    }
+    free(ncoord);
+
+#if DEBUGFGLM > 0
+    for(nc = 0; nc < nvars - 1 ; nc++){
+      nmod_poly_fprint_pretty(stdout, param->coords[nvars-2-nc], "X");
+      fprintf(stdout, "\n");
+    }
+#endif
+
     set_param_linear_vars(param, nlins, linvars, lineqs, nvars);
 
 #if DEBUGFGLM > 0
@@ -1115,6 +1134,7 @@ static inline int invert_table_polynomial (param_t *param,
 }
 
 
+/* r0 and r1 are scratch polynomials, the result is stored in r1 */
 static inline void divide_table_polynomials (param_t *param,
 					     fglm_data_t *data,
 					     fglm_bms_data_t *data_bms,
@@ -1122,30 +1142,32 @@ static inline void divide_table_polynomials (param_t *param,
 					     szmat_t block_size,
 					     mod_t prime,
 					     int ncoord,
-					     uint64_t lambda) {
+					     uint64_t lambda,
+					     nmod_poly_t r0,
+					     nmod_poly_t r1) {
 
   szmat_t length= data_bms->BMS->V1->length-1;
-  nmod_poly_zero (data_bms->BMS->R0);
-  nmod_poly_fit_length(data_bms->BMS->R0, length);
+  nmod_poly_zero (r0);
+  nmod_poly_fit_length(r0, length);
 
   for (long i = 0; i < length; i++){
     if (lambda == 0) {
-      nmod_poly_set_coeff_ui (data_bms->BMS->R0,i,
+      nmod_poly_set_coeff_ui (r0,i,
 			      data->res[(length-i-1)*block_size+ncoord]);
 
     }
     else {
       uint64_t coeff= (lambda*data->res[(length-i-1)*block_size+ncoord]) % prime;
       coeff= (data->res[(dimquot+length-i-1)*block_size+ncoord] + coeff) % prime;
-      nmod_poly_set_coeff_ui (data_bms->BMS->R0,i,
+      nmod_poly_set_coeff_ui (r0,i,
 			      coeff);
     }
   }
 
-  nmod_poly_mul (data_bms->BMS->R1,data_bms->BMS->R0,data_bms->BMS->V1);
-  nmod_poly_shift_right (data_bms->BMS->R1,data_bms->BMS->R1,length);
-  nmod_poly_mul (data_bms->BMS->R1,data_bms->BMS->R1,data_bms->Z2);
-  nmod_poly_rem (data_bms->BMS->R1,data_bms->BMS->R1,param->elim);
+  nmod_poly_mul (r1,r0,data_bms->BMS->V1);
+  nmod_poly_shift_right (r1,r1,length);
+  nmod_poly_mul (r1,r1,data_bms->Z2);
+  nmod_poly_rem (r1,r1,param->elim);
 
 }
 
@@ -1199,7 +1221,8 @@ int compute_parametrizations_non_shape_position_case(param_t *param,
                                                      nvars_t *squvars,
                                                      long nvars,
                                                      mod_t prime,
-                                                     int verif){
+                                                     int verif,
+                                                     const int nthrds){
   int nr_fail_param=-1;
   if (invert_table_polynomial (param, data, data_bms, dimquot, block_size,
                                prime, 0, 0)) {
@@ -1210,28 +1233,14 @@ int compute_parametrizations_non_shape_position_case(param_t *param,
     nmod_poly_fprint_pretty (stdout, data_bms->Z2, "x"); fprintf (stdout,"\n");
 #endif
     long dec = 0;
+    /* position of the coordinate's sequence in data->res, 0 for coordinates
+     * given by linear forms */
+    long *ncoord = calloc(nvars, sizeof(long));
 
     for(long nc = 0; nc < nvars - 1 ; nc++){
 
       if(linvars[nvars - 2 - nc] == 0){
-        divide_table_polynomials(param,data,data_bms, dimquot, block_size, prime,
-                                 nc + 1-dec,0);
-        if(data_bms->BMS->R1->length>0){
-          nmod_poly_neg(param->coords[nvars-2-nc], data_bms->BMS->R1); 
-        }
-        else{
-          nmod_poly_fit_length(param->coords[nvars-2-nc],
-                               param->elim->length-1 );
-          param->coords[nvars-2-nc]->length = data_bms->BMS->R1->length ;
-          param->coords[nvars-2-nc]->coeffs[0] = 0;
-          param->coords[nvars-2-nc]->coeffs[1] = 0;
-
-        }
-
-#if DEBUGFGLM > 0
-        nmod_poly_fprint_pretty(stdout, param->coords[nvars-2-nc], "X");
-        fprintf(stdout, "\n");
-#endif
+        ncoord[nc] = nc + 1 - dec;
       }
       else{
         dec++;
@@ -1249,6 +1258,39 @@ int compute_parametrizations_non_shape_position_case(param_t *param,
       }
     }
 
+    /* the coordinates only share the inverse of the first table
+     * polynomial, they are computed in parallel using the Hankel scratch
+     * polynomials of each thread */
+    fglm_bms_data_fit_threads(data_bms, nthrds);
+    long nc;
+#pragma omp parallel for num_threads(nthrds) private(nc) schedule(dynamic)
+    for(nc = 0; nc < nvars - 1 ; nc++){
+      if(ncoord[nc] > 0){
+        fglm_hankel_data_t *hk = data_bms->hk + omp_get_thread_num();
+        divide_table_polynomials(param,data,data_bms, dimquot, block_size, prime,
+                                 ncoord[nc],0, hk->A, hk->B);
+        if(hk->B->length>0){
+          nmod_poly_neg(param->coords[nvars-2-nc], hk->B);
+        }
+        else{
+          nmod_poly_fit_length(param->coords[nvars-2-nc],
+                               param->elim->length-1 );
+          param->coords[nvars-2-nc]->length = hk->B->length ;
+          param->coords[nvars-2-nc]->coeffs[0] = 0;
+          param->coords[nvars-2-nc]->coeffs[1] = 0;
+
+        }
+      }
+    }
+    free(ncoord);
+
+#if DEBUGFGLM > 0
+    for(nc = 0; nc < nvars - 1 ; nc++){
+      nmod_poly_fprint_pretty(stdout, param->coords[nvars-2-nc], "X");
+      fprintf(stdout, "\n");
+    }
+#endif
+
     /* parametrizations verification */
     if (verif) {
       dec = 0;
@@ -1257,7 +1299,7 @@ int compute_parametrizations_non_shape_position_case(param_t *param,
         if(linvars[nvars - 2 - nc] == 0
            && squvars[nvars - 2 - nc] != 0){
 
-          uint64_t lambda= 1 + ((uint64_t) rand() % (prime-1));
+          uint64_t lambda= 1 + ((uint64_t) random_number() % (prime-1));
           /* needed for verification */
 
           invert_table_polynomial (param, data, data_bms, dimquot, block_size,
@@ -1270,7 +1312,8 @@ int compute_parametrizations_non_shape_position_case(param_t *param,
 #endif
 
           divide_table_polynomials(param,data,data_bms, dimquot, block_size,
-                                   prime, nc+1-dec,lambda);
+                                   prime, nc+1-dec,lambda,
+                                   data_bms->BMS->R0, data_bms->BMS->R1);
           nmod_poly_neg(data_bms->BMS->R1, data_bms->BMS->R1);
 
 #if DEBUGFGLM > 1
@@ -1365,7 +1408,7 @@ static int compute_parametrizations_colon(param_t *param,
         if(linvars[nvars - 2 - nc] == 0
            && squvars[nvars - 2 - nc] != 0){
 
-          uint64_t lambda= 1 + ((uint64_t) rand() % (prime-1));
+          uint64_t lambda= 1 + ((uint64_t) random_number() % (prime-1));
           /* needed for verification */
 
           invert_table_polynomial (param, data, data_bms, dimquot, block_size,
@@ -1431,9 +1474,8 @@ static inline long initialize_fglm_data(sp_matfglm_t *matrix,
     if(matrix->dense_mat[i]==0)
       nb++;
   }
-  srand(time(0));
   for(szmat_t i = 0; i < matrix->ncols; i++){
-    data->vecinit[i] = (CF_t)rand() % prime;
+    data->vecinit[i] = (CF_t)random_number() % prime;
   }
   data->res[0] = data->vecinit[0];
   for(szmat_t i = 1; i < block_size; i++){
@@ -1452,10 +1494,9 @@ static inline long initialize_fglm_colon_data(sp_matfglmcol_t *matrix,
     if(matrix->dense_mat[i]==0)
       nb++;
   }
-  srand(time(0));
   for(szmat_t i = 0; i < matrix->ncols; i++){
-    data->vecinit[i] = (CF_t)rand() % prime;
-    data->vecinit[i] += (CF_t)rand() % prime;
+    data->vecinit[i] = (CF_t)random_number() % prime;
+    data->vecinit[i] += (CF_t)random_number() % prime;
     /* data->vecinit[i] = (CF_t)(i+1) % prime; */
   }
   data->res[0] = data->vecinit[0];
@@ -1537,8 +1578,7 @@ param_t *nmod_fglm_compute(sp_matfglm_t *matrix, const mod_t prime, const nvars_
   // for the moment, let's take random coefficients
   flint_rand_t state;
   flint_randinit(state);
-  srand(time(0));
-  flint_randseed(state, rand(), rand());
+  flint_randseed(state, random_number(), random_number());
   for (slong k = 0; k < 2*glen; k++)
   {
     mp_ptr vec = (matp->coeffs + k)->entries;
@@ -1589,7 +1629,7 @@ param_t *nmod_fglm_compute(sp_matfglm_t *matrix, const mod_t prime, const nvars_
   fglm_bms_data_t *data_bms = allocate_fglm_bms_data(dimquot, prime);
 
   long dim = 0;
-  compute_minpoly(param, data, data_bms, dimquot, linvars, lineqs, nvars, &dim,
+  compute_minpoly(param, data, data_bms, dimquot, dimquot, linvars, lineqs, nvars, &dim,
                   info_level);
 
   if(info_level){
@@ -1608,7 +1648,7 @@ param_t *nmod_fglm_compute(sp_matfglm_t *matrix, const mod_t prime, const nvars_
     if(compute_parametrizations(param, data, data_bms,
                                 dim, dimquot, block_size,
                                 nlins, linvars, lineqs,
-                                nvars) == 0){
+                                nvars, st->nthrds) == 0){
 
       fprintf(stderr, "Matrix is not invertible (there should be a bug)\n");
       free_fglm_bms_data(data_bms);
@@ -1629,7 +1669,8 @@ param_t *nmod_fglm_compute(sp_matfglm_t *matrix, const mod_t prime, const nvars_
 								      nlins, linvars,
 								      lineqs, squvars,
 								      nvars, prime,
-								      1); /* verif */
+								      1, /* verif */
+								      st->nthrds);
     if (right_param == 0) {
       fprintf(stderr, "Matrix is not invertible (there should be a bug)\n");
       free_fglm_bms_data(data_bms);
@@ -1731,7 +1772,7 @@ param_t *nmod_fglm_compute_trace_data(sp_matfglm_t *matrix, mod_t prime,
   *bdata_bms = allocate_fglm_bms_data(dimquot, prime);
 
   long dim = 0;
-  compute_minpoly(param, *bdata, *bdata_bms, dimquot, linvars, lineqs,
+  compute_minpoly(param, *bdata, *bdata_bms, dimquot, dimquot, linvars, lineqs,
                   nvars, &dim, info_level);
 
   if(info_level){
@@ -1749,7 +1790,7 @@ param_t *nmod_fglm_compute_trace_data(sp_matfglm_t *matrix, mod_t prime,
     if(compute_parametrizations(param, *bdata, *bdata_bms,
                                 dim, dimquot, block_size,
                                 nlins, linvars, lineqs,
-                                nvars) == 0){
+                                nvars, st->nthrds) == 0){
 
       fprintf(stderr, "Matrix is not invertible (there should be a bug)\n");
       return NULL;
@@ -1772,7 +1813,8 @@ param_t *nmod_fglm_compute_trace_data(sp_matfglm_t *matrix, mod_t prime,
                                                                       lineqs,
                                                                       squvars,
                                                                       nvars, prime,
-                                                                      1); /* verif */
+                                                                      1, /* verif */
+                                                                      st->nthrds);
 
     if (right_param == 0) {
       if(info_level){
@@ -1808,6 +1850,11 @@ param_t *nmod_fglm_compute_trace_data(sp_matfglm_t *matrix, mod_t prime,
 
   Renvoie 0 si le calcul est correct ; si non on renvoie 1
 
+  Si mpdeg > 0, c'est le degre du polynome minimal obtenu au premier
+  premier : on ne calcule alors que 2 * (mpdeg + KRYLOV_EXTRA_TERMS) termes
+  de la suite, et on complete la suite si le degre du polynome minimal
+  differe.
+
  */
 int nmod_fglm_compute_apply_trace_data(sp_matfglm_t *matrix,
                                        const mod_t prime,
@@ -1821,6 +1868,7 @@ int nmod_fglm_compute_apply_trace_data(sp_matfglm_t *matrix,
                                        fglm_data_t *data_fglm,
                                        fglm_bms_data_t *data_bms,
                                        const long deg_init,
+                                       const long mpdeg,
                                        const int info_level,
 				       md_t *st){
 #if DEBUGFGLM > 0
@@ -1869,13 +1917,21 @@ int nmod_fglm_compute_apply_trace_data(sp_matfglm_t *matrix,
 
   //////////////////////////////////////////////////////////////////
 
+  /* the coordinate sequences only use the first mpdeg terms, hence
+   * the sequence can be truncated when the degree of the minimal
+   * polynomial is known */
+  long seqlen = dimquot;
+  if(mpdeg > 0 && mpdeg + KRYLOV_EXTRA_TERMS < dimquot){
+    seqlen = mpdeg + KRYLOV_EXTRA_TERMS;
+  }
   /* generate_sequence(matrix, data_fglm, block_size, dimquot, prime, st); */
-  generate_sequence_verif(matrix, data_fglm, block_size, dimquot,
-                          squvars, linvars, nvars, prime, st);
+  generate_sequence_verif_terms(matrix, data_fglm, block_size,
+                                squvars, linvars, nvars, prime,
+                                0, 2*seqlen, st);
   //////////////////////////////////////////////////////////////////
 
   if(info_level){
-    double nops = 2 * (matrix->nrows/ 1000.0) * (matrix->ncols / 1000.0)  * (matrix->ncols / 1000.0);
+    double nops = 2 * (matrix->nrows/ 1000.0) * (matrix->ncols / 1000.0)  * (seqlen / 1000.0);
     double rt_fglm = realtime()-st_fglm;
     fprintf(stderr, "Time spent to generate sequence (elapsed): %.2f sec (%.2f Gops/sec)\n", rt_fglm, nops / rt_fglm);
   }
@@ -1885,8 +1941,23 @@ int nmod_fglm_compute_apply_trace_data(sp_matfglm_t *matrix,
   fglm_bms_data_set_prime(data_bms, prime);
 
   long dim = 0;
-  compute_minpoly(param, data_fglm, data_bms, dimquot, linvars, lineqs, nvars, &dim,
-                  info_level);
+  compute_minpoly(param, data_fglm, data_bms, dimquot, seqlen,
+                  linvars, lineqs, nvars, &dim, info_level);
+
+  if(seqlen < dimquot && data_bms->mpdeg != mpdeg){
+    /* the truncated sequence did not give the expected minimal
+     * polynomial, the remaining terms are computed */
+    if(info_level){
+      fprintf(stderr, "Degree of minimal polynomial = %ld, ", data_bms->mpdeg);
+      fprintf(stderr, "completing the sequence\n");
+    }
+    generate_sequence_verif_terms(matrix, data_fglm, block_size,
+                                  squvars, linvars, nvars, prime,
+                                  2*seqlen, 2*dimquot, st);
+    fglm_bms_data_set_prime(data_bms, prime);
+    compute_minpoly(param, data_fglm, data_bms, dimquot, dimquot,
+                    linvars, lineqs, nvars, &dim, info_level);
+  }
 
   if(info_level){
     fprintf(stderr, "Time spent to compute eliminating polynomial (elapsed): %.2f sec\n",
@@ -1902,7 +1973,7 @@ int nmod_fglm_compute_apply_trace_data(sp_matfglm_t *matrix,
     if(compute_parametrizations(param, data_fglm, data_bms,
 				dim, dimquot, block_size,
 				nlins, linvars, lineqs,
-				nvars) == 0){
+				nvars, st->nthrds) == 0){
 
       fprintf(stderr, "Matrix is not invertible (there should be a bug)\n");
       exit(1);
@@ -1919,7 +1990,7 @@ int nmod_fglm_compute_apply_trace_data(sp_matfglm_t *matrix,
                                                      lineqs,
                                                      squvars,
                                                      nvars, prime,
-                                                     1);
+                                                     1, st->nthrds);
   }
   return 0;
 }
@@ -22,7 +22,7 @@
 #include <stdint.h>
 #include <string.h>
 
-#ifdef HAVE_AVX2
+#if defined HAVE_AVX2 || defined SIMD_DISPATCH
 #include <immintrin.h>
 
 #define AVX2LOAD(A) _mm256_load_si256((__m256i*)(A))
@@ -230,8 +230,8 @@ static inline void non_avx_matrix_vector_product(uint32_t* vec_res, const uint32
     }
 }
 
-#ifdef HAVE_AVX2
-static inline void matrix_vector_product(uint32_t* vec_res, const uint32_t* mat,
+#if defined HAVE_AVX2 || defined SIMD_DISPATCH
+TARGET_AVX2 static inline void matrix_vector_product(uint32_t* vec_res, const uint32_t* mat,
                                          const uint32_t* vec, const uint32_t ncols,
                                          const uint32_t nrows, const uint32_t PRIME,
                                          const uint32_t RED_32, const uint32_t RED_64)
@@ -353,7 +353,7 @@ static inline void matrix_vector_product(uint32_t* vec_res, const uint32_t* mat,
 }
 
 
-static inline void _2mul_new_matrix_vector_product(uint32_t* vec_res, const uint32_t* mat,
+TARGET_AVX2 static inline void _2mul_new_matrix_vector_product(uint32_t* vec_res, const uint32_t* mat,
                                          const uint32_t* vec, const uint32_t ncols,
                                          const uint32_t nrows, const uint32_t PRIME,
                                          const uint32_t RED_32, const uint32_t RED_64)
@@ -475,7 +475,7 @@ static inline void _2mul_new_matrix_vector_product(uint32_t* vec_res, const uint
     }
 }
 
-static inline void _4mul_new_matrix_vector_product(uint32_t* vec_res, const uint32_t* mat,
+TARGET_AVX2 static inline void _4mul_new_matrix_vector_product(uint32_t* vec_res, const uint32_t* mat,
                                          const uint32_t* vec, const uint32_t ncols,
                                          const uint32_t nrows, const uint32_t PRIME,
                                          const uint32_t RED_32, const uint32_t RED_64)
@@ -617,13 +617,15 @@ static inline void _4mul_new_matrix_vector_product(uint32_t* vec_res, const uint
         ++vec_res;
     }
 }
+#endif
 
 
+#if defined HAVE_AVX2 || defined SIMD_DISPATCH
 /**
 AVX2-based matrix vector product
 **/
 
-static inline void _8mul_matrix_vector_product(uint32_t* vec_res,
+TARGET_AVX2 static void _8mul_matrix_vector_product(uint32_t* vec_res,
                                                const uint32_t* mat,
                                                const uint32_t* vec,
                                                const uint32_t *dst,
@@ -777,3 +779,146 @@ static inline void _8mul_matrix_vector_product(uint32_t* vec_res,
     }
 }
 #endif
+
+#if defined SIMD_DISPATCH
+/**
+AVX-512 variant of _8mul_matrix_vector_product: one 512-bit load covers
+sixteen coefficients, so each 32-coefficient chunk takes two loads.
+**/
+
+TARGET_AVX512 static void _16mul_matrix_vector_product(uint32_t* vec_res,
+                                                 const uint32_t* mat,
+                                                 const uint32_t* vec,
+                                                 const uint32_t *dst,
+                                                 const uint32_t ncols,
+                                                 const uint32_t nrows,
+                                                 const uint32_t PRIME,
+                                                 const uint32_t RED_32,
+                                                 const uint32_t RED_64,
+                                                 const uint32_t preinv,
+                                                 md_t *st){
+    //mask pour recuperer les parties basses
+    const __m512i mask = _mm512_set1_epi64(MONE32);
+    const long quo0 = LENGTHQ8(ncols);
+    const long rem0 = LENGTHR8(ncols);
+
+#pragma omp parallel num_threads (st->nthrds)
+    {
+      unsigned int i,j;
+      uint64_t acc8x64[16] __attribute__((aligned(64)));
+      uint64_t acc64;
+      __m512i acc_low,acc_high,vec16,mat16;
+      __m512i prod1,prod2;
+      __m512i res1;
+      const uint32_t *vec_cp;
+      const uint32_t *mat_cp;
+
+      /* parallelization of the outer loop (rows) */
+#pragma omp for
+      /* For each row of the matrix, we compute a dot product */
+      for(j = 0; j < nrows; ++j){
+        vec_cp=vec;
+        mat_cp=mat + j*ncols;
+
+        acc_low=_mm512_setzero_si512();
+        acc_high=_mm512_setzero_si512();
+
+        long local_ncols, quo, rem;
+        if(dst[j] != 0){
+          local_ncols = ncols - dst[j];
+          quo = LENGTHQ8(local_ncols);
+          rem = LENGTHR8(local_ncols);
+        }
+        else{
+          local_ncols = ncols;
+          quo = quo0;
+          rem = rem0;
+        }
+        /* Accumulation */
+        for(i = 0 ; i < quo; ++i){
+          mat16=_mm512_loadu_si512((__m512i*)(mat_cp));
+          vec16=_mm512_loadu_si512((__m512i*)(vec_cp));
+          /* eight 32-bits mul, lower parts */
+          /* eight 32-bits mul, higher parts */
+          prod1=_mm512_mul_epu32(mat16,vec16);
+          prod2=_mm512_mul_epu32(_mm512_srli_epi64(mat16,32),
+                                 _mm512_srli_epi64(vec16,32));
+          res1 = _mm512_add_epi64(prod1, prod2);
+          mat_cp+=16;
+          vec_cp+=16;
+          mat16=_mm512_loadu_si512((__m512i*)(mat_cp));
+          vec16=_mm512_loadu_si512((__m512i*)(vec_cp));
+          prod1=_mm512_mul_epu32(mat16,vec16);
+          prod2=_mm512_mul_epu32(_mm512_srli_epi64(mat16,32),
+                                 _mm512_srli_epi64(vec16,32));
+          res1 = _mm512_add_epi64(res1, _mm512_add_epi64(prod1, prod2));
+          mat_cp+=16;
+          vec_cp+=16;
+
+          acc_low=_mm512_add_epi64(acc_low,_mm512_and_si512(res1,mask));
+          acc_high=_mm512_add_epi64(acc_high,_mm512_srli_epi64(res1,32));
+        }
+
+        _mm512_store_si512((__m512i*)(acc8x64),acc_low);
+        _mm512_store_si512((__m512i*)(acc8x64+8),acc_high);
+
+        /* Reduction */
+        acc64=0;
+        for(i=0;i<8;++i){
+          //partie haute du registre haut (2^64 ->2^95)
+          acc8x64[i]+=((acc8x64[i+8]>>32)*RED_64)%PRIME;
+          //partie basse du registre haut (2^32->2^63)
+          acc8x64[i]+=((acc8x64[i+8]&((uint64_t)0xFFFFFFFF))*RED_32)%PRIME;
+          acc64+=acc8x64[i]%PRIME;
+        }
+
+        vec_res[j]=acc64%PRIME;
+
+        long tmp = 0;
+        for(long k = 0; k < rem; k++){
+          tmp += ((long)mat_cp[k] * (long)vec_cp[k]) % PRIME;
+        }
+        vec_res[j] = (vec_res[j] + tmp) % PRIME;
+      }
+    }
+}
+#endif
+
+/**
+Dense part of the FGLM matrix vector product, uses the widest kernel
+the CPU supports (see simd_level() in neogb/tools.c).
+**/
+
+static inline void dense_matrix_vector_product(uint32_t* vec_res,
+                                               const uint32_t* mat,
+                                               const uint32_t* vec,
+                                               const uint32_t *dst,
+                                               const uint32_t ncols,
+                                               const uint32_t nrows,
+                                               const uint32_t PRIME,
+                                               const uint32_t RED_32,
+                                               const uint32_t RED_64,
+                                               const uint32_t preinv,
+                                               md_t *st){
+#if defined SIMD_DISPATCH
+  switch (simd_level()) {
+    case SIMD_AVX512:
+      _16mul_matrix_vector_product(vec_res, mat, vec, dst, ncols, nrows,
+                                   PRIME, RED_32, RED_64, preinv, st);
+      break;
+    case SIMD_AVX2:
+      _8mul_matrix_vector_product(vec_res, mat, vec, dst, ncols, nrows,
+                                  PRIME, RED_32, RED_64, preinv, st);
+      break;
+    default:
+      non_avx_matrix_vector_product(vec_res, mat, vec, ncols, nrows,
+                                    PRIME, RED_32, RED_64, st);
+  }
+#elif defined HAVE_AVX2
+  _8mul_matrix_vector_product(vec_res, mat, vec, dst, ncols, nrows,
+                              PRIME, RED_32, RED_64, preinv, st);
+#else
+  non_avx_matrix_vector_product(vec_res, mat, vec, ncols, nrows,
+                                PRIME, RED_32, RED_64, st);
+#endif
+}
@@ -21,7 +21,7 @@
 //-1 sur 32 bits
 #define MONE32 ((uint32_t)0xFFFFFFFF)
 
-#ifdef HAVE_AVX2
+#if defined HAVE_AVX2 || defined SIMD_DISPATCH
 #include <immintrin.h>
 
 #define AVX2LOAD(A) _mm256_load_si256((__m256i*)(A))
@@ -110,8 +110,8 @@ static inline uint64_t SUBMODRED32(uint64_t a, uint64_t b,
   return (a < b) ? (p + neg) : (neg);
 }
 
-#if HAVE_AVX2
-static inline void REDUCE(uint64_t *acc64, uint64_t *acc4x64,
+#if defined HAVE_AVX2 || defined SIMD_DISPATCH
+TARGET_AVX2 static inline void REDUCE(uint64_t *acc64, uint64_t *acc4x64,
                           __m256i acc_low, __m256i acc_high,
                           const uint32_t fc, const uint32_t preinv,
                           const uint32_t RED_32, const uint32_t RED_64){
@@ -165,7 +165,7 @@ static __inline__ void make_zero(uint32_t ** D,
 
 }
 
-#ifdef HAVE_AVX2
+#if defined HAVE_AVX2 || defined SIMD_DISPATCH
 /*
   m = number of rows in A
   l = number of cols in A = number of rows in B
@@ -174,7 +174,7 @@ static __inline__ void make_zero(uint32_t ** D,
   D = A*B
 
 */
-void _mod_mat_addmul_transpose_op(uint32_t *D, 
+TARGET_AVX2 void _mod_mat_addmul_transpose_op(uint32_t *D, 
                                   uint32_t *A, uint32_t *B,
                                   const uint32_t m, const uint32_t l,
                                   const uint32_t n,
@@ -283,7 +283,16 @@ static inline void sparse_matfglm_mul(CF_t *res, sp_matfglm_t *matxn, CF_t *R,
 
 
   /* real product */
-#ifdef HAVE_AVX2
+#if defined SIMD_DISPATCH
+  if (simd_level() == SIMD_NONE) {
+    fprintf(stderr, "Not implemented yet\n");
+    exit(1);
+  }
+  _mod_mat_addmul_transpose_op(tres, matxn->dense_mat, R,
+                               matxn->nrows, matxn->ncols, nc,
+                               prime, preinv,
+                               RED_32, RED_64);
+#elif defined HAVE_AVX2
   _mod_mat_addmul_transpose_op(tres, matxn->dense_mat, R,
                                matxn->nrows, matxn->ncols, nc,
                                prime, preinv,
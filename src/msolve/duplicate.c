@@ -1,4 +1,6 @@
 
+/* linvars and squvars only depend on the learned staircase,
+ * they are shared by all threads, only lineqs is filled per prime */
 static inline void duplicate_linear_data(int nthreads, int nvars, int nlins,
                                          nvars_t **blinvars, uint32_t **blineqs,
                                          nvars_t **bsquvars){
@@ -9,93 +11,19 @@ static inline void duplicate_linear_data(int nthreads, int nvars, int nlins,
       blineqs[i][j] = 0;
     }
 
-    blinvars[i] = calloc(nvars, sizeof(uint64_t));
-    for(long j = 0; j < nvars; j++){
-      blinvars[i][j] = blinvars[0][j];
-    }
-
-    bsquvars[i] = calloc(nvars - 1, sizeof(uint64_t));
-    for(nvars_t j = 0; j < nvars - 1; j++){
-      bsquvars[i][j] = bsquvars[0][j];
-    }
-
+    blinvars[i] = blinvars[0];
+    bsquvars[i] = bsquvars[0];
   }
 }
 
+/* the trace is only read during application runs,
+ * thus all threads share the learned one */
 static inline void duplicate_tracer(
         const int nthreads,
-        const bs_t * const bs,
-        const md_t * const md,
         trace_t **btrace)
 {
-    if (btrace[0] != NULL) {
-        for(int i = 1; i < nthreads; i++){
-            btrace[i]  = initialize_trace(bs, md);
-
-            /* size for trace data */
-            btrace[i]->std  = btrace[0]->std;
-            /* load of trace data */
-            btrace[i]->ltd  = btrace[0]->ltd;
-            /* number of lead monomials of non-redundant elements in Gbasis */
-            btrace[i]->lml  = btrace[0]->lml;
-
-            /* position of non redundant elements in Gbasis */
-            btrace[i]->lmps = (bl_t *)calloc((unsigned long)btrace[0]->lml,
-                    sizeof(bl_t));
-            memcpy(btrace[i]->lmps, btrace[0]->lmps,
-                    (unsigned long)btrace[0]->lml * sizeof(bl_t));
-
-            /* non-redundant lead mon. as short divmask */
-            btrace[i]->lm   = (sdm_t *)calloc((unsigned long)btrace[0]->lml,
-                    sizeof(sdm_t));
-            memcpy(btrace[0]->lm, btrace[i]->lm,
-                    (unsigned long)btrace[0]->lml * sizeof(sdm_t));
-
-            /* array of trace data per F4 round */
-            btrace[i]->td  = calloc((unsigned long)btrace[0]->ltd, sizeof(td_t));
-
-            for(len_t l = 0; l < btrace[0]->ltd; ++l){
-
-                btrace[i]->td[l].rld = btrace[0]->td[l].rld;
-                btrace[i]->td[l].tld = btrace[0]->td[l].tld;
-                btrace[i]->td[l].nlm = btrace[0]->td[l].nlm;
-
-                btrace[i]->td[l].rri = calloc(btrace[0]->td[l].rld,
-                        sizeof(len_t));
-                for(len_t k = 0; k < (btrace[0]->td[l].rld ); ++k){
-                    btrace[i]->td[l].rri[k] = btrace[0]->td[l].rri[k] ;
-                }
-
-                btrace[i]->td[l].tri = calloc(btrace[0]->td[l].tld,
-                        sizeof(len_t));
-                for(len_t k = 0; k < (btrace[0]->td[l].tld); ++k){
-                    btrace[i]->td[l].tri[k] = btrace[0]->td[l].tri[k] ;
-                }
-
-                btrace[i]->td[l].nlms = calloc(btrace[0]->td[l].nlm,
-                        sizeof(len_t));
-                for(len_t k = 0; k < (btrace[0]->td[l].nlm); ++k){
-                    btrace[i]->td[l].nlms[k] = btrace[0]->td[l].nlms[k];
-                }
-
-                btrace[i]->td[l].rba = (rba_t **)malloc((unsigned long)btrace[0]->td[l].tld * sizeof(rba_t *));
-
-                const len_t nrr   = btrace[0]->td[l].rld;
-
-                const unsigned long nlrba = nrr / 2 / 32 + (((nrr / 2) % 32) != 0);
-
-                for(len_t j = 0; j < (btrace[0]->td[l].tld / 2); ++j) {
-                    btrace[i]->td[l].rba[j]  = calloc(nlrba, sizeof(rba_t));
-                }
-
-                for (len_t j = 0; j < (btrace[0]->td[l].tld / 2); ++j) {
-                    for(len_t k = 0; k < nlrba; k++){
-                        btrace[i]->td[l].rba[j][k]  = btrace[0]->td[l].rba[j][k];
-                    }
-                }
-
-            }
-        }
+    for(int i = 1; i < nthreads; i++){
+        btrace[i]  = btrace[0];
     }
 }
 
@@ -136,37 +64,27 @@ static inline void duplicate_data_mthread_trace(int nthreads,
   for(int i = 0; i < nthreads; i++){
     leadmons_current[i] = (int32_t *)malloc(len*sizeof(int32_t));
   }
-  /* leadmons_ori[0] has already been allocated*/
+  /* leadmons_ori[0] has already been allocated, the staircase,
+   * the positions of the elements in the basis and the pure monomials
+   * to be reduced are only read during application runs, so they are
+   * shared by all threads. */
   for(int i = 1; i < nthreads; i++){
-    leadmons_ori[i] = (int32_t *)calloc(len, sizeof(int32_t));
-    for(long j = 0; j < len; j++){
-      leadmons_ori[i][j] = leadmons_ori[0][j];
-    }
+    leadmons_ori[i] = leadmons_ori[0];
+    bdiv_xn[i] = bdiv_xn[0];
+    bextra_nf[i] = bextra_nf[0];
+    blens_extra_nf[i] = blens_extra_nf[0];
+    bexps_extra_nf[i] = bexps_extra_nf[0];
+    bcfs_extra_nf[i] = bcfs_extra_nf[0];
   }
+  /* lengths and starting positions of the coefficients depend on
+   * the prime, these are filled per thread */
   for(long i = 1; i < nthreads; i++){
     bstart_cf_gb_xn[i] = (int32_t *) (malloc(sizeof(int32_t) * len_xn));
     blen_gb_xn[i] = (int32_t *) (malloc(sizeof(int32_t) * len_xn));
-    bdiv_xn[i] = (int32_t *) (malloc(sizeof(int32_t) * num_gb[0]/* bs->lml */));
     for(long j = 0; j < len_xn; j++){
       bstart_cf_gb_xn[i][j] = bstart_cf_gb_xn[0][j];
       blen_gb_xn[i][j] = blen_gb_xn[0][j];
     }
-    for(long j = 0; j < num_gb[0]; j++){
-      bdiv_xn[i][j] = bdiv_xn[0][j];
-    }
-    /* pure monomials to be reduced */
-    bextra_nf[i] = (long *)(malloc(sizeof(long) * lextra_nf));
-    blens_extra_nf[i] = (int32_t *)(malloc(sizeof(int32_t) * lextra_nf));
-    bexps_extra_nf[i] = (int32_t *)(malloc(sizeof(int32_t) * lextra_nf * (st->nvars)));
-    bcfs_extra_nf[i] = (int32_t *)(malloc(sizeof(int32_t) * lextra_nf));
-    for (long j = 0; j < lextra_nf; j++){
-      bextra_nf[i][j] = bextra_nf[0][j];
-      blens_extra_nf[i][j] = blens_extra_nf[0][j];
-      for (long k = 0; k < st->nvars; k++){
-	bexps_extra_nf[i][j*(st->nvars)+k] = bexps_extra_nf[0][j*(st->nvars)+k];
-      }
-      bcfs_extra_nf[i][j] = bcfs_extra_nf[0][j];
-    }
   }
   for(int i=1; i < nthreads; i++){
     num_gb[i] = num_gb[0];
@@ -240,12 +158,38 @@ static inline void duplicate_data_mthread_trace(int nthreads,
     }
   }
 
-  /* duplicate_tracer(nthreads, bs, st, btrace); */
+  /* the tracer is shared through st->tr */
 
   duplicate_linear_data(nthreads, st->nvars, nlins,
                         blinvars, blineqs,
                         bsquvars);
 
+  if(st->info_level){
+    const ht_t *bht = bs->ht;
+    const long nv = st->nvars;
+    /* data allocated for each thread */
+    int64_t thrd = 0;
+    thrd += len * sizeof(int32_t); /* leadmons_current */
+    thrd += 2 * len_xn * sizeof(int32_t); /* start_cf_gb_xn, len_gb_xn */
+    thrd += (dquot * len0 + 2 * (dquot - len0) + 2 * len0) * sizeof(CF_t);
+    thrd += (2 * dquot + 2 * nv * dquot + len0) * sizeof(CF_t)
+      + 2 * dquot * sizeof(mp_limb_t); /* fglm data */
+    thrd += 4 * (dquot + 1) * sizeof(mp_limb_t); /* bms data */
+    thrd += nlins * (nv + 1) * sizeof(uint64_t); /* lineqs */
+    thrd += bht->hsz * sizeof(hi_t)
+      + bht->esz * (sizeof(hd_t) + sizeof(exp_t *)); /* basis hash table */
+    /* read-only data shared by all threads */
+    int64_t shrd = 0;
+    shrd += len * sizeof(int32_t); /* leadmons_ori */
+    shrd += num_gb[0] * sizeof(int32_t); /* div_xn */
+    shrd += lextra_nf * (sizeof(long) + (nv + 2) * sizeof(int32_t));
+    shrd += (2 * nv - 1) * sizeof(nvars_t); /* linvars, squvars */
+    shrd += bht->eld * bht->evl * sizeof(exp_t); /* exponent vectors */
+    fprintf(stderr, "Memory per thread in multi-modular steps: %.2f MB\n",
+            (double)thrd / (1024.0 * 1024.0));
+    fprintf(stderr, "Read-only data shared by all threads:     %.2f MB\n",
+            (double)shrd / (1024.0 * 1024.0));
+  }
 }
 
 
@@ -380,18 +324,15 @@ static inline void duplicate_data_mthread_gbtrace(int nthreads,
   for(int i = 0; i < nthreads; i++){
     leadmons_current[i] = (int32_t *)calloc(len, sizeof(int32_t));
   }
-  /* leadmons_ori[0] has already been allocated*/
+  /* leadmons_ori[0] has already been allocated, it is only read */
   for(int i = 1; i < nthreads; i++){
-    leadmons_ori[i] = (int32_t *)calloc(len, sizeof(int32_t));
-    for(len_t j = 0; j < len; j++){
-      leadmons_ori[i][j] = leadmons_ori[0][j];
-    }
+    leadmons_ori[i] = leadmons_ori[0];
   }
   for(int i=1; i < nthreads; i++){
     num_gb[i] = num_gb[0];
   }
 
 
-  duplicate_tracer(nthreads, bs, st, btrace);
+  duplicate_tracer(nthreads, btrace);
 
 }
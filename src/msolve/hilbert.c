@@ -23,27 +23,6 @@
 #include "../neogb/meta_data.h"
 #define REDUCTION_ALLINONE 1
 
-static void (*copy_poly_in_matrix_from_bs)(sp_matfglm_t* matrix,
-                                           long nrows,
-                                           bs_t *bs,
-                                           ht_t *ht,
-                                           long idx, long len,
-                                           long start, long pos,
-                                           int32_t *lmb,
-                                           const int nv,
-                                           const long fc);
-
-static void (*copy_nf_in_matrix_from_bs)(sp_matfglm_t* matrix,
-					 long nrows,
-					 long pos,
-					 int32_t *lmb,
-					 const bs_t * const tbr,
-					 const ht_t * const bht,
-					 int32_t * evi,
-					 const md_t *st,
-					 const int nv);
-
-
 static int is_pure_power(const int32_t *bexp, const int nv){
     int cnt = 0;
     for(int i = 0; i < nv; i++){
@@ -1274,6 +1253,49 @@ static inline void copy_nf_in_matrix_from_bs_32(sp_matfglm_t* matrix,
   }
 }
 
+/* the variant is chosen by the coefficient size of the basis */
+static inline void copy_poly_in_matrix_from_bs(sp_matfglm_t* matrix,
+                                               long nrows,
+                                               bs_t *bs,
+                                               ht_t *ht,
+                                               long idx, long len,
+                                               long start, long pos,
+                                               int32_t *lmb,
+                                               const int nv,
+                                               const long fc){
+  if (bs->cf_8 != NULL) {
+    copy_poly_in_matrix_from_bs_8(matrix, nrows, bs, ht, idx, len,
+                                  start, pos, lmb, nv, fc);
+  } else if (bs->cf_16 != NULL) {
+    copy_poly_in_matrix_from_bs_16(matrix, nrows, bs, ht, idx, len,
+                                   start, pos, lmb, nv, fc);
+  } else {
+    copy_poly_in_matrix_from_bs_32(matrix, nrows, bs, ht, idx, len,
+                                   start, pos, lmb, nv, fc);
+  }
+}
+
+static inline void copy_nf_in_matrix_from_bs(sp_matfglm_t* matrix,
+                                             long nrows,
+                                             long pos,
+                                             int32_t *lmb,
+                                             const bs_t * const tbr,
+                                             const ht_t * const bht,
+                                             int32_t * evi,
+                                             const md_t *st,
+                                             const int nv){
+  if (tbr->cf_8 != NULL) {
+    copy_nf_in_matrix_from_bs_8(matrix, nrows, pos, lmb, tbr, bht,
+                                evi, st, nv);
+  } else if (tbr->cf_16 != NULL) {
+    copy_nf_in_matrix_from_bs_16(matrix, nrows, pos, lmb, tbr, bht,
+                                 evi, st, nv);
+  } else {
+    copy_nf_in_matrix_from_bs_32(matrix, nrows, pos, lmb, tbr, bht,
+                                 evi, st, nv);
+  }
+}
+
 
 /** length is the length of the GB
     nvars is the number of variables
@@ -359,19 +359,18 @@ static void print_ff_basis_data(
     }
 }
 
-static int32_t get_nvars(const char *fn)
+static int32_t get_nvars(FILE *fh)
 {
-  FILE *fh  = fopen(fn,"r");
   /** load lines and store data */
-  const int max_line_size  = 1073741824;
-  char *line  = (char *)malloc((nelts_t)max_line_size * sizeof(char));
+  char *line  = NULL;
+  size_t len  = 0;
 
   /** get first line (variables) */
   const char comma_splicer  = ',';
 
   /** get number of variables */
   nvars_t nvars = 1; /** number of variables is number of commata + 1 in first line */
-  if (fgets(line, max_line_size, fh) != NULL) {
+  if (getline(&line, &len, fh) != -1) {
     char *tmp = strchr(line, comma_splicer);
     while (tmp != NULL) {
       /** if there is a comma at the end of the line, i.e. strlen(line)-2 (since
@@ -389,7 +388,7 @@ static int32_t get_nvars(const char *fn)
     nvars = 0;
   }
   free(line);
-  fclose(fh);
+  rewind(fh);
 
   return nvars;
 }
@@ -412,19 +411,20 @@ static inline int is_line_empty(const char *line)
   return 1;
 }
 
-static int32_t get_ngenerators(char *fn){
+static int32_t get_ngenerators(FILE *fh){
   int32_t nlines = 0;
   char *line  = NULL;
   size_t len = 0;
-  FILE *fh  = fopen(fn,"r");
   /* first line are the variables */
   if (getline(&line, &len, fh) == -1) {
-    fclose(fh);
+    free(line);
+    rewind(fh);
     return -1;
   }
   /* second line is the characteristic */
   if (getline(&line, &len, fh) == -1) {
-    fclose(fh);
+    free(line);
+    rewind(fh);
     return -1;
   }
   while(getdelim(&line, &len, ',', fh) != -1) {
@@ -433,7 +433,7 @@ static int32_t get_ngenerators(char *fn){
       nlines++;
   }
   free(line);
-  fclose(fh);
+  rewind(fh);
   return nlines;
 }
 
@@ -922,18 +922,17 @@ static int duplicate_vnames(char **vnames, int32_t nvars) {
   return 0;
 }
 
-//nr_gens is a pointer to the number of generators
-static inline void get_data_from_file(char *fn, int32_t *nr_vars,
-                                      int32_t *field_char,
-                                      int32_t *nr_gens, data_gens_ff_t *gens){
-  *nr_vars = get_nvars(fn);
-  *nr_gens = get_ngenerators(fn);
+/* reads the input data from the stream fh, lines are assumed to be shorter
+ * than max_line_size characters */
+static inline void get_data_from_stream(FILE *fh, const int max_line_size,
+                                        int32_t *nr_vars,
+                                        int32_t *field_char,
+                                        int32_t *nr_gens, data_gens_ff_t *gens){
+  *nr_vars = get_nvars(fh);
+  *nr_gens = get_ngenerators(fh);
 
-  const int max_line_size  = 1073741824;
   char *line  = (char *)calloc((nelts_t)max_line_size, sizeof(char));
 
-  FILE *fh  = fopen(fn,"r");
-
   /** allocate memory for storing variable names */
   char **vnames = (char **)malloc((*nr_vars) * sizeof(char *));
   get_variables(fh, line, max_line_size, nr_vars, gens, vnames);
@@ -950,8 +949,7 @@ static inline void get_data_from_file(char *fn, int32_t *nr_vars,
   get_nterms_and_all_nterms(fh, &line, max_line_size, gens, nr_gens,
                             &nterms, &all_nterms);
 
-  fclose(fh);
-  fh = fopen(fn, "r");
+  rewind(fh);
 
   if(gens->field_char){
     get_coeffs_and_exponents_ff32(fh, &line, all_nterms, nr_gens, gens);
@@ -961,11 +959,54 @@ static inline void get_data_from_file(char *fn, int32_t *nr_vars,
   }
 
   free(line);
+}
+
+//nr_gens is a pointer to the number of generators
+static inline void get_data_from_file(char *fn, int32_t *nr_vars,
+                                      int32_t *field_char,
+                                      int32_t *nr_gens, data_gens_ff_t *gens){
+  const int max_line_size  = 1073741824;
+
+  FILE *fh  = fopen(fn,"r");
+
+  get_data_from_stream(fh, max_line_size, nr_vars, field_char, nr_gens, gens);
+
   fclose(fh);
 
   return;
 }
 
+/* A batch file contains several input systems in the above format, two
+ * systems are separated by at least one empty line. get_next_system_from_batch
+ * stores the next system of the batch file in *recp (reallocated if needed,
+ * *szp is its size) and returns its length, 0 if the end of the batch file
+ * is reached. */
+static size_t get_next_system_from_batch(FILE *fh, char **recp, size_t *szp){
+  char *line  = NULL;
+  size_t len  = 0;
+  size_t rlen = 0;
+  ssize_t nc  = 0;
+
+  while ((nc = getline(&line, &len, fh)) != -1) {
+    if (is_line_empty(line) == 1) {
+      if (rlen > 0) {
+        break;
+      }
+      continue;
+    }
+    if (rlen + nc + 1 > *szp) {
+      *szp  = 2 * (rlen + nc + 1);
+      *recp = realloc(*recp, *szp * sizeof(char));
+    }
+    memcpy(*recp + rlen, line, nc);
+    rlen += nc;
+    (*recp)[rlen] = '\0';
+  }
+  free(line);
+
+  return rlen;
+}
+
 static inline void display_gens_ff(FILE *fh, data_gens_ff_t *gens){
   long pos = 0;
   int c;
@@ -1177,3 +1218,127 @@ static inline void get_params_from_file(char *fn, mpz_param_array_t lparam){
   }
   fclose(file);
 }
+
+/* Checkpoints of multi-modular computations over the rationals (see -k).
+ *
+ * A checkpoint file starts with a line
+ * "msolve-checkpoint KIND VERSION BYTEORDER", KIND being "trace"
+ * (msolve_trace_qq) or "gbtrace" (msolve_gbtrace_qq). Then, as for the
+ * binary output, small integers are written in text, one per line, and big
+ * integers with mpz_out_raw; arrays of residues are written with fwrite,
+ * hence in the byte order of the machine, which is recorded as BYTEORDER
+ * ("le" or "be"): checkpoints written with another byte order are ignored.
+ *
+ * A checkpoint is first written to FILE.tmp, which is then renamed to FILE,
+ * so that FILE is left untouched if msolve is killed while writing it. */
+#define CHECKPOINT_VERSION 2
+#ifndef CHECKPOINT_DELAY
+#define CHECKPOINT_DELAY 600 /* default minimal delay in seconds between
+                              * checkpoints, see files_gb */
+#endif
+
+static inline const char *checkpoint_byte_order(void){
+  const uint32_t one = 1;
+  return *(const unsigned char *)&one == 1 ? "le" : "be";
+}
+
+static inline char *checkpoint_tmp_name(const char *fn){
+  char *tmp = malloc(strlen(fn) + 5);
+  sprintf(tmp, "%s.tmp", fn);
+  return tmp;
+}
+
+/* opens the temporary file of the checkpoint fn and writes its header */
+static inline FILE *checkpoint_write_open(const char *fn, const char *kind){
+  char *tmp = checkpoint_tmp_name(fn);
+  FILE *file = fopen(tmp, "wb");
+  free(tmp);
+  if(file == NULL){
+    fprintf(stderr, "Cannot write checkpoint file %s.tmp\n", fn);
+    return NULL;
+  }
+  fprintf(file, "msolve-checkpoint %s %d %s\n", kind, CHECKPOINT_VERSION,
+          checkpoint_byte_order());
+  return file;
+}
+
+/* closes the temporary file of the checkpoint fn and replaces fn with it */
+static inline void checkpoint_write_close(FILE *file, const char *fn){
+  char *tmp = checkpoint_tmp_name(fn);
+  if(fclose(file) != 0 || rename(tmp, fn) != 0){
+    fprintf(stderr, "Cannot write checkpoint file %s\n", fn);
+  }
+  free(tmp);
+}
+
+/* returns the checkpoint fn opened after its header, NULL if there is no
+ * such file or if it is not a checkpoint of kind kind */
+static inline FILE *checkpoint_read_open(const char *fn, const char *kind){
+  FILE *file = fopen(fn, "rb");
+  if(file == NULL){
+    return NULL;
+  }
+  char k[16], bo[3];
+  int version = 0;
+  if(fscanf(file, "msolve-checkpoint %15s %d %2s\n", k, &version, bo) != 3 ||
+     strcmp(k, kind) != 0 || version != CHECKPOINT_VERSION){
+    fprintf(stderr, "%s is not a checkpoint of this computation, ", fn);
+    fprintf(stderr, "it is ignored\n");
+    fclose(file);
+    return NULL;
+  }
+  if(strcmp(bo, checkpoint_byte_order()) != 0){
+    fprintf(stderr, "%s has been written with another byte order, ", fn);
+    fprintf(stderr, "it is ignored\n");
+    fclose(file);
+    return NULL;
+  }
+  return file;
+}
+
+static inline void checkpoint_out_mpz_array(FILE *file, mpz_t *a,
+                                            const long len){
+  for(long i = 0; i < len; i++){
+    mpz_out_raw(file, a[i]);
+  }
+}
+
+/* returns 0 if the file is corrupted */
+static inline int checkpoint_inp_mpz_array(FILE *file, mpz_t *a,
+                                           const long len){
+  for(long i = 0; i < len; i++){
+    if(!mpz_inp_raw(a[i], file)){
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static inline void checkpoint_out_mpz_upoly(FILE *file, mpz_upoly_t pol){
+  fprintf(file, "%d\n", pol->length);
+  checkpoint_out_mpz_array(file, pol->coeffs, pol->length);
+}
+
+/* pol has to be allocated, returns 0 if the file is corrupted or if pol is
+ * not large enough */
+static inline int checkpoint_inp_mpz_upoly(FILE *file, mpz_upoly_t pol){
+  deg_t len = 0;
+  if(fscanf(file, "%d\n", &len) != 1 || len > pol->alloc){
+    return 0;
+  }
+  pol->length = len;
+  return checkpoint_inp_mpz_array(file, pol->coeffs, len);
+}
+
+/* reads the first prime stored in the checkpoint fn of kind kind, i.e. the
+ * one used in the learning phase, returns 0 if there is no such checkpoint */
+static inline int checkpoint_read_prime(const char *fn, const char *kind,
+                                        uint32_t *prime){
+  FILE *file = checkpoint_read_open(fn, kind);
+  if(file == NULL){
+    return 0;
+  }
+  int b = (fscanf(file, "%u\n", prime) == 1);
+  fclose(file);
+  return b;
+}
@@ -30,9 +30,11 @@
 
 typedef struct{
   uint32_t len; /* length of the encoded polynomial */
-  uint32_t **cf_32; /* array of arrays of coefficients
-                       * modulo several primes
-                       */
+  uint32_t *cf_32; /* coefficients modulo several primes, stored prime
+                     * after prime: cf_32[i*len+j] is the j-th coefficient
+                     * modulo the i-th prime; freed once the polynomial
+                     * is lifted and verified (see gb_modpoly_discard)
+                     */
   mpz_t *cf_zz; /* array which stores CRT lifting of
                     the coefficiels */
   mpz_t *cf_qq; /* array which stores rational coefficients
@@ -88,7 +90,8 @@ typedef struct{
   int32_t end; /* largest index of poly whose witness coef has been lifted but not checked*/
   int *check1; /* tells whether lifted data are ok with one more prime */
   int *check2; /* tells whether lifted data are ok with two more primes */
-  int32_t S;
+  int32_t S; /* polynomials of index < S are lifted and verified, their
+               residues are not stored anymore */
 } data_lift_struct;
 
 typedef data_lift_struct data_lift_t[1];
@@ -182,11 +185,11 @@ static inline void gb_modpoly_init(gb_modpoly_t modgbs,
   }
   for(uint32_t i = 0; i < ld; i++){
     modgbs->modpolys[i]->len = lens[i];
-    modgbs->modpolys[i]->cf_32 = (uint32_t **)malloc(sizeof(uint32_t *)*lens[i]);
+    modgbs->modpolys[i]->cf_32 = (uint32_t *)calloc((uint64_t)alloc * lens[i],
+                                                    sizeof(uint32_t));
     modgbs->modpolys[i]->cf_zz = (mpz_t *)malloc(sizeof(mpz_t)*lens[i]);
     modgbs->modpolys[i]->cf_qq = (mpz_t *)malloc(sizeof(mpz_t)*2*lens[i]);
     for(uint32_t j = 0; j < lens[i]; j++){
-      modgbs->modpolys[i]->cf_32[j] = calloc(alloc, sizeof(uint32_t));
       mpz_init(modgbs->modpolys[i]->cf_zz[j]);
     }
     for(uint32_t j = 0; j < 2 * lens[i]; j++){
@@ -227,18 +230,34 @@ static inline void gb_modpoly_realloc(gb_modpoly_t modgbs,
   for(uint32_t i = oldalloc; i < modgbs->alloc; i++){
     modgbs->cf_64[i] = 0;
   }
+  /* the residues of a new prime are set in modpgbs_set, so the new
+   * blocks need not be initialized here */
   for(uint32_t i = start; i < modgbs->ld; i++){
+    const uint64_t len = modgbs->modpolys[i]->len;
+    if(len == 0){
+      continue;
+    }
+    uint32_t *newcfs_pol = (uint32_t *)realloc(modgbs->modpolys[i]->cf_32,
+                                               modgbs->alloc * len * sizeof(uint32_t));
+    if(newcfs_pol == NULL){
+      fprintf(stderr, "Problem when reallocating modgbs (cfs_pol)\n");
+      exit(1);
+    }
+    modgbs->modpolys[i]->cf_32 = newcfs_pol;
+  }
+}
+
+/* frees the residues and CRT data of the i-th polynomial, it has been
+ * lifted and verified, only its rational coefficients are still needed */
+static inline void gb_modpoly_discard(gb_modpoly_t modgbs, uint32_t i){
+  free(modgbs->modpolys[i]->cf_32);
+  modgbs->modpolys[i]->cf_32 = NULL;
+  if(modgbs->modpolys[i]->cf_zz != NULL){
     for(uint32_t j = 0; j < modgbs->modpolys[i]->len; j++){
-      uint32_t *newcfs_pol = (uint32_t *)realloc(modgbs->modpolys[i]->cf_32[j],
-                                                 modgbs->alloc * sizeof(uint32_t));
-      if(newcfs_pol == NULL){
-        fprintf(stderr, "Problem when reallocating modgbs (cfs_pol)\n");
-      }
-      modgbs->modpolys[i]->cf_32[j] = newcfs_pol;
-      for(uint32_t k = oldalloc; k < modgbs->alloc; k++){
-        modgbs->modpolys[i]->cf_32[j][k] = 0;
-      }
+      mpz_clear(modgbs->modpolys[i]->cf_zz[j]);
     }
+    free(modgbs->modpolys[i]->cf_zz);
+    modgbs->modpolys[i]->cf_zz = NULL;
   }
 }
 
@@ -256,17 +275,22 @@ static inline void display_gbmodpoly_cf_32(FILE *file,
   fprintf(file, "[\n");
   for(uint32_t i = 0; i < modgbs->ld; i++){
     uint32_t len = modgbs->modpolys[i]->len;
+    uint32_t *cf = modgbs->modpolys[i]->cf_32;
     fprintf(file, "[%d, ", len);
+    if(cf == NULL){
+      fprintf(file, "],\n");
+      continue;
+    }
     for(uint32_t j = 0; j < len; j++){
       fprintf(stderr, "[");
-      for(uint32_t k = 0; k < modgbs->alloc-1; k++){
-        fprintf(file, "%d, ", modgbs->modpolys[i]->cf_32[j][k]);
+      for(uint32_t k = 0; k < modgbs->nprimes-1; k++){
+        fprintf(file, "%d, ", cf[(uint64_t)k*len+j]);
       }
       if(j < len - 1){
-        fprintf(file, "%d], ", modgbs->modpolys[i]->cf_32[j][modgbs->alloc-1]);
+        fprintf(file, "%d], ", cf[(uint64_t)(modgbs->nprimes-1)*len+j]);
       }
       else{
-        fprintf(file, "%d]\n", modgbs->modpolys[i]->cf_32[j][modgbs->alloc-1]);
+        fprintf(file, "%d]\n", cf[(uint64_t)(modgbs->nprimes-1)*len+j]);
       }
     }
     fprintf(file, "],\n");
@@ -372,21 +396,83 @@ static inline void display_lm_gbmodpoly_cf_qq(FILE *file,
   fprintf(file, "]:\n");
 }
 
+/* the normal form of the i-th element to be reduced has been lifted from
+ * the ones of its integer multiple by den (see import_input_data()) */
+static inline void display_nfmodpoly(FILE *file,
+                                     gb_modpoly_t modgbs,
+                                     int32_t pos, mpz_t den,
+                                     data_gens_ff_t *gens){
+  const int nv = gens->nvars - gens->elim;
+  int b = 0;
+  mpq_t c;
+  mpq_init(c);
+  for(int32_t i = modgbs->modpolys[pos]->len-1; i >= 0; i--){
+    if(mpz_sgn(modgbs->modpolys[pos]->cf_qq[2*i]) == 0){
+      continue;
+    }
+    mpz_set(mpq_numref(c), modgbs->modpolys[pos]->cf_qq[2*i]);
+    mpz_mul(mpq_denref(c), modgbs->modpolys[pos]->lm,
+            modgbs->modpolys[pos]->cf_qq[2*i + 1]);
+    mpz_mul(mpq_denref(c), mpq_denref(c), den);
+    mpq_canonicalize(c);
+    if(b && mpq_sgn(c) > 0){
+      fprintf(file, "+");
+    }
+    mpq_out_str(file, 10, c);
+    int32_t deg = 0;
+    for(int k = 0; k < nv; k++){
+      deg += modgbs->mb[i*nv + k];
+    }
+    if(deg > 0){
+      fprintf(file, "*");
+      display_monomial_single(file, gens, i, &modgbs->mb);
+    }
+    b = 1;
+  }
+  if(!b){
+    fprintf(file, "0");
+  }
+  mpq_clear(c);
+}
+
+/* prints the normal forms of the last nnf input polynomials */
+static inline void display_nfmodpoly_cf_qq(FILE *file,
+                                           gb_modpoly_t modgbs,
+                                           data_gens_ff_t *gens,
+                                           int32_t nnf){
+  mpz_t den;
+  mpz_init(den);
+  int64_t off = 0;
+  for(int32_t i = 0; i < gens->ngens - nnf; i++){
+    off += gens->lens[i];
+  }
+  fprintf(file, "[");
+  for(int32_t i = 0; i < modgbs->ld; i++){
+    const int32_t len = gens->lens[gens->ngens - nnf + i];
+    mpz_set_ui(den, 1);
+    for(int32_t j = 0; j < len; j++){
+      mpz_mul(den, den, *(gens->mpz_cfs[2*(off + j) + 1]));
+    }
+    off += len;
+    display_nfmodpoly(file, modgbs, i, den, gens);
+    if(i < modgbs->ld - 1){
+      fprintf(file, ",\n");
+    }
+  }
+  fprintf(file, "]:\n");
+  mpz_clear(den);
+}
+
 static inline void gb_modpoly_clear(gb_modpoly_t modgbs){
   free(modgbs->primes);
   free(modgbs->mb);
   free(modgbs->ldm);
   for(uint32_t i = 0; i < modgbs->ld; i++){
-    for(uint32_t j = 0; j < modgbs->modpolys[i]->len; j++){
-      free(modgbs->modpolys[i]->cf_32[j]);
-      mpz_clear(modgbs->modpolys[i]->cf_zz[j]);
-    }
+    gb_modpoly_discard(modgbs, i);
     for(uint32_t j = 0; j < 2 * modgbs->modpolys[i]->len; j++){
       mpz_clear(modgbs->modpolys[i]->cf_qq[j]);
     }
     mpz_clear(modgbs->modpolys[i]->lm);
-    free(modgbs->modpolys[i]->cf_32);
-    free(modgbs->modpolys[i]->cf_zz);
     free(modgbs->modpolys[i]->cf_qq);
   }
   free(modgbs->modpolys);
@@ -534,6 +620,9 @@ static inline int modpgbs_set(gb_modpoly_t modgbs,
       len = bs->hm[idx][LENGTH];
     }
     int bc = modgbs->modpolys[i]->len - 1;
+    uint32_t *cf = modgbs->modpolys[i]->cf_32
+      + (uint64_t)modgbs->nprimes * modgbs->modpolys[i]->len;
+    memset(cf, 0, (uint64_t)modgbs->modpolys[i]->len * sizeof(uint32_t));
     for (j = 1; j < len; ++j) {
       uint32_t c = bs->cf_32[bs->hm[idx][COEFFS]][j];
       for (k = 0; k < nv; ++k) {
@@ -542,7 +631,7 @@ static inline int modpgbs_set(gb_modpoly_t modgbs,
       while(!is_equal_exponent_elim(mgb, basis + (bc * (nv - elim)), nv, elim)){
         bc--;
       }
-      modgbs->modpolys[i]->cf_32[bc][modgbs->nprimes] = c;
+      cf[bc] = c;
       bc--;
    }
   }
@@ -553,6 +642,140 @@ static inline int modpgbs_set(gb_modpoly_t modgbs,
   return 1;
 }
 
+/* DRL comparison of the exponent vectors a and b, consistent with
+ * monomial_cmp_drl() on hash table entries */
+static inline int exponent_cmp_drl(const int32_t *a, const int32_t *b,
+                                   const int nv){
+  int32_t da = 0, db = 0;
+  for(int i = 0; i < nv; i++){
+    da += a[i];
+    db += b[i];
+  }
+  if(da != db){
+    return da > db ? 1 : -1;
+  }
+  for(int i = nv - 1; i > 0; i--){
+    if(a[i] != b[i]){
+      return b[i] - a[i];
+    }
+  }
+  return 0;
+}
+
+/* position of mon in the increasingly sorted array basis of dquot
+ * monomials, -1 if mon does not occur in basis */
+static inline int32_t exponent_position(const int32_t *mon,
+                                        const int32_t *basis,
+                                        const int32_t dquot, const int nv){
+  int32_t lo = 0, hi = dquot - 1;
+  while(lo <= hi){
+    const int32_t mid = lo + (hi - lo) / 2;
+    const int c = exponent_cmp_drl(mon, basis + (int64_t)mid * nv, nv);
+    if(c == 0){
+      return mid;
+    }
+    if(c > 0){
+      lo = mid + 1;
+    }
+    else{
+      hi = mid - 1;
+    }
+  }
+  return -1;
+}
+
+/* Normal forms are stored with all their coefficients, the leading one
+ * included: modpolys[i]->len is the position of the leading monomial of
+ * the i-th normal form in the support basis plus one. Normal forms which
+ * are zero modulo the learning prime have length one and -1 as first
+ * exponent of their leading monomial in modgbs->ldm. */
+
+/* returns 0 if a normal form has a term which is not in the support
+ * learned from the first prime, else returns 1. Since the staircase of
+ * fc has been checked, this means that the normal forms modulo the
+ * learning prime lost terms, i.e. the learning prime is unlucky. */
+static inline int modpnfs_set(gb_modpoly_t modgbs,
+                              const bs_t *tbr, const ht_t * const ht,
+                              const int32_t fc,
+                              int32_t *basis, const int dquot,
+                              int *mgb, int32_t start){
+  if(modgbs->nprimes >= modgbs->alloc-1){
+    fprintf(stderr, "Not enough space in modgbs\n");
+    exit(1);
+  }
+  const len_t nv = ht->nv;
+
+  for(uint32_t i = start; i < modgbs->ld; i++){
+    const uint32_t len = modgbs->modpolys[i]->len;
+    uint32_t *cf = modgbs->modpolys[i]->cf_32
+      + (uint64_t)modgbs->nprimes * len;
+    memset(cf, 0, (uint64_t)len * sizeof(uint32_t));
+    const hm_t *hm = tbr->hm[tbr->lmps[i]];
+    if(hm == NULL){
+      continue;
+    }
+    if(modgbs->ldm[i * nv] < 0){
+      return 0;
+    }
+    const cf32_t *cfs = tbr->cf_32[hm[COEFFS]];
+    for(len_t j = 0; j < hm[LENGTH]; j++){
+      /* no elimination block, variables start at index 1 */
+      for(len_t k = 0; k < nv; k++){
+        mgb[k] = ht->ev[hm[OFFSET+j]][k+1];
+      }
+      const int32_t pos = exponent_position(mgb, basis, dquot, nv);
+      if(pos < 0 || pos >= len){
+        return 0;
+      }
+      cf[pos] = cfs[j];
+    }
+  }
+  modgbs->primes[modgbs->nprimes] = fc;
+  modgbs->nprimes++;
+
+  return 1;
+}
+
+static int nf_support_cmp(const void *a, const void *b, void *htp){
+  const ht_t *ht = (ht_t *)htp;
+  return ht->monomial_cmp(*((hm_t *)a), *((hm_t *)b), ht);
+}
+
+/* normal forms modulo fc of the elements of tbr_qq w.r.t. the Groebner
+ * basis bs computed modulo fc, returns NULL in case of failure.
+ * if learn is set, the reducers used are kept in st->nfr, else they are
+ * taken from there instead of running a symbolic preprocessing */
+static bs_t *modular_normal_forms(const bs_t *tbr_qq, bs_t *bs,
+                                  md_t *st, const uint32_t fc,
+                                  const int learn){
+  int32_t err = 0;
+  md_t *md = copy_meta_data(st, fc);
+  set_ff_bits(md, fc);
+  /* a single reduction step, only its reducers are traced */
+  md->trace_level = NO_TRACER;
+  md->nf_trace_level = learn ? LEARN_TRACER
+    : (st->nfr != NULL ? APPLY_TRACER : NO_TRACER);
+  /* the copy shares the hash table of tbr_qq, the terms of the normal
+   * forms are inserted into the hash table of bs by core_nf() */
+  md->f4_qq_round = 1;
+  bs_t *tbr = copy_basis_mod_p(tbr_qq, md);
+  exp_t *mul = (exp_t *)calloc(bs->ht->evl, sizeof(exp_t));
+
+  tbr = core_nf(tbr, md, mul, bs, &err);
+  if(learn){
+    free(st->nfr);
+    st->nfr = md->nfr;
+    st->nfrl = md->nfrl;
+  }
+
+  free(mul);
+  free(md);
+  if(err){
+    free_basis_without_hash_table(&tbr);
+  }
+  return tbr;
+}
+
 static inline int32_t maxbitsize_gens(data_gens_ff_t *gens, len_t ngens){
   if(gens->field_char != 0){
     return -1;
@@ -592,6 +815,7 @@ static int32_t * gb_modular_trace_learning(gb_modpoly_t modgbs,
                                            trace_t *trace,
                                            ht_t *tht,
                                            bs_t *bs_qq,
+                                           bs_t *sat_qq,
                                            ht_t *gbht,
                                            md_t *st,
                                            const int32_t fc,
@@ -613,8 +837,21 @@ static int32_t * gb_modular_trace_learning(gb_modpoly_t modgbs,
     /* if(gens->field_char){ */
     int32_t err     = 0;
     st->f4_qq_round = 1;
-    bs = core_gba(bs_qq, st, &err, fc);
-    if (err) {
+    if(sat_qq != NULL){
+      /* the first run learns in which degrees saturation steps give new
+       * elements, the second one records the trace for these degrees */
+      st->tr = trace;
+      bs = f4sat_trace_learning_phase_1(trace, tht, bs_qq, sat_qq,
+                                        &gbht, st, fc);
+      free_basis_without_hash_table(&bs);
+      bs = f4sat_trace_learning_phase_2(trace, tht, bs_qq, sat_qq,
+                                        &gbht, st, fc);
+      st->trace_level = APPLY_TRACER;
+    }
+    else{
+      bs = core_gba(bs_qq, st, &err, fc);
+    }
+    if (err || bs == NULL) {
       printf("Problem with F4, stopped computation.\n");
       exit(1);
     }
@@ -717,6 +954,7 @@ static void gb_modular_trace_application(gb_modpoly_t modgbs,
                                          trace_t **btrace,
                                          ht_t **btht,
                                          bs_t *bs_qq,
+                                         bs_t *sat_qq,
                                          ht_t **gbht,
                                          md_t *st,
                                          const int32_t fc,
@@ -734,68 +972,261 @@ static void gb_modular_trace_application(gb_modpoly_t modgbs,
   st->info_level  = 0;
   st->f4_qq_round = 2;
   /* tracing phase */
+  len_t i;
+
+  /* st->nthrds primes are handled in parallel, F4 is run using a single
+   * thread for each prime, st->nthrds is reset to its original value
+   * afterwards */
+  const int nthrds = st->nthrds;
+  st->nthrds = 1;
+  memset(bad_primes, 0, (unsigned long)nthrds * sizeof(int));
+
+#pragma omp parallel for num_threads(nthrds)  \
+    private(i) schedule(dynamic)
+  for (i = 0; i < nthrds; ++i) {
+    int32_t error = 0;
+    if (sat_qq != NULL) {
+      obs[i] = f4sat_trace_application_phase(btrace[i], btht[i], bs_qq,
+                                             sat_qq, gbht[0], st, lp->p[i]);
+    } else {
+      obs[i] = core_gba(bs_qq, st, &error, lp->p[i]);
+    }
 
-  /* F4 and FGLM are run using a single thread */
-  /* st->nthrds is reset to its original value afterwards */
-  /*at the moment multi-threading is not supprted here*/
-  memset(bad_primes, 0, (unsigned long)st->nprimes * sizeof(int));
-
-  bs_t *bs = NULL;
-  int32_t error = 0;
-  bs = core_gba(bs_qq, st, &error, lp->p[0]);
-  *stf4 = realtime()-rt;
-  /* if(st->laopt > 40){
-    bs = modular_f4(bs_qq, bht[0], st, lp->p[0]);
-  }
-  else{
-    bs = gba_trace_application_phase(btrace[0], btht[0], bs_qq, bht[0], st, lp->p[0]);
-  }
-  */
-  ht_t **bht = &(bs->ht);
-  if (bs == NULL) {
-      bad_primes[0] = 1;
-      return;
-  }
-  int32_t lml = bs->lml;
-  if (st->nev > 0) {
+    if (error > 0 || obs[i] == NULL) {
+      if (obs[i] != NULL) {
+        free_basis_and_only_local_hash_table_data(&(obs[i]));
+      }
+      bad_primes[i] = 1;
+      continue;
+    }
+    bs_t *bs  = obs[i];
+    ht_t *bht = bs->ht;
+    int32_t lml = bs->lml;
+    if (st->nev > 0) {
       int32_t j = 0;
-      for (len_t i = 0; i < bs->lml; ++i) {
-          if ((*bht)->ev[bs->hm[bs->lmps[i]][OFFSET]][0] == 0) {
-              bs->lm[j]   = bs->lm[i];
-              bs->lmps[j] = bs->lmps[i];
-              ++j;
-          }
+      for (len_t k = 0; k < bs->lml; ++k) {
+        if (bht->ev[bs->hm[bs->lmps[k]][OFFSET]][0] == 0) {
+          bs->lm[j]   = bs->lm[k];
+          bs->lmps[j] = bs->lmps[k];
+          ++j;
+        }
       }
       lml = j;
+    }
+    if (lml != num_gb[i]) {
+      free_basis_and_only_local_hash_table_data(&(obs[i]));
+      bad_primes[i] = 1;
+      continue;
+    }
+
+    if(st->nev){
+      get_lm_from_bs_trace_elim(bs, bht, leadmons_current[i], num_gb[i]);
+    }
+    else{
+      get_lm_from_bs_trace(bs, bht, leadmons_current[i]);
+    }
+
+    if(!equal_staircase(leadmons_current[i], leadmons_ori[i],
+                        num_gb[i], num_gb[i], bht->nv - st->nev)){
+      bad_primes[i] = 1;
+    }
   }
-  if (lml != num_gb[0]) {
-      if (bs != NULL) {
-        free_basis_and_only_local_hash_table_data(&bs);
-      }
-      return;
+  st->nthrds = nthrds;
+  *stf4 = realtime()-rt;
+
+  /* copy of data for multi-mod computation, in the order of the primes,
+   * so that the new primes are the last ones stored in modgbs */
+  for (i = 0; i < nthrds; ++i) {
+    if (obs[i] == NULL) {
+      continue;
+    }
+    if (!bad_primes[i]) {
+      modpgbs_set(modgbs, obs[i], obs[i]->ht, lp->p[i], lmb_ori, dquot_ori,
+                  mgb, start, st->nev);
+    }
+    free_basis_and_only_local_hash_table_data(&(obs[i]));
   }
+}
 
-  if(st->nev){
-    get_lm_from_bs_trace_elim(bs, bht[0], leadmons_current[0], num_gb[0]);
+/* Learning step for normal forms: the Groebner basis of bs_qq is computed
+ * modulo fc while learning its trace, then the elements of tbr_qq are
+ * reduced. The union of the supports of their normal forms is returned,
+ * sorted increasingly, it is used for all upcoming primes. */
+static int32_t *nf_modular_trace_learning(gb_modpoly_t modgbs,
+                                          int32_t *mgb,
+                                          int32_t *num_gb,
+                                          int32_t **leadmons,
+                                          bs_t *bs_qq,
+                                          bs_t *tbr_qq,
+                                          md_t *st,
+                                          const int32_t fc,
+                                          int info_level,
+                                          long *dquot_ori){
+  double ca0 = realtime();
+
+  int32_t err = 0;
+  st->f4_qq_round = 1;
+  /* only exact linear algebra learns a trace: else core_f4() compacts the
+   * basis hash table, which is shared with bs_qq and tbr_qq */
+  if(st->laopt >= 40){
+    st->laopt = 2;
+  }
+  bs_t *bs = core_gba(bs_qq, st, &err, fc);
+  if (err || st->trace_level != APPLY_TRACER) {
+    printf("Problem with F4, stopped computation.\n");
+    exit(1);
   }
-  else{
-    get_lm_from_bs_trace(bs, bht[0], leadmons_current[0]);
+  if(info_level > 1){
+    fprintf(stderr, "Learning phase %.2f Gops/sec\n",
+            (st->trace_nr_add+st->trace_nr_mult)/1000.0/1000.0/(realtime()-ca0));
   }
+  const ht_t *bht = bs->ht;
+  const int nv = bht->nv;
+
+  leadmons[0] = get_lm_from_bs(bs, bht);
+  num_gb[0] = bs->lml;
 
-  if(!equal_staircase(leadmons_current[0], leadmons_ori[0],
-                      num_gb[0], num_gb[0], bht[0]->nv - st->nev)){
-    bad_primes[0] = 1;
+  bs_t *tbr = modular_normal_forms(tbr_qq, bs, st, fc, 1);
+  if(tbr == NULL){
+    printf("Problem with normalform, stopped computation.\n");
+    exit(1);
+  }
+
+  /* union of the supports of the normal forms */
+  int64_t nterms = 0;
+  for(len_t i = 0; i < tbr->ld; i++){
+    if(tbr->hm[i] != NULL){
+      nterms += tbr->hm[i][LENGTH];
+    }
+  }
+  hm_t *sup = (hm_t *)malloc((unsigned long)(nterms + 1) * sizeof(hm_t));
+  nterms = 0;
+  for(len_t i = 0; i < tbr->ld; i++){
+    if(tbr->hm[i] != NULL){
+      memcpy(sup + nterms, tbr->hm[i] + OFFSET,
+             (unsigned long)tbr->hm[i][LENGTH] * sizeof(hm_t));
+      nterms += tbr->hm[i][LENGTH];
+    }
+  }
+  sort_r(sup, (unsigned long)nterms, sizeof(hm_t), nf_support_cmp, (void *)bht);
+  long dquot = 0;
+  for(int64_t i = 0; i < nterms; i++){
+    if(dquot == 0 || sup[i] != sup[dquot-1]){
+      sup[dquot++] = sup[i];
+    }
+  }
+  int32_t *mb = (int32_t *)calloc((unsigned long)(dquot + 1) * nv, sizeof(int32_t));
+  for(long i = 0; i < dquot; i++){
+    for(int k = 0; k < nv; k++){
+      mb[i*nv+k] = bht->ev[sup[i]][k+1];
+    }
   }
+  free(sup);
 
-  if(!bad_primes[0] && bs != NULL){
-    /* copy of data for multi-mod computation */
-    modpgbs_set(modgbs, bs, bht[0], lp->p[0], lmb_ori, dquot_ori, mgb, start, st->nev);
+  int32_t *lens = (int32_t *)malloc((unsigned long)tbr->ld * sizeof(int32_t));
+  int32_t *ldm = (int32_t *)calloc((unsigned long)tbr->ld * nv, sizeof(int32_t));
+  for(len_t i = 0; i < tbr->ld; i++){
+    if(tbr->hm[i] == NULL){
+      lens[i] = 1;
+      ldm[i*nv] = -1;
+      continue;
+    }
+    lens[i] = 0;
+    for(len_t j = 0; j < tbr->hm[i][LENGTH]; j++){
+      for(int k = 0; k < nv; k++){
+        mgb[k] = bht->ev[tbr->hm[i][OFFSET+j]][k+1];
+      }
+      lens[i] = MAX(lens[i], exponent_position(mgb, mb, dquot, nv) + 1);
+    }
+    memcpy(ldm + i*nv, mb + (lens[i]-1)*nv, (unsigned long)nv * sizeof(int32_t));
   }
+  gb_modpoly_init(modgbs, 2, lens, nv, tbr->ld, ldm, mb);
+  modpnfs_set(modgbs, tbr, bht, fc, mb, dquot, mgb, 0);
+  *dquot_ori = dquot;
 
-  if (bs != NULL) {
-    free_basis_and_only_local_hash_table_data(&bs);
+  free(lens);
+  free(ldm);
+  free_basis_without_hash_table(&tbr);
+  free_basis_without_hash_table(&bs);
+
+  return mb;
+}
+
+/* Same as gb_modular_trace_application, the normal forms of the elements
+ * of tbr_qq are computed after each Groebner basis using the reducers
+ * learned with the first prime, and stored in modgbs. bad_primes[i] is 2
+ * if prime i shows that the learning prime is unlucky. */
+static void nf_modular_trace_application(gb_modpoly_t modgbs,
+                                         int32_t *mgb,
+                                         int32_t *num_gb,
+                                         int32_t **leadmons_ori,
+                                         int32_t **leadmons_current,
+                                         bs_t *bs_qq,
+                                         bs_t *tbr_qq,
+                                         md_t *st,
+                                         bs_t **obs,
+                                         int32_t *lmb_ori,
+                                         int32_t dquot_ori,
+                                         primes_t *lp,
+                                         int32_t start,
+                                         double *stf4,
+                                         int *bad_primes){
+
+  double rt = realtime();
+  st->info_level  = 0;
+  st->f4_qq_round = 2;
+  len_t i;
+
+  const int nthrds = st->nthrds;
+  st->nthrds = 1;
+  memset(bad_primes, 0, (unsigned long)nthrds * sizeof(int));
+  bs_t **otbr = (bs_t **)calloc((unsigned long)nthrds, sizeof(bs_t *));
+
+#pragma omp parallel for num_threads(nthrds)  \
+    private(i) schedule(dynamic)
+  for (i = 0; i < nthrds; ++i) {
+    int32_t error = 0;
+    obs[i] = core_gba(bs_qq, st, &error, lp->p[i]);
+
+    if (error > 0 || obs[i] == NULL) {
+      if (obs[i] != NULL) {
+        free_basis_and_only_local_hash_table_data(&(obs[i]));
+      }
+      bad_primes[i] = 1;
+      continue;
+    }
+    if (obs[i]->lml != num_gb[i]) {
+      bad_primes[i] = 1;
+      continue;
+    }
+    get_lm_from_bs_trace(obs[i], obs[i]->ht, leadmons_current[i]);
+    if(!equal_staircase(leadmons_current[i], leadmons_ori[i],
+                        num_gb[i], num_gb[i], obs[i]->ht->nv)){
+      bad_primes[i] = 1;
+      continue;
+    }
+    otbr[i] = modular_normal_forms(tbr_qq, obs[i], st, lp->p[i], 0);
+    if (otbr[i] == NULL) {
+      bad_primes[i] = 1;
+    }
   }
+  st->nthrds = nthrds;
+  *stf4 = realtime()-rt;
 
+  for (i = 0; i < nthrds; ++i) {
+    if (otbr[i] != NULL) {
+      if (!bad_primes[i] &&
+          !modpnfs_set(modgbs, otbr[i], obs[i]->ht, lp->p[i], lmb_ori,
+                       dquot_ori, mgb, start)) {
+        bad_primes[i] = 2;
+      }
+      free_basis_without_hash_table(&(otbr[i]));
+    }
+    if (obs[i] != NULL) {
+      free_basis_and_only_local_hash_table_data(&(obs[i]));
+    }
+  }
+  free(otbr);
 }
 
 static inline void choose_coef_to_lift(gb_modpoly_t modgbs, data_lift_t dlift){
@@ -804,7 +1235,7 @@ static inline void choose_coef_to_lift(gb_modpoly_t modgbs, data_lift_t dlift){
     uint32_t d = 0;
     uint32_t len = modgbs->modpolys[i]->len;
     while(d < len - 1){
-      if(modgbs->modpolys[i]->cf_32[d][0]){
+      if(modgbs->modpolys[i]->cf_32[d]){
         dlift->coef[i] = d;
         break;
       }
@@ -825,7 +1256,8 @@ static inline void incremental_dlift_crt(gb_modpoly_t modgbs, data_lift_t dlift,
   /* all primes are assumed to be good primes */
   mpz_mul_ui(prod_p[0], mod_p[0], modgbs->primes[modgbs->nprimes - 1 ]);
   for(int32_t k = dlift->lstart; k <= dlift->lend; k++){
-    uint32_t c = modgbs->modpolys[k]->cf_32[coef[k]][modgbs->nprimes  - 1 ];
+    uint32_t c = modgbs->modpolys[k]->cf_32[(uint64_t)(modgbs->nprimes - 1)
+                                            * modgbs->modpolys[k]->len + coef[k]];
     mpz_CRT_ui(dlift->crt[k], dlift->crt[k], mod_p[0],
                c, modgbs->primes[modgbs->nprimes - 1 ],
                prod_p[0], dlift->tmp, 1);
@@ -840,15 +1272,20 @@ static inline void incremental_dlift_crt_full(gb_modpoly_t modgbs, data_lift_t d
                                               int32_t *coef, mpz_t mod_p, mpz_t prod_p,
                                               int thrds){
 
-  uint64_t newprime = modgbs->primes[modgbs->nprimes - 1 ];
-  /* all primes are assumed to be good primes */
-  mpz_mul_ui(prod_p, mod_p, (uint32_t)newprime);
-  for(int32_t k = 0; k < dl->end; k++){
-      uint64_t c = modgbs->modpolys[k]->cf_32[coef[k]][modgbs->nprimes  - 1 ];
-      mpz_CRT_ui(dl->crt[k], dl->crt[k], mod_p,
-                 c, newprime, prod_p, dl->tmp, 1);
+  /* the last thrds primes are new, all primes are assumed to be good */
+  for(int i = 0; i < thrds; i++){
+    const uint32_t np = modgbs->nprimes - (thrds - i);
+    uint64_t newprime = modgbs->primes[np];
+    mpz_mul_ui(prod_p, mod_p, (uint32_t)newprime);
+    /* polynomials below dl->S are lifted and verified */
+    for(int32_t k = dl->S; k < dl->end; k++){
+        uint64_t c = modgbs->modpolys[k]->cf_32[(uint64_t)np
+                                                * modgbs->modpolys[k]->len + coef[k]];
+        mpz_CRT_ui(dl->crt[k], dl->crt[k], mod_p,
+                   c, newprime, prod_p, dl->tmp, 1);
+    }
+    mpz_set(mod_p, prod_p);
   }
-  mpz_set(mod_p, prod_p);
 }
 
 
@@ -867,9 +1304,10 @@ static inline void crt_lift_modgbs(gb_modpoly_t modgbs, data_lift_t dlift,
 
   for(int32_t k = start; k < end; k++){
     if(dlift->check1[k] >= 1){
+      const uint64_t len = polys[k]->len;
       for(int32_t l = 0; l < polys[k]->len; l++){
         for(uint32_t i = 0; i < modgbs->nprimes-1; i++){
-          modgbs->cf_64[i] = polys[k]->cf_32[l][i];
+          modgbs->cf_64[i] = polys[k]->cf_32[i*len + l];
         }
         fmpz_multi_CRT_ui(y, modgbs->cf_64,
                           comb, comb_temp, 1);
@@ -989,7 +1427,8 @@ static inline int verif_lifted_basis(gb_modpoly_t modgbs, data_lift_t dl,
         uint32_t prime = modgbs->primes[modgbs->nprimes - (thrds - i) ];
         for(int32_t c = 0; c < modgbs->modpolys[k]->len; c++){
           mpz_mul(den, modgbs->modpolys[k]->lm, modgbs->modpolys[k]->cf_qq[2*c+1]);
-          uint32_t coef = modgbs->modpolys[k]->cf_32[c][modgbs->nprimes   - (thrds - i) ];
+          uint32_t coef = modgbs->modpolys[k]->cf_32[(uint64_t)(modgbs->nprimes - (thrds - i))
+                                                     * modgbs->modpolys[k]->len + c];
           int b = verif_coef(modgbs->modpolys[k]->cf_qq[2*c], den, prime, coef);
           if(!b){
             dl->check2[k] = 0;
@@ -1017,7 +1456,8 @@ static inline int verif_lifted_rational_wcoef(gb_modpoly_t modgbs, data_lift_t d
     for(int i = 0; i < thrds; i++){
 
       uint32_t prime = modgbs->primes[modgbs->nprimes - (thrds - i) ];
-      uint32_t coef = modgbs->modpolys[k]->cf_32[dl->coef[k]][modgbs->nprimes  - (thrds - i) ];
+      uint32_t coef = modgbs->modpolys[k]->cf_32[(uint64_t)(modgbs->nprimes - (thrds - i))
+                                                 * modgbs->modpolys[k]->len + dl->coef[k]];
       int boo = verif_coef(dl->num[k], dl->den[k], prime, coef);
 
       if(!boo){
@@ -1103,7 +1543,9 @@ static void ratrecon_gb(gb_modpoly_t modgbs, data_lift_t dl,
   set_recdata(dl, recdata1, recdata2, mod_p);
 
   st = realtime();
-  if(modgbs->nprimes % dl->rr == 0){
+  /* rational reconstruction is done every dl->rr primes, thrds new primes
+   * may have been added at once */
+  if(modgbs->nprimes / dl->rr != (modgbs->nprimes - thrds) / dl->rr){
     for(int32_t i = dl->lstart; i < dl->lend; i++){
       int b = reconstructcoeff(dl, i, mod_p,
                                recdata1, recdata2);
@@ -1120,6 +1562,20 @@ static void ratrecon_gb(gb_modpoly_t modgbs, data_lift_t dl,
 
 }
 
+/* returns 1 if prime divides a coefficient of the input generators, of
+ * the saturation elements or of the elements to be reduced, see
+ * is_lucky_prime_ui() */
+static inline int is_lucky_prime_mstrace(const uint32_t prime,
+                                         const mstrace_t msd){
+  if(is_lucky_prime_ui(prime, msd->bs_qq)){
+    return 1;
+  }
+  if(msd->tbr_qq != NULL && is_lucky_prime_ui(prime, msd->tbr_qq)){
+    return 1;
+  }
+  return msd->sat_qq != NULL && is_lucky_prime_ui(prime, msd->sat_qq);
+}
+
 long max_bit_size_gb(gb_modpoly_t modgbs){
   long nb = 0;
   for(uint32_t i = 0; i < modgbs->ld; i++){
@@ -1134,6 +1590,201 @@ long max_bit_size_gb(gb_modpoly_t modgbs){
 
 
 
+/* writes the state of the multi-modular loop of msolve_gbtrace_qq in the
+ * checkpoint fn: the prime used for learning, the last prime used, the
+ * residues of the polynomials which are not lifted and verified yet, the
+ * lifted coefficients, the lifting data dl and the current modulus mod_p */
+static void gbtrace_checkpoint_save(const char *fn,
+                                    const uint32_t primeinit,
+                                    const uint32_t prime,
+                                    const int nprimes,
+                                    const uint32_t nbadprimes,
+                                    gb_modpoly_t modgbs,
+                                    data_lift_t dl,
+                                    mpz_t mod_p){
+  FILE *file = checkpoint_write_open(fn, "gbtrace");
+  if(file == NULL){
+    return;
+  }
+  fprintf(file, "%u\n%u\n%d\n%u\n", primeinit, prime, nprimes, nbadprimes);
+  fprintf(file, "%u\n%d\n%u\n", modgbs->ld, modgbs->nv, modgbs->nprimes);
+  for(uint32_t i = 0; i < modgbs->nprimes; i++){
+    fprintf(file, "%lu\n", (unsigned long)modgbs->primes[i]);
+  }
+  for(uint32_t i = 0; i < modgbs->ld; i++){
+    fprintf(file, "%u\n", modgbs->modpolys[i]->len);
+  }
+  fwrite(modgbs->ldm, sizeof(int32_t), (size_t)modgbs->nv * modgbs->ld, file);
+  fprintf(file, "\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n%d\n",
+          dl->npol, dl->nsteps, dl->rr, dl->cstep, dl->lstart, dl->lend,
+          dl->recon, dl->start, dl->end, dl->S);
+  fwrite(dl->coef, sizeof(int32_t), dl->npol, file);
+  fwrite(dl->check1, sizeof(int), dl->npol, file);
+  fwrite(dl->check2, sizeof(int), dl->npol, file);
+  for(uint32_t i = dl->S; i < modgbs->ld; i++){
+    fwrite(modgbs->modpolys[i]->cf_32, sizeof(uint32_t),
+           (size_t)modgbs->nprimes * modgbs->modpolys[i]->len, file);
+  }
+  fprintf(file, "\n");
+
+  mpz_out_raw(file, mod_p);
+  mpz_out_raw(file, dl->gden);
+  checkpoint_out_mpz_array(file, dl->crt, dl->npol);
+  checkpoint_out_mpz_array(file, dl->num, dl->npol);
+  checkpoint_out_mpz_array(file, dl->den, dl->npol);
+  for(uint32_t i = 0; i < modgbs->ld; i++){
+    mpz_out_raw(file, modgbs->modpolys[i]->lm);
+    checkpoint_out_mpz_array(file, modgbs->modpolys[i]->cf_qq,
+                             2 * modgbs->modpolys[i]->len);
+  }
+
+  checkpoint_write_close(file, fn);
+}
+
+/* restores the state saved by gbtrace_checkpoint_save, the learning phase
+ * has been redone with primeinit, hence modgbs only stores the residues
+ * modulo primeinit and dl is freshly initialized.
+ * returns 0 if the checkpoint does not match this computation, in which
+ * case the state of the computation is left unchanged */
+static int gbtrace_checkpoint_load(const char *fn,
+                                   const uint32_t primeinit,
+                                   uint32_t *prime,
+                                   int *nprimes,
+                                   uint32_t *nbadprimes,
+                                   gb_modpoly_t modgbs,
+                                   data_lift_t dl,
+                                   mpz_t mod_p,
+                                   const int info_level){
+  FILE *file = checkpoint_read_open(fn, "gbtrace");
+  if(file == NULL){
+    return 0;
+  }
+  uint32_t p0 = 0, p = 0, nbp = 0, ld = 0, np = 0;
+  int ntries = 0, nv = 0;
+  int b = (fscanf(file, "%u\n%u\n%d\n%u\n", &p0, &p, &ntries, &nbp) == 4)
+    && (fscanf(file, "%u\n%d\n%u\n", &ld, &nv, &np) == 3);
+  b = b && p0 == primeinit && ld == modgbs->ld && nv == modgbs->nv && np > 0;
+
+  uint64_t *primes = calloc(np > 0 ? np : 1, sizeof(uint64_t));
+  for(uint32_t i = 0; b && i < np; i++){
+    unsigned long q;
+    b = (fscanf(file, "%lu\n", &q) == 1);
+    primes[i] = q;
+  }
+  b = b && primes[0] == primeinit;
+  /* binary data follow a single newline, which is read with fgetc since
+   * a blank in a scanf format could swallow some of their bytes */
+  for(uint32_t i = 0; b && i < ld; i++){
+    uint32_t len;
+    b = (fscanf(file, "%u", &len) == 1) && len == modgbs->modpolys[i]->len;
+  }
+  b = b && fgetc(file) == '\n';
+  int32_t *ldm = NULL;
+  if(b){
+    ldm = malloc(sizeof(int32_t) * nv * ld);
+    b = fread(ldm, sizeof(int32_t), (size_t)nv * ld, file) == (size_t)nv * ld
+      && memcmp(ldm, modgbs->ldm, sizeof(int32_t) * nv * ld) == 0;
+    free(ldm);
+  }
+  int32_t d[10];
+  b = b && (fscanf(file, "%d%d%d%d%d%d%d%d%d%d",
+                   d, d + 1, d + 2, d + 3, d + 4, d + 5, d + 6, d + 7, d + 8,
+                   d + 9) == 10) && fgetc(file) == '\n';
+  b = b && d[0] == dl->npol && d[1] == dl->nsteps && d[9] >= 0 && (uint32_t)d[9] <= ld;
+
+  int32_t *coef = NULL;
+  int *check1 = NULL, *check2 = NULL;
+  if(b){
+    coef = malloc(sizeof(int32_t) * dl->npol);
+    check1 = malloc(sizeof(int) * dl->npol);
+    check2 = malloc(sizeof(int) * dl->npol);
+    b = fread(coef, sizeof(int32_t), dl->npol, file) == (size_t)dl->npol
+      && fread(check1, sizeof(int), dl->npol, file) == (size_t)dl->npol
+      && fread(check2, sizeof(int), dl->npol, file) == (size_t)dl->npol;
+  }
+  if(b){
+    /* room for the saved residues and the next primes, polynomials of
+     * index < S are discarded below */
+    gb_modpoly_realloc(modgbs, np, 0);
+  }
+  /* the residues modulo primeinit have been computed again during the
+   * learning phase, they have to agree with the saved ones */
+  for(uint32_t i = (b ? (uint32_t)d[9] : ld); i < ld; i++){
+    const uint64_t len = modgbs->modpolys[i]->len;
+    if(len == 0){
+      continue;
+    }
+    uint32_t *cf = malloc(sizeof(uint32_t) * len);
+    b = fread(cf, sizeof(uint32_t), len, file) == len
+      && memcmp(cf, modgbs->modpolys[i]->cf_32, sizeof(uint32_t) * len) == 0;
+    free(cf);
+    if(!b){
+      break;
+    }
+    b = fread(modgbs->modpolys[i]->cf_32 + len, sizeof(uint32_t),
+              (np - 1) * len, file) == (np - 1) * len;
+    if(!b){
+      break;
+    }
+  }
+  if(!b){
+    fprintf(stderr, "Checkpoint %s does not match this computation, ", fn);
+    fprintf(stderr, "it is ignored\n");
+    free(primes);
+    free(coef);
+    free(check1);
+    free(check2);
+    fclose(file);
+    return 0;
+  }
+
+  b = fgetc(file) == '\n' && mpz_inp_raw(mod_p, file)
+    && mpz_inp_raw(dl->gden, file)
+    && checkpoint_inp_mpz_array(file, dl->crt, dl->npol)
+    && checkpoint_inp_mpz_array(file, dl->num, dl->npol)
+    && checkpoint_inp_mpz_array(file, dl->den, dl->npol);
+  for(uint32_t i = 0; b && i < ld; i++){
+    b = mpz_inp_raw(modgbs->modpolys[i]->lm, file)
+      && checkpoint_inp_mpz_array(file, modgbs->modpolys[i]->cf_qq,
+                                  2 * modgbs->modpolys[i]->len);
+  }
+  fclose(file);
+  if(!b){
+    fprintf(stderr, "Checkpoint %s is corrupted, remove it and restart\n", fn);
+    exit(1);
+  }
+
+  for(uint32_t i = 0; i < np; i++){
+    modgbs->primes[i] = primes[i];
+  }
+  modgbs->nprimes = np;
+  free(primes);
+  dl->rr = d[2];
+  dl->cstep = d[3];
+  dl->lstart = d[4];
+  dl->lend = d[5];
+  dl->recon = d[6];
+  dl->start = d[7];
+  dl->end = d[8];
+  dl->S = d[9];
+  free(dl->coef);
+  free(dl->check1);
+  free(dl->check2);
+  dl->coef = coef;
+  dl->check1 = check1;
+  dl->check2 = check2;
+  for(int32_t i = 0; i < dl->S; i++){
+    gb_modpoly_discard(modgbs, i);
+  }
+  *prime = p;
+  *nprimes = ntries;
+  *nbadprimes = nbp;
+  if(info_level){
+    fprintf(stderr, "Resumes from checkpoint %s (%d primes)\n", fn, ntries);
+  }
+  return 1;
+}
+
 /*
 
   - returns 0 if the computation went ok 
@@ -1179,7 +1830,9 @@ int msolve_gbtrace_qq(
   int32_t nr_vars = gens->nvars;
   int32_t nr_gens = gens->ngens;
   int reduce_gb = 1;
-  int32_t nr_nf = 0;
+  /* the last flags->saturate generators are the saturation elements,
+   * the last flags->normal_form ones are the elements to be reduced */
+  int32_t nr_nf = flags->saturate + flags->normal_form;
   const uint32_t prime_start = pow(2, 30);
 
   /* initialize stuff */
@@ -1210,6 +1863,9 @@ int msolve_gbtrace_qq(
     free(st);
     return -3;
   }
+  set_memory_budget(st, flags->mem_budget);
+  set_spa_min_ncols(st, flags->spa_min_ncols);
+  set_out_of_core_dir(st, files != NULL ? files->ooc_dir : NULL);
 
   mstrace_t msd;
   initialize_mstrace(msd, st);
@@ -1227,7 +1883,26 @@ int msolve_gbtrace_qq(
 
   /* sort initial elements, smallest lead term first */
   sort_r(msd->bs_qq->hm, (unsigned long)msd->bs_qq->ld, sizeof(hm_t *),
-          initial_input_cmp, msd->bht);
+          st->fp.initial_input_cmp, msd->bht);
+
+  if(nr_nf > 0){
+    bs_t *ex_qq = initialize_basis(st);
+    /* extra elements live in the hash table of the input basis */
+    full_free_hash_table(&(ex_qq->ht));
+    ex_qq->ht = msd->bht;
+    import_input_data(ex_qq, st, gens->ngens - nr_nf, gens->ngens,
+                      gens->lens, gens->exps, cfs, NULL);
+    ex_qq->ld = ex_qq->lml = nr_nf;
+    for(int32_t i = 0; i < nr_nf; i++){
+      ex_qq->lmps[i] = i;
+    }
+    if(flags->normal_form > 0){
+      msd->tbr_qq = ex_qq;
+    }
+    else{
+      msd->sat_qq = ex_qq;
+    }
+  }
 
   if(gens->field_char == 0){
     remove_content_of_initial_basis(msd->bs_qq);
@@ -1238,17 +1913,26 @@ int msolve_gbtrace_qq(
     msd->lp->old = 0;
     msd->lp->ld = 1;
     msd->lp->p = calloc(1, sizeof(uint32_t));
-    normalize_initial_basis(msd->bs_qq, st->gfc);
+    st->fp.normalize_initial_basis(msd->bs_qq, st->gfc);
   }
 
   uint32_t prime = 0;
   uint32_t primeinit = 0;
   uint32_t lprime = 1303905299;
-  srand(time(0));
 
-  prime = next_prime(rand() % (1303905301 - (1<<30) + 1) + (1<<30));
-  while(gens->field_char==0 && is_lucky_prime_ui(prime, msd->bs_qq)){
-    prime = next_prime(rand() % (1303905301 - (1<<30) + 1) + (1<<30));
+  prime = next_prime(random_number() % (1303905301 - (1<<30) + 1) + (1<<30));
+  while(gens->field_char==0 && is_lucky_prime_mstrace(prime, msd)){
+    prime = next_prime(random_number() % (1303905301 - (1<<30) + 1) + (1<<30));
+  }
+  /* a computation resumed from a checkpoint redoes the learning phase with
+   * the same prime */
+  const char *ckpt = (files != NULL && gens->field_char == 0) ?
+    files->checkpoint_file : NULL;
+  int resume = 0;
+  if(ckpt != NULL && checkpoint_read_prime(ckpt, "gbtrace", &primeinit)
+     && !is_lucky_prime_mstrace(primeinit, msd)){
+    prime = primeinit;
+    resume = 1;
   }
 
   primeinit = prime;
@@ -1279,22 +1963,36 @@ int msolve_gbtrace_qq(
 
   uint32_t nbadprimes = 0;
 
+  /* becomes 1 once ckpt holds a checkpoint of this computation */
+  int ckpt_done = 0;
+
   while(learn){
 
-    int32_t *lmb_ori = gb_modular_trace_learning(modgbs,
-                                                 msd->mgb,
-                                                 msd->num_gb, msd->leadmons_ori,
-                                                 msd->btrace[0],
-                                                 msd->tht, msd->bs_qq, msd->bht, st,
-                                                 msd->lp->p[0],
-                                                 info_level,
-                                                 print_gb,
-                                                 truncate_lifting,
-                                                 dim_ptr, dquot_ptr,
-                                                 0,
-                                                 gens, maxbitsize,
-                                                 files,
-                                                 &success);
+    int32_t *lmb_ori = NULL;
+    if(msd->tbr_qq != NULL){
+      lmb_ori = nf_modular_trace_learning(modgbs, msd->mgb,
+                                          msd->num_gb, msd->leadmons_ori,
+                                          msd->bs_qq, msd->tbr_qq, st,
+                                          msd->lp->p[0], info_level,
+                                          dquot_ptr);
+    }
+    else{
+      lmb_ori = gb_modular_trace_learning(modgbs,
+                                          msd->mgb,
+                                          msd->num_gb, msd->leadmons_ori,
+                                          msd->btrace[0],
+                                          msd->tht, msd->bs_qq, msd->sat_qq,
+                                          msd->bht, st,
+                                          msd->lp->p[0],
+                                          info_level,
+                                          print_gb,
+                                          truncate_lifting,
+                                          dim_ptr, dquot_ptr,
+                                          0,
+                                          gens, maxbitsize,
+                                          files,
+                                          &success);
+    }
     /*lmb_ori can be NULL when gb = [1]*/
     if(lmb_ori == NULL || print_gb == 1){
       if(dlinit){
@@ -1310,12 +2008,27 @@ int msolve_gbtrace_qq(
 
     apply = 1;
 
-    gb_modpoly_realloc(modgbs, 1, dlift->S);
+    /* dlift is not initialized yet, all polynomials are concerned */
+    gb_modpoly_realloc(modgbs, 1, 0);
 
 #ifdef DEBUGGBLIFT
     display_gbmodpoly_cf_32(stderr, modgbs);
 #endif
 
+    if(!dlinit && msd->tbr_qq != NULL){
+      /* normal forms are lifted all at once */
+      int32_t ldeg = modgbs->ld;
+      data_lift_init(dlift, modgbs->ld, &ldeg, 1);
+      choose_coef_to_lift(modgbs, dlift);
+      /* normal forms are not monic, their leading coefficient is used
+       * when all other coefficients vanish */
+      for(int32_t i = 0; i < modgbs->ld; i++){
+        if(modgbs->modpolys[i]->cf_32[dlift->coef[i]] == 0){
+          dlift->coef[i] = modgbs->modpolys[i]->len - 1;
+        }
+      }
+      dlinit = 1;
+    }
     if(!dlinit){
       int nb = 0;
       int32_t *ldeg = array_nbdegrees((*msd->leadmons_ori), msd->num_gb[0],
@@ -1353,6 +2066,10 @@ int msolve_gbtrace_qq(
 
       free(st);
       fprintf(stderr, "Something went wrong in the learning phase, msolve restarts.");
+      if(resume){
+        /* else the restarted computation would use the same prime */
+        remove(ckpt);
+      }
       return msolve_gbtrace_qq(modgbs, gens, flags);
 
     }
@@ -1361,18 +2078,23 @@ int msolve_gbtrace_qq(
                                    msd->leadmons_ori, msd->leadmons_current,
                                    msd->btrace);
 
-    /* copy of hash tables for tracer application */
+    /* the tracer application works on copies of msd->bht sharing its
+     * exponents (see copy_basis_mod_p()), no further copies are needed */
     msd->blht[0] = msd->bht;
-    for(int i = 1; i < st->nthrds; i++){
-      ht_t *lht = copy_hash_table(msd->bht);
-      msd->blht[i] = lht;
-    }
 
     if(info_level){
       fprintf(stderr, "\nStarts multi-modular computations\n");
     }
 
     learn = 0;
+    if(resume && gbtrace_checkpoint_load(ckpt, primeinit, &prime, &nprimes,
+                                         &nbadprimes, modgbs, dlift,
+                                         msd->mod_p, info_level)){
+      ckpt_done = 1;
+    }
+    /* time of the last checkpoint */
+    double ckpt_t = realtime();
+    const double ckpt_delay = files->checkpoint_delay;
     while(apply){
 
       prime = next_prime(prime);
@@ -1381,21 +2103,21 @@ int msolve_gbtrace_qq(
       }
       /* generate lucky prime numbers */
       msd->lp->p[0] = prime;
-      while(is_lucky_prime_ui(prime, msd->bs_qq) || prime==primeinit){
+      while(is_lucky_prime_mstrace(prime, msd) || prime==primeinit){
         prime = next_prime(prime);
         if(prime >= lprime){
           prime = next_prime(1<<30);
         }
         msd->lp->p[0] = prime;
       }
-      int nthrds = 1; /* mono-threaded mult-mid comp */
-      for(len_t i = 1; i < nthrds/* st->nthrds */; i++){
+      const int nthrds = st->nthrds; /* one prime per thread */
+      for(len_t i = 1; i < nthrds; i++){
         prime = next_prime(prime);
         if(prime >= lprime){
           prime = next_prime(1<<30);
         }
         msd->lp->p[i] = prime;
-        while(is_lucky_prime_ui(prime, msd->bs_qq) || prime==primeinit){
+        while(is_lucky_prime_mstrace(prime, msd) || prime==primeinit){
           prime = next_prime(prime);
           if(prime >= lprime){
             prime = next_prime(1<<30);
@@ -1403,26 +2125,37 @@ int msolve_gbtrace_qq(
           msd->lp->p[i] = prime;
         }
       }
-      prime = msd->lp->p[nthrds /* st->nthrds */ - 1];
+      prime = msd->lp->p[nthrds - 1];
 
-      if(modgbs->alloc <= nprimes + 2){
+      if(modgbs->alloc <= nprimes + nthrds + 2){
         gb_modpoly_realloc(modgbs, 16*st->nthrds, dlift->S);
       }
 
-      gb_modular_trace_application(modgbs, msd->mgb,
-                                   msd->num_gb,
-                                   msd->leadmons_ori,
-                                   msd->leadmons_current,
-                                   msd->btrace,
-                                   msd->btht, msd->bs_qq, msd->blht, st,
-                                   field_char, 0, /* info_level, */
-                                   msd->bs, lmb_ori, *dquot_ptr, msd->lp,
-                                   dlift->S, gens, &stf4, msd->bad_primes);
+      if(msd->tbr_qq != NULL){
+        nf_modular_trace_application(modgbs, msd->mgb,
+                                     msd->num_gb,
+                                     msd->leadmons_ori,
+                                     msd->leadmons_current,
+                                     msd->bs_qq, msd->tbr_qq, st,
+                                     msd->bs, lmb_ori, *dquot_ptr, msd->lp,
+                                     dlift->S, &stf4, msd->bad_primes);
+      }
+      else{
+        gb_modular_trace_application(modgbs, msd->mgb,
+                                     msd->num_gb,
+                                     msd->leadmons_ori,
+                                     msd->leadmons_current,
+                                     msd->btrace,
+                                     msd->btht, msd->bs_qq, msd->sat_qq,
+                                     msd->blht, st,
+                                     field_char, 0, /* info_level, */
+                                     msd->bs, lmb_ori, *dquot_ptr, msd->lp,
+                                     dlift->S, gens, &stf4, msd->bad_primes);
+      }
 
 
-      /* nprimes += st->nthrds; */
-      nprimes += 1; /* at the moment, multi-mod comp is mono-threaded */
-      if(nprimes == 1){
+      nprimes += nthrds;
+      if(nprimes == nthrds){
         if(info_level>2){
           fprintf(stderr, "------------------------------------------\n");
           fprintf(stderr, "#ADDITIONS       %13lu\n", (unsigned long)st->application_nr_add * 1000);
@@ -1436,16 +2169,30 @@ int msolve_gbtrace_qq(
           fprintf(stderr, "Elapsed time: %.2f\n", stf4);
         }
       }
-      int bad = 0;
-      for(int i = 0; i < nthrds/* st->nthrds */; i++){
-        if(msd->bad_primes[i] == 1){
-          bad = 1;
+      int ngood = 0;
+      int unlucky = 0;
+      for(int i = 0; i < nthrds; i++){
+        if(msd->bad_primes[i] > 0){
           nbadprimes++;
+          unlucky = unlucky || msd->bad_primes[i] == 2;
+        }
+        else{
+          ngood++;
         }
       }
 
-      if(nbadprimes == nprimes){
-        fprintf(stderr, "Too many bad primes, computation will restart\n");
+      if(nbadprimes == nprimes || unlucky){
+        if(unlucky){
+          fprintf(stderr, "Unlucky learning prime for normal forms, ");
+          fprintf(stderr, "computation will restart\n");
+        }
+        else{
+          fprintf(stderr, "Too many bad primes, computation will restart\n");
+        }
+        if(resume || ckpt_done){
+          /* else the restarted computation would resume from it */
+          remove(ckpt);
+        }
         free_mstrace(msd, st);
         if(dlinit){
           data_lift_clear(dlift);
@@ -1463,9 +2210,9 @@ int msolve_gbtrace_qq(
       double ost_rrec = st_rrec;
       double ost_crt = st_crt;
 
-      if(!bad){
+      if(ngood > 0){
         ratrecon_gb(modgbs, dlift, msd->mod_p, msd->prod_p, recdata1, recdata2,
-                    nthrds/* st->nthrds */, &st_crt, &st_rrec);
+                    ngood, &st_crt, &st_rrec);
       }
       if((st_crt -ost_crt) + (st_rrec - ost_rrec) > dlift->rr * stf4){
         dlift->rr = 2*dlift->rr;
@@ -1474,10 +2221,18 @@ int msolve_gbtrace_qq(
         }
       }
       if(info_level){
-        if(!(nprimes & (nprimes - 1))){
+        /* a power of two has been reached */
+        if((nprimes ^ (nprimes - nthrds)) > (nprimes - nthrds)){
           fprintf(stderr, "{%d}", nprimes);
         }
       }
+      /* residues of lifted and verified polynomials are not needed
+       * anymore, from now on they are not stored (see modpgbs_set) */
+      while(dlift->S < modgbs->ld && dlift->S < dlift->lstart
+            && dlift->check2[dlift->S] >= NBCHECK){
+        gb_modpoly_discard(modgbs, dlift->S);
+        dlift->S++;
+      }
       apply = 0;
       for(len_t i = 0; i < modgbs->ld; i++){
         if(dlift->check2[i] < NBCHECK){
@@ -1491,10 +2246,22 @@ int msolve_gbtrace_qq(
         }
         lstart = dlift->lstart;
       }
+      if(ckpt != NULL && apply && realtime() - ckpt_t >= ckpt_delay){
+        gbtrace_checkpoint_save(ckpt, primeinit, prime, nprimes, nbadprimes,
+                                modgbs, dlift, msd->mod_p);
+        if(info_level){
+          fprintf(stderr, "<ckpt>");
+        }
+        ckpt_t = realtime();
+        ckpt_done = 1;
+      }
       /* this is where learn could be reset to 1 */
       /* but then duplicated datas and others should be free-ed */
     }
   }
+  if(ckpt_done){
+    remove(ckpt);
+  }
   if(info_level){
     fprintf(stderr, "\nCRT time = %.2f, Rational reconstruction time = %.2f\n", st_crt, st_rrec);
   }
@@ -1526,6 +2293,19 @@ void print_msolve_gbtrace_qq(data_gens_ff_t *gens,
 
   msolve_gbtrace_qq(modgbs, gens, flags);
 
+  if(flags->normal_form > 0){
+    if(flags->files->out_file != NULL){
+      FILE *ofile = fopen(flags->files->out_file, "w+");
+      display_nfmodpoly_cf_qq(ofile, modgbs, gens, flags->normal_form);
+      fclose(ofile);
+    }
+    else{
+      display_nfmodpoly_cf_qq(stdout, modgbs, gens, flags->normal_form);
+    }
+    gb_modpoly_clear(modgbs);
+    return;
+  }
+
   FILE *ofile;
   if (flags->files->out_file != NULL) {
     ofile = fopen(flags->files->out_file, "w+");
@@ -24,6 +24,11 @@
 #define DEBUGBUILDMATRIX 0
 #define IO_DEBUG 0
 
+/* batch mode: initial hash table size (as power of two) if -s is not given,
+ * and number of input systems read and solved at once */
+#define BATCH_INITIAL_HTS 12
+#define BATCH_CHUNK_SIZE 1024
+
 static inline void display_help(char *str){
   fprintf(stdout, "\nmsolve library for polynomial system solving, version %s\n", VERSION);
   fprintf(stdout, "implemented by J. Berthomieu, C. Eder, M. Safey El Din\n");
@@ -63,7 +68,52 @@ static inline void display_help(char *str){
 
 
   fprintf(stdout, "\nAdvanced options:\n\n");
-  fprintf(stdout, "-F FILE  File name encoding parametrizations in binary format.\n\n");
+  fprintf(stdout, "-A NC    Very sparse F4 matrices with at least NC columns\n");
+  fprintf(stdout, "         are reduced with sparse accumulators instead of\n");
+  fprintf(stdout, "         dense rows, 0 uses them for all matrices.\n");
+  fprintf(stdout, "         Default: %d.\n", SPA_MIN_NCOLS);
+  fprintf(stdout, "-b FILE  Batch mode: FILE contains several input systems\n");
+  fprintf(stdout, "         (in the above format) separated by empty lines.\n");
+  fprintf(stdout, "         They are solved in one process, THR systems in\n");
+  fprintf(stdout, "         parallel, each of them using one thread. The\n");
+  fprintf(stdout, "         results are written in the order of the input\n");
+  fprintf(stdout, "         systems. The default initial hash table size is\n");
+  fprintf(stdout, "         2^%d in batch mode (see -s), each thread reuses\n", BATCH_INITIAL_HTS);
+  fprintf(stdout, "         the hash table memory of its previous systems,\n");
+  fprintf(stdout, "         matrices and bases are allocated for each system.\n");
+  fprintf(stdout, "         The random choices for the i-th system are seeded\n");
+  fprintf(stdout, "         with i, so the results do not depend on THR.\n");
+  fprintf(stdout, "-B MB    Memory budget in megabytes for a single F4 matrix,\n");
+  fprintf(stdout, "         pairs of larger selections are postponed to the\n");
+  fprintf(stdout, "         next round. -1 switches the budget off.\n");
+  fprintf(stdout, "         Primes computed in parallel and systems solved\n");
+  fprintf(stdout, "         in parallel in batch mode share the budget.\n");
+  fprintf(stdout, "         Default: three quarters of the physical memory\n");
+  fprintf(stdout, "         available at the start of a computation.\n");
+  fprintf(stdout, "-D DIR   The F4 trace and the coefficients of redundant\n");
+  fprintf(stdout, "         basis elements are stored in temporary files in\n");
+  fprintf(stdout, "         DIR instead of in memory.\n");
+  fprintf(stdout, "-E NR    With at least NR real roots, the coordinates of\n");
+  fprintf(stdout, "         the real solutions are first computed for all\n");
+  fprintf(stdout, "         roots at once by fast multipoint evaluation.\n");
+  fprintf(stdout, "         Default: %d.\n", BATCH_EXTRACT_MIN_ROOTS);
+  fprintf(stdout, "-F FILE  File name encoding parametrizations in binary format.\n");
+  fprintf(stdout, "         Without -f, the real solutions stored in FILE by -O\n");
+  fprintf(stdout, "         are written (see also -R).\n");
+  fprintf(stdout, "-O FILE  Name of output file in binary format: for rational\n");
+  fprintf(stdout, "         coefficients the parametrization and real solutions\n");
+  fprintf(stdout, "         are written to FILE in the format read by -F, this\n");
+  fprintf(stdout, "         is much faster than the decimal output for huge\n");
+  fprintf(stdout, "         coefficients. The usual output is not changed.\n");
+  fprintf(stdout, "-k FILE  Checkpoints multi-modular computations over the\n");
+  fprintf(stdout, "         rationals: their state is written to FILE from\n");
+  fprintf(stdout, "         time to time (see -K). If FILE holds a checkpoint\n");
+  fprintf(stdout, "         of the same computation, it is resumed from there\n");
+  fprintf(stdout, "         (the learning step with the first prime is done\n");
+  fprintf(stdout, "         again). FILE is removed when the computation is\n");
+  fprintf(stdout, "         over. Not available in batch mode.\n");
+  fprintf(stdout, "-K SEC   Minimal delay in seconds between two checkpoints\n");
+  fprintf(stdout, "         (see -k). Default: %d.\n\n", CHECKPOINT_DELAY);
   fprintf(stdout, "-g GB    Prints reduced Groebner bases of input system for\n");
   fprintf(stdout, "         first prime characteristic w.r.t. grevlex ordering.\n");
   fprintf(stdout, "         One element per line is printed, commata separated.\n");
@@ -104,6 +154,8 @@ static inline void display_help(char *str){
   fprintf(stdout, "-l LIN   Linear algebra variant to be applied:\n");
   fprintf(stdout, "          1 - exact sparse / dense\n");
   fprintf(stdout, "          2 - exact sparse (default)\n");
+  fprintf(stdout, "          3 - exact sparse, block-wise reduction of the\n");
+  fprintf(stdout, "              lower part (prime fields > 2^16)\n");
   fprintf(stdout, "         42 - sparse / dense linearization (probabilistic)\n");
   fprintf(stdout, "         44 - sparse linearization (probabilistic)\n");
   fprintf(stdout, "-m MPR   Maximal number of pairs used per matrix.\n");
@@ -111,7 +163,8 @@ static inline void display_help(char *str){
   fprintf(stdout, "-n NF    Given n input generators compute normal form of the last NF\n");
   fprintf(stdout, "         elements of the input w.r.t. a degree reverse lexicographical\n");
   fprintf(stdout, "         Gröbner basis of the irst (n - NF) input elements.\n");
-  fprintf(stdout, "         At the moment this only works for prime field computations.\n");
+  fprintf(stdout, "         Over the rationals, normal forms are lifted from their images\n");
+  fprintf(stdout, "         modulo several primes.\n");
   fprintf(stdout, "         Combining this option with the \"-i\" option assumes that the\n");
   fprintf(stdout, "         first (n - NF) elements generate already a degree reverse\n");
   fprintf(stdout, "         lexicographical Gröbner basis.\n");
@@ -122,11 +175,18 @@ static inline void display_help(char *str){
   fprintf(stdout, "         format please see the general output data format section\n");
   fprintf(stdout, "         above.\n");
   fprintf(stdout, "-q Q     Uses signature-based algorithms.\n");
+  fprintf(stdout, "         Only for homogeneous input over prime fields,\n");
+  fprintf(stdout, "         the Groebner basis is printed with -g.\n");
   fprintf(stdout, "         Default: 0 (no).\n");
   fprintf(stdout, "-r RED   Reduce Groebner basis.\n");
   fprintf(stdout, "         Default: 1 (yes).\n");
-  /* fprintf(stdout, "-R       Refinement fo real roots.\n"); */
-  /* fprintf(stdout, "         (not implemented yet).\n"); */
+  fprintf(stdout, "-R LIST  Refines the real roots of index in LIST (comma\n");
+  fprintf(stdout, "         separated, starting from 0, in the order of the\n");
+  fprintf(stdout, "         output) up to the precision given by -p, the other\n");
+  fprintf(stdout, "         ones being left unchanged. The binary file given\n");
+  fprintf(stdout, "         by -F has to be written by -O: its isolating\n");
+  fprintf(stdout, "         intervals are refined, the roots are not isolated\n");
+  fprintf(stdout, "         again. Using -O again writes the updated file.\n");
   fprintf(stdout, "-s HTS   Initial hash table size given\n");
   fprintf(stdout, "         as power of two. Default: 17.\n");
   fprintf(stdout, "-S       Use f4sat saturation algorithm:\n");
@@ -134,10 +194,25 @@ static inline void display_help(char *str){
   fprintf(stdout, "         compute the saturation of the ideal\n");
   fprintf(stdout, "         generated by the first k-1 polynomials\n");
   fprintf(stdout, "         with respect to the kth polynomial.\n");
-  fprintf(stdout, "-u UHT   Number of steps after which the\n");
-  fprintf(stdout, "         hash table is newly generated.\n");
-  fprintf(stdout, "         Default: 0, i.e. no update.\n");
+  fprintf(stdout, "         The Groebner basis of the saturation is printed\n");
+  fprintf(stdout, "         as given by -g; over the rationals it is printed\n");
+  fprintf(stdout, "         as for -g 2 if -g is not given.\n");
+  fprintf(stdout, "-u UHT   Number of F4 rounds after which the basis hash\n");
+  fprintf(stdout, "         table is compacted, i.e. newly generated with\n");
+  fprintf(stdout, "         only the monomials still in use.\n");
+  fprintf(stdout, "         Default: 0, i.e. the basis hash table is\n");
+  fprintf(stdout, "         compacted automatically once many of its\n");
+  fprintf(stdout, "         monomials are not used anymore.\n");
+  fprintf(stdout, "         Monomials of the input keep their position.\n");
+  fprintf(stdout, "         Tables are not compacted while a trace is\n");
+  fprintf(stdout, "         applied or stored out of core.\n");
   fprintf(stdout, "-V       Prints msolve's version\n");
+  fprintf(stdout, "-x EXT   SIMD extension used by the vector kernels,\n");
+  fprintf(stdout, "         e.g. for benchmarking:\n");
+  fprintf(stdout, "         0 - best one supported by the cpu (default)\n");
+  fprintf(stdout, "         1 - none, scalar kernels\n");
+  fprintf(stdout, "         2 - AVX2\n");
+  fprintf(stdout, "         3 - AVX-512\n");
 }
 
 static void getoptions(
@@ -162,18 +237,28 @@ static void getoptions(
         int32_t *is_gb,
         int32_t *get_param,
         int32_t *precision,
-        int32_t *refine,
+        int32_t *extract_min_roots,
+        char **refine,
         int32_t *isolate,
         int32_t *generate_pbm_files,
         int32_t *info_level,
+        int64_t *mem_budget,
+        int64_t *spa_min_ncols,
         files_gb *files){
-  int opt, errflag = 0, fflag = 1;
+  int opt, errflag = 0, fflag = 1, simd;
+  long long mb;
+  long nr;
+  char *end;
   char *filename = NULL;
   char *bin_filename = NULL;
   char *out_fname = NULL;
   char *bin_out_fname = NULL;
+  char *batch_fname = NULL;
+  char *ckpt_fname = NULL;
+  double ckpt_delay = CHECKPOINT_DELAY;
+  char *ooc_dname = NULL;
   opterr = 1;
-  char options[] = "hf:N:F:v:l:t:e:o:O:u:iI:p:P:q:g:c:s:SCr:R:m:M:n:d:Vf:";
+  char options[] = "hA:b:B:D:E:K:f:N:F:v:l:t:e:o:O:k:u:iI:p:P:q:g:c:s:SCr:R:m:M:n:d:Vx:f:";
   while((opt = getopt(argc, argv, options)) != -1) {
     switch(opt) {
     case 'N':
@@ -185,6 +270,40 @@ static void getoptions(
     case 'V':
       fprintf(stdout, "%s\n", VERSION);
       exit(0);
+    case 'A':
+      *spa_min_ncols = strtoll(optarg, &end, 10);
+      if (end == optarg || *end != '\0' || *spa_min_ncols < 0) {
+          fprintf(stderr, "Invalid number of columns %s, -A takes ", optarg);
+          fprintf(stderr, "a nonnegative number.\n");
+          exit(1);
+      }
+      break;
+    case 'E':
+      nr = strtol(optarg, &end, 10);
+      if (end == optarg || *end != '\0' || nr < 0 || nr > INT32_MAX) {
+          fprintf(stderr, "Invalid number of real roots %s, -E takes ", optarg);
+          fprintf(stderr, "a nonnegative number.\n");
+          exit(1);
+      }
+      *extract_min_roots = (int32_t)nr;
+      break;
+    case 'B':
+      mb = strtoll(optarg, &end, 10);
+      if (end == optarg || *end != '\0' || (mb < 1 && mb != -1)
+          || mb > INT64_MAX / 1048576) {
+          fprintf(stderr, "Invalid memory budget %s, -B takes a positive ", optarg);
+          fprintf(stderr, "number of megabytes or -1.\n");
+          exit(1);
+      }
+      *mem_budget = mb > 0 ? (int64_t)mb * 1048576 : -1;
+      break;
+    case 'x':
+      simd = strtol(optarg, NULL, 10);
+      if (set_simd_level(simd) != simd && simd != SIMD_AUTO) {
+          fprintf(stderr, "Warning: SIMD extension %d not supported, ", simd);
+          fprintf(stderr, "using %s kernels.\n", simd_level_name(simd_level()));
+      }
+      break;
     case 'e':
       *elim_block_len = strtol(optarg, NULL, 10);
       if (*elim_block_len < 0) {
@@ -213,7 +332,7 @@ static void getoptions(
       }
       break;
     case 'R':
-      *refine = 1;
+      *refine = optarg;
       break;
     case 'i':
       *is_gb = 1;
@@ -253,12 +372,30 @@ static void getoptions(
       fflag = 0;
       bin_filename = optarg;
       break;
+    case 'b':
+      fflag = 0;
+      batch_fname = optarg;
+      break;
     case 'o':
       out_fname = optarg;
       break;
     case 'O':
       bin_out_fname = optarg;
       break;
+    case 'k':
+      ckpt_fname = optarg;
+      break;
+    case 'D':
+      ooc_dname = optarg;
+      break;
+    case 'K':
+      ckpt_delay = strtod(optarg, &end);
+      if (end == optarg || *end != '\0' || !(ckpt_delay >= 0)) {
+          fprintf(stderr, "Invalid checkpoint delay %s, -K takes ", optarg);
+          fprintf(stderr, "a nonnegative number of seconds.\n");
+          exit(1);
+      }
+      break;
     case 'P':
       *get_param = strtol(optarg, NULL, 10);
       if (*get_param <= 0) {
@@ -326,8 +463,385 @@ static void getoptions(
   files->bin_file = bin_filename;
   files->out_file = out_fname;
   files->bin_out_file = bin_out_fname;
+  files->batch_file = batch_fname;
+  files->checkpoint_file = ckpt_fname;
+  files->checkpoint_delay = ckpt_delay;
+  files->ooc_dir = ooc_dname;
+}
+
+
+/* solves the input system stored in rec (of length len), the results are
+ * appended to files->out_file */
+static int solve_batch_system(
+        char *rec,
+        size_t len,
+        int32_t la_option,
+        int32_t use_signatures,
+        int32_t info_level,
+        int32_t initial_hts,
+        int32_t max_pairs,
+        int32_t elim_block_len,
+        int32_t update_ht,
+        int32_t generate_pbm,
+        int32_t reduce_gb,
+        int32_t print_gb,
+        int32_t truncate_lifting,
+        int32_t get_param,
+        int32_t genericity_handling,
+        int32_t unstable_staircase,
+        int32_t saturate,
+        int32_t colon,
+        int32_t normal_form,
+        int32_t normal_form_matrix,
+        int32_t is_gb,
+        int32_t precision,
+        int32_t extract_min_roots,
+        int64_t mem_budget,
+        int64_t spa_min_ncols,
+        files_gb *files)
+{
+    int32_t nr_vars     = 0;
+    int32_t field_char  = 9001;
+    int32_t nr_gens     = 0;
+    data_gens_ff_t *gens = allocate_data_gens();
+
+    FILE *fh  = fmemopen(rec, len, "r");
+    get_data_from_stream(fh, len+1, &nr_vars, &field_char, &nr_gens, gens);
+    fclose(fh);
+
+    gens->rand_linear           = 0;
+    gens->random_linear_form = malloc(sizeof(int32_t)*(nr_vars));
+    gens->elim = elim_block_len;
+
+    if(0 < field_char && field_char < pow(2, 15) && la_option > 2){
+      la_option = 2;
+    }
+
+    param_t *param  = NULL;
+    mpz_param_t *mpz_paramp = malloc(sizeof(mpz_param_t));
+    mpz_param_init(*mpz_paramp);
+
+    long nb_real_roots      = 0;
+    interval *real_roots    = NULL;
+    real_point_t *real_pts  = NULL;
+
+    int ret = core_msolve(la_option, use_signatures, 1, info_level,
+                          initial_hts, max_pairs, elim_block_len, update_ht,
+                          generate_pbm, reduce_gb, print_gb, truncate_lifting, get_param,
+                          genericity_handling, unstable_staircase, saturate, colon, normal_form,
+                          normal_form_matrix, is_gb, precision, extract_min_roots,
+                          mem_budget, spa_min_ncols, files, gens,
+            &param, mpz_paramp, &nb_real_roots, &real_roots, &real_pts);
+
+    free(param);
+    mpz_param_clear(*mpz_paramp);
+    free(mpz_paramp);
+
+    if (nb_real_roots > 0) {
+        for(long i = 0; i < nb_real_roots; i++){
+          real_point_clear(real_pts[i]);
+          mpz_clear(real_roots[i].numer);
+        }
+        free(real_pts);
+    }
+    free(real_roots);
+    free_data_gens(gens);
+
+    return ret;
 }
 
+/* batch mode: the systems of files->batch_file are read in chunks of
+ * BATCH_CHUNK_SIZE systems and solved in parallel by nr_threads threads,
+ * one thread per system. Each thread writes the results to its own
+ * temporary file, which is appended to the output (files->out_file
+ * resp. stdout) in the order of the input systems. Each thread keeps
+ * the storage of its freed hash tables for the next system, matrices
+ * and bases are not reused. The random number generator of the thread
+ * is seeded with the index of the system before solving it. */
+static int msolve_batch(
+        int32_t la_option,
+        int32_t use_signatures,
+        int32_t nr_threads,
+        int32_t info_level,
+        int32_t initial_hts,
+        int32_t max_pairs,
+        int32_t elim_block_len,
+        int32_t update_ht,
+        int32_t generate_pbm,
+        int32_t reduce_gb,
+        int32_t print_gb,
+        int32_t truncate_lifting,
+        int32_t get_param,
+        int32_t genericity_handling,
+        int32_t unstable_staircase,
+        int32_t saturate,
+        int32_t colon,
+        int32_t normal_form,
+        int32_t normal_form_matrix,
+        int32_t is_gb,
+        int32_t precision,
+        int32_t extract_min_roots,
+        int64_t mem_budget,
+        int64_t spa_min_ncols,
+        files_gb *files)
+{
+    long i;
+    int ret   = 0;
+    long nsys = 0;
+
+    FILE *bfh = fopen(files->batch_file, "r");
+    if (bfh == NULL) {
+        fprintf(stderr, "Batch file not found.\n");
+        exit(1);
+    }
+    FILE *ofh = stdout;
+    if (files->out_file != NULL) {
+        ofh = fopen(files->out_file, "a");
+    }
+    if (nr_threads < 1) {
+        nr_threads = 1;
+    }
+    /* the systems solved at the same time share the memory budget */
+    if (mem_budget == 0) {
+        mem_budget = memory_budget();
+    }
+    if (mem_budget > 0) {
+        mem_budget = mem_budget / nr_threads > 0 ? mem_budget / nr_threads : 1;
+    }
+
+    /* one temporary output file per thread */
+    const char *tmpdir = getenv("TMPDIR") != NULL ? getenv("TMPDIR") : "/tmp";
+    char **tmp_fn = (char **)malloc((unsigned long)nr_threads * sizeof(char *));
+    files_gb *tfiles = (files_gb *)calloc((unsigned long)nr_threads, sizeof(files_gb));
+    for (i = 0; i < nr_threads; ++i) {
+        tmp_fn[i] = (char *)malloc((strlen(tmpdir) + 32) * sizeof(char));
+        sprintf(tmp_fn[i], "%s/msolve-batch-XXXXXX", tmpdir);
+        int fd = mkstemp(tmp_fn[i]);
+        if (fd == -1) {
+            fprintf(stderr, "Cannot create temporary file in %s\n", tmpdir);
+            exit(1);
+        }
+        close(fd);
+        tfiles[i].out_file  = tmp_fn[i];
+        tfiles[i].ooc_dir   = files->ooc_dir;
+    }
+
+    /* the buffers storing the systems are kept for the next chunk */
+    char **recs   = (char **)calloc(BATCH_CHUNK_SIZE, sizeof(char *));
+    size_t *rsz   = (size_t *)calloc(BATCH_CHUNK_SIZE, sizeof(size_t));
+    size_t *rlen  = (size_t *)calloc(BATCH_CHUNK_SIZE, sizeof(size_t));
+
+    while (1) {
+        long nrec = 0;
+        while (nrec < BATCH_CHUNK_SIZE
+                && (rlen[nrec] = get_next_system_from_batch(
+                        bfh, &(recs[nrec]), &(rsz[nrec]))) > 0) {
+            nrec++;
+        }
+        if (nrec == 0) {
+            break;
+        }
+#pragma omp parallel for num_threads(nr_threads) schedule(dynamic) ordered
+        for (i = 0; i < nrec; ++i) {
+            int t = 0;
+#ifdef _OPENMP
+            t = omp_get_thread_num();
+#endif
+            FILE *tfh = fopen(tmp_fn[t], "w");
+            fclose(tfh);
+            /* hash table storage of the previous system is reused */
+            enable_hash_table_reuse();
+            /* the random choices of a system only depend on its index */
+            set_random_seed((uint32_t)(nsys + i + 1));
+            int r = solve_batch_system(recs[i], rlen[i], la_option,
+                    use_signatures, info_level, initial_hts, max_pairs,
+                    elim_block_len, update_ht, generate_pbm, reduce_gb,
+                    print_gb, truncate_lifting, get_param, genericity_handling,
+                    unstable_staircase, saturate, colon, normal_form,
+                    normal_form_matrix, is_gb, precision, extract_min_roots,
+                    mem_budget, spa_min_ncols, tfiles + t);
+#pragma omp ordered
+            {
+                if (r != 0) {
+                    if (info_level > 0) {
+                        fprintf(stderr, "Batch system %ld: msolve returned %d\n",
+                                nsys + i + 1, r);
+                    }
+                    if (ret == 0) {
+                        ret = r;
+                    }
+                }
+                char buf[BUFSIZ];
+                size_t n;
+                tfh = fopen(tmp_fn[t], "r");
+                while ((n = fread(buf, sizeof(char), BUFSIZ, tfh)) > 0) {
+                    fwrite(buf, sizeof(char), n, ofh);
+                }
+                fclose(tfh);
+                fflush(ofh);
+            }
+        }
+        nsys += nrec;
+    }
+#pragma omp parallel num_threads(nr_threads)
+    release_hash_table_storage();
+    if (info_level > 0) {
+        fprintf(stderr, "%ld systems solved in batch mode\n", nsys);
+    }
+
+    for (i = 0; i < BATCH_CHUNK_SIZE; ++i) {
+        free(recs[i]);
+    }
+    free(recs);
+    free(rsz);
+    free(rlen);
+    for (i = 0; i < nr_threads; ++i) {
+        unlink(tmp_fn[i]);
+        free(tmp_fn[i]);
+    }
+    free(tmp_fn);
+    free(tfiles);
+    if (ofh != stdout) {
+        fclose(ofh);
+    }
+    fclose(bfh);
+
+    return ret;
+}
+
+/* refine mode (-R): the real roots of index in sel (comma separated list)
+ * are refined up to precision, starting from the parametrization, the real
+ * points and the isolating intervals stored in files->bin_file (written
+ * with -O); the real points are then written as usual and, if -O is given,
+ * the updated binary file as well. With an empty list (-F without input
+ * file) the stored real points are written unchanged. */
+static int refine_real_roots_from_file(
+        char *sel,
+        int32_t precision,
+        int32_t extract_min_roots,
+        int32_t nr_threads,
+        int32_t info_level,
+        files_gb *files)
+{
+    long i, j;
+    FILE *bfh = files->bin_file != NULL ? fopen(files->bin_file, "rb") : NULL;
+    if (bfh == NULL) {
+        fprintf(stderr, "Binary input file not found (see -F).\n");
+        return 1;
+    }
+    int32_t nparams = 0;
+    if (fscanf(bfh, "%d\n", &nparams) != 1 || nparams != 1) {
+        fprintf(stderr, "Binary file should contain a single parametrization.\n");
+        fclose(bfh);
+        return 1;
+    }
+    mpz_param_t param;
+    mpz_param_init(param);
+    get_single_param_from_file_bin(bfh, param);
+
+    long nb_pts = 0, nb = 0;
+    int32_t lidx = -1;
+    real_point_t *pts = NULL;
+    interval *roots = NULL;
+    int ok = real_points_inp_raw(bfh, &pts, &nb_pts);
+    if (ok) {
+        ok = real_roots_inp_raw(bfh, &roots, &nb, &lidx) && nb == nb_pts;
+    }
+    fclose(bfh);
+
+    int ret = 1;
+    long nidx = 0;
+    long *idx = malloc(sizeof(long) * (strlen(sel) / 2 + 1));
+    char *ptr = sel, *end = NULL;
+    while (*ptr != '\0') {
+        idx[nidx++] = strtol(ptr, &end, 10);
+        if (end == ptr || (*end != ',' && *end != '\0')) {
+            fprintf(stderr, "Invalid list of real roots (-R): %s\n", sel);
+            ok = -1;
+            break;
+        }
+        ptr = *end == ',' ? end + 1 : end;
+    }
+    if (ok == 0) {
+        fprintf(stderr, "Binary file contains no isolating intervals ");
+        fprintf(stderr, "of the real roots (see -O).\n");
+    }
+    real_point_t *rpts = NULL;
+    if (ok == 1) {
+        /* refined points, in the order of the variables of param */
+        rpts = malloc(sizeof(real_point_t) * (nb + 1));
+        for (i = 0; i < nb; ++i) {
+            real_point_init(rpts[i], param->nvars);
+        }
+        ret = refine_real_roots_param(param, roots, nb, rpts, idx, nidx,
+                precision, extract_min_roots, nr_threads, info_level);
+    }
+    if (ret == 0) {
+        /* back to the order of the variables of the points, the last
+         * coordinate is dropped if a linear form has been added */
+        for (i = 0; i < nidx; ++i) {
+            real_point_struct *pt = pts[idx[i]];
+            for (j = 0; j < pt->nvars; ++j) {
+                long src = j;
+                if (lidx >= 0 && j == lidx) {
+                    src = param->nvars - 1;
+                } else if (lidx >= 0 && j == param->nvars - 1) {
+                    src = lidx;
+                }
+                coord_struct *c = rpts[idx[i]]->coords[src];
+                mpz_set(pt->coords[j]->val_do, c->val_do);
+                mpz_set(pt->coords[j]->val_up, c->val_up);
+                pt->coords[j]->k_do    = c->k_do;
+                pt->coords[j]->k_up    = c->k_up;
+                pt->coords[j]->isexact = c->isexact;
+            }
+        }
+        FILE *ofh = stdout;
+        if (files->out_file != NULL) {
+            ofh = fopen(files->out_file, "a+");
+        }
+        fprintf(ofh, "[0, ");
+        display_real_points(ofh, pts, nb, nr_threads);
+        fprintf(ofh, "]:\n");
+        if (ofh != stdout) {
+            fclose(ofh);
+        }
+        if (files->bin_out_file != NULL) {
+            FILE *ofile = fopen(files->bin_out_file, "wb");
+            if (ofile == NULL) {
+                fprintf(stderr, "Cannot open binary output file\n");
+            } else {
+                mpz_param_out_raw(ofile, param);
+                real_points_out_raw(ofile, pts, nb);
+                real_roots_out_raw(ofile, roots, nb, lidx);
+                fclose(ofile);
+            }
+        }
+    }
+
+    if (rpts != NULL) {
+        for (i = 0; i < nb; ++i) {
+            real_point_clear(rpts[i]);
+        }
+        free(rpts);
+    }
+    if (pts != NULL) {
+        for (i = 0; i < nb_pts; ++i) {
+            real_point_clear(pts[i]);
+        }
+        free(pts);
+    }
+    if (roots != NULL) {
+        for (i = 0; i < nb; ++i) {
+            mpz_clear(roots[i].numer);
+        }
+        free(roots);
+    }
+    free(idx);
+    mpz_param_clear(param);
+
+    return ret;
+}
 
 int main(int argc, char **argv){
 
@@ -342,7 +856,7 @@ int main(int argc, char **argv){
     int32_t use_signatures        = 0;
     int32_t nr_threads            = 1;
     int32_t info_level            = 0;
-    int32_t initial_hts           = 17;
+    int32_t initial_hts           = 0; /* 17, BATCH_INITIAL_HTS in batch mode */
     int32_t max_pairs             = 0;
     int32_t elim_block_len        = 0;
     int32_t update_ht             = 0;
@@ -359,7 +873,10 @@ int main(int argc, char **argv){
     int32_t is_gb                 = 0;
     int32_t get_param             = 0;
     int32_t precision             = 128;
-    int32_t refine                = 0; /* not used at the moment */
+    int32_t extract_min_roots     = -1; /* -1 = default, see -E */
+    int64_t mem_budget            = 0; /* bytes, 0 = default, see -B */
+    int64_t spa_min_ncols         = -1; /* -1 = default, see -A */
+    char *refine                  = NULL; /* real roots to refine, see -R */
     int32_t isolate               = 0; /* not used at the moment */
 
     files_gb *files = malloc(sizeof(files_gb));
@@ -368,16 +885,25 @@ int main(int argc, char **argv){
     files->bin_file = NULL;
     files->out_file = NULL;
     files->bin_out_file = NULL;
+    files->batch_file = NULL;
+    files->checkpoint_file = NULL;
+    files->checkpoint_delay = CHECKPOINT_DELAY;
+    files->ooc_dir = NULL;
     getoptions(argc, argv, &initial_hts, &nr_threads, &max_pairs,
                &elim_block_len, &la_option, &use_signatures, &update_ht,
                &reduce_gb, &print_gb, &truncate_lifting, &genericity_handling, &unstable_staircase, &saturate, &colon,
                &normal_form, &normal_form_matrix, &is_gb, &get_param,
-               &precision, &refine, &isolate, &generate_pbm, &info_level, files);
+               &precision, &extract_min_roots, &refine, &isolate, &generate_pbm, &info_level,
+               &mem_budget, &spa_min_ncols, files);
+
+    if (initial_hts <= 0) {
+        initial_hts = files->batch_file != NULL ? BATCH_INITIAL_HTS : 17;
+    }
 
     FILE *fh  = fopen(files->in_file, "r");
     FILE *bfh  = fopen(files->bin_file, "r");
 
-    if (fh == NULL && bfh == NULL) {
+    if (fh == NULL && bfh == NULL && files->batch_file == NULL) {
       fprintf(stderr, "Input file not found.\n");
       exit(1);
     }
@@ -399,6 +925,47 @@ int main(int argc, char **argv){
       }
       fclose(ofile);
     }
+
+    if (refine != NULL || (files->in_file == NULL && files->bin_file != NULL)) {
+        int ret = refine_real_roots_from_file(refine != NULL ? refine : "",
+                precision, extract_min_roots, nr_threads, info_level, files);
+        if (info_level > 0) {
+            double st1 = cputime();
+            double rt1 = realtime();
+            fprintf(stderr, "-------------------------------------------------\
+-----------------------------------\n");
+            fprintf(stderr, "msolve overall time  %13.2f sec (elapsed) / %5.2f sec (cpu)\n",
+                    rt1-rt0, st1-st0);
+            fprintf(stderr, "-------------------------------------------------\
+-----------------------------------\n");
+        }
+        free(files);
+        return ret;
+    }
+    if (files->batch_file != NULL) {
+        if (files->checkpoint_file != NULL) {
+            fprintf(stderr, "Warning: no checkpoints in batch mode, ");
+            fprintf(stderr, "-k is ignored.\n");
+        }
+        int ret = msolve_batch(la_option, use_signatures, nr_threads,
+                info_level, initial_hts, max_pairs, elim_block_len, update_ht,
+                generate_pbm, reduce_gb, print_gb, truncate_lifting, get_param,
+                genericity_handling, unstable_staircase, saturate, colon,
+                normal_form, normal_form_matrix, is_gb, precision,
+                extract_min_roots, mem_budget, spa_min_ncols, files);
+        if (info_level > 0) {
+            double st1 = cputime();
+            double rt1 = realtime();
+            fprintf(stderr, "-------------------------------------------------\
+-----------------------------------\n");
+            fprintf(stderr, "msolve overall time  %13.2f sec (elapsed) / %5.2f sec (cpu)\n",
+                    rt1-rt0, st1-st0);
+            fprintf(stderr, "-------------------------------------------------\
+-----------------------------------\n");
+        }
+        free(files);
+        return ret;
+    }
     /**
        We get from files the requested data. 
     **/
@@ -432,13 +999,15 @@ int main(int argc, char **argv){
     interval *real_roots    = NULL;
     real_point_t *real_pts  = NULL;
 
+    set_random_seed((uint32_t)time(0));
+
     /* main msolve functionality */
     int ret = core_msolve(la_option, use_signatures, nr_threads, info_level,
                           initial_hts, max_pairs, elim_block_len, update_ht,
                           generate_pbm, reduce_gb, print_gb, truncate_lifting, get_param,
                           genericity_handling, unstable_staircase, saturate, colon, normal_form,
-                          normal_form_matrix, is_gb, precision, 
-                          files, gens,
+                          normal_form_matrix, is_gb, precision, extract_min_roots,
+                          mem_budget, spa_min_ncols, files, gens,
             &param, mpz_paramp, &nb_real_roots, &real_roots, &real_pts);
 
     /* free parametrization */
@@ -32,6 +32,10 @@ static void initialize_mstrace(mstrace_t msd, md_t *st){
   msd->bht = msd->bs_qq->ht;
   msd->tht = NULL;
 
+  /* set when computing a saturation resp. normal forms, share msd->bht */
+  msd->sat_qq = NULL;
+  msd->tbr_qq = NULL;
+
   /* generate array to store modular bases */
   msd->bs = (bs_t **)calloc((unsigned long)st->nthrds, sizeof(bs_t *));
   msd->bad_primes = calloc((unsigned long)st->nthrds, sizeof(int));
@@ -40,7 +44,7 @@ static void initialize_mstrace(mstrace_t msd, md_t *st){
   msd->btrace = (trace_t **)calloc(st->nthrds,
                                         sizeof(trace_t *));
   msd->btrace[0]  = initialize_trace(msd->bs_qq, st);
-  /* initialization of other tracers is done through duplication */
+  /* other threads share this tracer, see duplicate_tracer */
 
   msd->num_gb = (int32_t *)calloc(st->nthrds, sizeof(int32_t));
   msd->leadmons_ori = (int32_t **)calloc(st->nthrds, sizeof(int32_t *));
@@ -66,11 +70,20 @@ static void initialize_mstrace(mstrace_t msd, md_t *st){
 }
 
 static void free_mstrace(mstrace_t msd, md_t *st){
+  /* reducers of the normal forms, see modular_normal_forms() */
+  free(st->nfr);
+  st->nfr = NULL;
   free_lucky_primes(&msd->lp);
   free(msd->lp);
   /* to be checked if that is to be done when st->ff_bits != 0
      This was previously done only when characteristic is zero
    */
+  if(msd->sat_qq != NULL){
+    free_basis_without_hash_table(&(msd->sat_qq));
+  }
+  if(msd->tbr_qq != NULL){
+    free_basis_without_hash_table(&(msd->tbr_qq));
+  }
   free_basis(&(msd->bs_qq));
   free(msd->bs_qq);
 
@@ -98,19 +111,21 @@ static void free_mstrace(mstrace_t msd, md_t *st){
 
   free(msd->bad_primes);
 
-  for(int i = 0; i < st->nthrds; ++i){
-    if(msd->btrace[i] != NULL){
-      free_trace(&(msd->btrace[i]));
-    }
+  /* the trace is shared by all threads, a trace learned by core_gba()
+   * is not stored in msd->btrace, see finalize_f4() */
+  if(st->tr != NULL && st->tr != msd->btrace[0]){
+    free_trace(&(st->tr));
+  }
+  if(msd->btrace[0] != NULL){
+    free_trace(&(msd->btrace[0]));
   }
   free(msd->btrace);
 
   free(msd->num_gb);
 
-  for(int i = 0; i < st->nthrds; ++i){
-    if(msd->leadmons_ori[i] != NULL){
-      free(msd->leadmons_ori[i]);
-    }
+  /* the original leading monomials are shared by all threads */
+  if(msd->leadmons_ori[0] != NULL){
+    free(msd->leadmons_ori[0]);
   }
   free(msd->leadmons_ori);
 
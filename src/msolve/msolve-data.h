@@ -129,16 +129,24 @@ typedef struct{
 } fglm_data_t;
 
 
+/* scratch polynomials for solving the Hankel system of one coordinate */
 typedef struct{
-  nmod_berlekamp_massey_t BMS;
-  nmod_poly_t Z1;
-  nmod_poly_t Z2;
   nmod_poly_t rZ1;
   nmod_poly_t rZ2;
   nmod_poly_t A;
   nmod_poly_t B;
   nmod_poly_t V;
   nmod_poly_t param;
+} fglm_hankel_data_t;
+
+typedef struct{
+  nmod_berlekamp_massey_t BMS;
+  nmod_poly_t Z1;
+  nmod_poly_t Z2;
+  szmat_t dim;
+  long mpdeg; //degree of the last computed minimal polynomial
+  long nhk; //number of scratch sets in hk
+  fglm_hankel_data_t *hk; //one scratch set per thread
   nmod_poly_factor_t sqf;
 } fglm_bms_data_t;
 
@@ -276,12 +284,19 @@ typedef struct{
   char *bin_file;
   char *out_file;
   char *bin_out_file;
+  char *batch_file;
+  char *checkpoint_file; /* checkpoints of multi-modular computations */
+  double checkpoint_delay; /* minimal delay in seconds between them */
+  char *ooc_dir; /* out-of-core storage of F4 traces and redundant basis
+                  * elements, see set_out_of_core_dir() */
 } files_gb;
 
 /* data structure for tracing algorithms */
 typedef struct{
   primes_t *lp; /* array of lucky primes, usually of size st->nthrds */
   bs_t *bs_qq; /* basis_qq */
+  bs_t *sat_qq; /* saturation element, NULL if no saturation is computed */
+  bs_t *tbr_qq; /* elements to be reduced, NULL if no normal form is computed */
   ht_t *bht; /* hash table */
   ht_t *tht; /* hash table to store the hashes of the multiples of the basis
                 elements stored in the trace */
@@ -316,7 +331,12 @@ typedef struct{
   int32_t info_level;
   int32_t print_gb;
   int32_t truncate_lifting;
+  int32_t saturate;
+  int32_t normal_form;
   int32_t pbm_file;
+  int64_t mem_budget; /* memory budget for one F4 matrix in bytes, see
+                       * set_memory_budget() */
+  int64_t spa_min_ncols; /* see set_spa_min_ncols() */
   files_gb *files;
 } msolveflags_struct;
 typedef msolveflags_struct msflags_t[1];
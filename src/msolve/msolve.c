@@ -24,6 +24,10 @@
 #include "lifting.c"
 #include "lifting-gb.c"
 
+#if __FLINT_VERSION >= 3
+#include <flint/arb_poly.h>
+#endif
+
 #define LIFTMATRIX 0
 #ifndef MAX
 #define MAX(a,b) (((a)>(b))?(a):(b))
@@ -34,6 +38,10 @@
 #define LOG2(X) ((unsigned) (8*sizeof (unsigned long long) - __builtin_clzll((X)) - 1))
 #define ilog2_mpz(a) mpz_sizeinbase(a,2)
 
+/* number of integers per thread converted to decimal strings
+ * at once when printing in parallel */
+#define OUT_STR_BLOCK 64
+
 
 static void mpz_upoly_init(mpz_upoly_t poly, deg_t alloc){
   mpz_t *tmp = NULL;
@@ -79,15 +87,56 @@ void mpz_upoly_clear(mpz_upoly_t pol){
   free(pol->coeffs);
 }
 
-static inline void mpz_upoly_out_str(FILE *file, mpz_upoly_t pol){
+/* returns the decimal string of a, allocated with malloc */
+static inline char *mpz_get_dec_str(const mpz_t a){
+  char *str = malloc(mpz_sizeinbase(a, 10) + 2);
+  if(str == NULL){
+    fprintf(stderr, "Unable to allocate in mpz_get_dec_str\n");
+    exit(1);
+  }
+  return mpz_get_str(str, 10, a);
+}
+
+/* prints the len integers of cfs in base 10 separated by ", ".
+ * Base conversion is superlinear in the size of the integers, thus
+ * blocks of integers are converted in parallel before being written. */
+static inline void mpz_array_out_str(FILE *file, mpz_t *cfs, const long len,
+                                     const int nthrds){
+  if(nthrds <= 1 || len < 2 * nthrds){
+    for(long i = 0; i < len - 1; i++){
+      mpz_out_str(file, 10, cfs[i]);fprintf(file, ", ");
+    }
+    if(len > 0){
+      mpz_out_str(file, 10, cfs[len - 1]);
+    }
+    return;
+  }
+  const long bsz = (long)OUT_STR_BLOCK * nthrds;
+  char **str = malloc(sizeof(char *) * bsz);
+  for(long k = 0; k < len; k += bsz){
+    const long n = MIN(bsz, len - k);
+#pragma omp parallel for num_threads(nthrds) schedule(dynamic)
+    for(long i = 0; i < n; i++){
+      str[i] = mpz_get_dec_str(cfs[k + i]);
+    }
+    for(long i = 0; i < n; i++){
+      fputs(str[i], file);
+      if(k + i < len - 1){
+        fprintf(file, ", ");
+      }
+      free(str[i]);
+    }
+  }
+  free(str);
+}
+
+static inline void mpz_upoly_out_str(FILE *file, mpz_upoly_t pol,
+                                     const int nthrds){
   fprintf(file, "[");
   if(pol->length>0){
     fprintf(file, "%d, ", pol->length - 1); //degree
     fprintf(file, "[");
-    for(long i = 0; i < pol->length - 1; i++){
-      mpz_out_str(file, 10, pol->coeffs[i]);fprintf(file, ", ");
-    }
-    mpz_out_str(file, 10, pol->coeffs[pol->length - 1]);
+    mpz_array_out_str(file, pol->coeffs, pol->length, nthrds);
     fprintf(file, "]");
   }
   else{
@@ -122,7 +171,7 @@ static inline void mpz_param_clear(mpz_param_t param){
 
 static inline void mpz_param_out_str(FILE *file, const data_gens_ff_t *gens,
                                      const long dquot, mpz_param_t param,
-                                     param_t *mod_param){
+                                     param_t *mod_param, const int nthrds){
   fprintf(file, "[");
   fprintf(file, "%d, \n", gens->field_char); /* field charac */
   fprintf(file, "%d, \n", param->nvars); //nvars
@@ -179,14 +228,14 @@ static inline void mpz_param_out_str(FILE *file, const data_gens_ff_t *gens,
     display_nmod_poly(file, mod_param->elim);
   }
   else{
-    mpz_upoly_out_str(file, param->elim); //elim. poly
+    mpz_upoly_out_str(file, param->elim, nthrds); //elim. poly
   }
   fprintf(file, ",\n");
   if(gens->field_char){
     display_nmod_poly(file, mod_param->denom);
   }
   else{
-  mpz_upoly_out_str(file, param->denom); //denom. poly
+  mpz_upoly_out_str(file, param->denom, nthrds); //denom. poly
   }
   fprintf(file, ",\n");
   fprintf(file, "[\n");
@@ -210,7 +259,7 @@ static inline void mpz_param_out_str(FILE *file, const data_gens_ff_t *gens,
     if(param->coords != NULL){
       for(int i = 0; i < param->nvars - 1; i++){
         fprintf(file, "[");
-        mpz_upoly_out_str(file, param->coords[i]); //param. polys
+        mpz_upoly_out_str(file, param->coords[i], nthrds); //param. polys
         fprintf(file, ",\n");
         mpz_out_str(file, 10, param->cfs[i]);
         if(i==param->nvars-2){
@@ -230,11 +279,50 @@ static inline void mpz_param_out_str(FILE *file, const data_gens_ff_t *gens,
 
 static inline void mpz_param_out_str_maple(FILE *file,
         const data_gens_ff_t *gens,const long dquot,
-                                           mpz_param_t param, param_t *mod_param){
-  mpz_param_out_str(file, gens, dquot, param, mod_param);
+                                           mpz_param_t param, param_t *mod_param,
+                                           const int nthrds){
+  mpz_param_out_str(file, gens, dquot, param, mod_param, nthrds);
   fprintf(file, "]");
 }
 
+/* Binary format of parametrizations, as read by get_params_from_file_bin:
+ *
+ * nb\n                          number of parametrizations
+ * for each parametrization:
+ *   len\n + len raw integers     elimination polynomial
+ *   len\n + len raw integers     denominator
+ *   nvars\n
+ *   for each of the nvars-1 coordinates:
+ *     len\n + len raw integers   numerator of the coordinate
+ *     raw integer                its denominator
+ *
+ * len is the number of coefficients (degree + 1), raw integers are written
+ * with mpz_out_raw, i.e. a 4 byte size followed by the limbs in
+ * big-endian byte order. */
+static inline void mpz_upoly_out_raw(FILE *file, mpz_upoly_t pol){
+  const deg_t len = pol->length > 0 ? pol->length : 0;
+  fprintf(file, "%d\n", len);
+  for(deg_t i = 0; i < len; i++){
+    mpz_out_raw(file, pol->coeffs[i]);
+  }
+}
+
+static inline void mpz_param_out_raw(FILE *file, mpz_param_t param){
+  fprintf(file, "%d\n", 1); /*at the moment, a single param is returned */
+  mpz_upoly_out_raw(file, param->elim);
+  mpz_upoly_out_raw(file, param->denom);
+  if(param->coords == NULL){
+    /* no coordinates computed, written as a univariate parametrization */
+    fprintf(file, "%d\n", 1);
+    return;
+  }
+  fprintf(file, "%d\n", param->nvars);
+  for(long i = 0; i < param->nvars - 1; i++){
+    mpz_upoly_out_raw(file, param->coords[i]);
+    mpz_out_raw(file, param->cfs[i]);
+  }
+}
+
 
 static inline void display_fglm_crt_matrix(FILE *file,
                                            crt_mpz_matfglm_t mat){
@@ -715,17 +803,16 @@ static int add_random_linear_form_to_input_system(
         printf("(lowest w.r.t. monomial order)\n");
         printf("[coefficients of linear form are randomly chosen]\n");
     }
-    srand(time(0));
     /* gens->random_linear_form = malloc(sizeof(int32_t)*(nvars_new)); */
     gens->random_linear_form = realloc(gens->random_linear_form, sizeof(int32_t)*(nvars_new));
 
     if (gens->field_char > 0) {
       int j = 0;
       for (i = len_old; i < len_new; ++i) {
-        gens->random_linear_form[j] = ((int8_t)(rand()) % gens->field_char);
+        gens->random_linear_form[j] = ((int8_t)(random_number()) % gens->field_char);
 
         while(gens->random_linear_form[j] == 0){
-            gens->random_linear_form[j] = ((int8_t)(rand()) % gens->field_char);
+            gens->random_linear_form[j] = ((int8_t)(random_number()) % gens->field_char);
        }
         gens->cfs[i]  = gens->random_linear_form[j];
         j++;
@@ -735,10 +822,10 @@ static int add_random_linear_form_to_input_system(
       int j = 0;
       int32_t sum = 0;
       for (i = 2*len_old; i < 2*len_new; i += 2) {
-        gens->random_linear_form[j] = ((int8_t)(rand()));
+        gens->random_linear_form[j] = ((int8_t)(random_number()));
 
         while(gens->random_linear_form[j] == 0){
-            gens->random_linear_form[j] = ((int8_t)(rand()));
+            gens->random_linear_form[j] = ((int8_t)(random_number()));
         }
         if(i < 2*len_new -1){
           sum += nvars_old * abs(gens->random_linear_form[j]);
@@ -1858,6 +1945,56 @@ static int32_t *initial_modular_step(
 
 
 
+/* Chooses how the threads are used in the multi-modular application phase:
+ * st->mm_nteams primes are computed in parallel, each of them using
+ * st->mm_tsize threads for the multi-threaded linear algebra in F4 and
+ * FGLM. By default one thread per prime is used. The number of primes run
+ * concurrently is bounded by the available memory w.r.t. the memory pmem
+ * needed for one prime and by the memory budget for one matrix w.r.t. the
+ * largest matrix of the learning run, each prime gets its share of this
+ * budget. The remaining threads are then used inside each prime, so that
+ * no thread stays idle. pmem is measured on the data of the
+ * learning run (see finalize_f4() and fglm_memory()), the trace is shared
+ * by all primes and thus not part of it. */
+static void set_multi_modular_thread_layout(
+        md_t *st,
+        const int64_t pmem   /* memory needed for one prime */
+        )
+{
+    const int64_t amem = available_memory();
+    int32_t nteams     = st->nthrds;
+
+    if (pmem > 0 && amem > 0 && amem / pmem < nteams) {
+        nteams = amem / pmem > 0 ? (int32_t)(amem / pmem) : 1;
+    }
+    /* the matrices of the primes computed in parallel share the memory
+     * budget for one matrix */
+    const int64_t bgt  = st->mem_budget;
+    const int64_t mmem = st->mm_mmem;
+    if (bgt > 0 && mmem > 0 && bgt / mmem < nteams) {
+        nteams = bgt / mmem > 0 ? (int32_t)(bgt / mmem) : 1;
+    }
+    /* use all threads, fewer teams of equal size if nteams does not
+     * divide the number of threads */
+    const int32_t tsize = (st->nthrds + nteams - 1) / nteams;
+    st->mm_nteams = st->nthrds / tsize;
+    st->mm_tsize  = tsize;
+    if (bgt > 0) {
+        st->mem_budget  = bgt / st->mm_nteams;
+    }
+
+    if (st->info_level > 0) {
+        fprintf(stderr, "\nMulti-modular scheduling: %d prime(s) in parallel, ",
+                st->mm_nteams);
+        fprintf(stderr, "%d thread(s) per prime\n", st->mm_tsize);
+        fprintf(stderr, "(%.2f MB per prime, ",
+                (double)pmem / (1024.0 * 1024.0));
+        fprintf(stderr, "trace: %.2f MB / available: %.2f MB)\n",
+                (double)trace_memory(st->tr) / (1024.0 * 1024.0),
+                (double)amem / (1024.0 * 1024.0));
+    }
+}
+
 static void secondary_modular_steps(sp_matfglm_t **bmatrix,
 				    int32_t **bdiv_xn,
 				    int32_t **blen_gb_xn,
@@ -1894,6 +2031,7 @@ static void secondary_modular_steps(sp_matfglm_t **bmatrix,
 				    data_gens_ff_t *gens,
 				    double *stf4,
 				    const long nbsols,
+				    const long mpdeg,
 				    uint32_t *bad_primes)
 {
     st->info_level  = 0;
@@ -1902,18 +2040,27 @@ static void secondary_modular_steps(sp_matfglm_t **bmatrix,
     double rt = realtime();
     /* tracing phase */
     len_t i;
-    int32_t error = 0;
 
-    /* F4 and FGLM are run using a single thread */
-    /* st->nthrds is reset to its original value afterwards */
+    /* st->mm_nteams primes are handled in parallel, F4 and FGLM are run
+     * using st->mm_tsize threads for each prime (see
+     * set_multi_modular_thread_layout()), by default this is one thread.
+     * st->nthrds is reset to its original value afterwards */
     const int nthrds = st->nthrds;
-    st->nthrds = 1;
+    const int nteams = st->mm_nteams > 0 ? st->mm_nteams : nthrds;
+    st->nthrds = st->mm_tsize > 0 ? st->mm_tsize : 1;
+#ifdef _OPENMP
+    const int max_levels = omp_get_max_active_levels();
+    if (st->nthrds > 1 && nteams > 1) {
+        omp_set_max_active_levels(2);
+    }
+#endif
     for(nvars_t i = 0; i < st->nprimes; i++){
       bad_primes[i] = 0;
     }
-#pragma omp parallel for num_threads(nthrds)  \
-    private(i) schedule(static)
+#pragma omp parallel for num_threads(nteams)  \
+    private(i) schedule(dynamic)
     for (i = 0; i < st->nprimes; ++i){
+        int32_t error = 0;
         bs[i] = core_gba(bs_qq, st, &error, lp->p[i]);
         *stf4 = realtime()-rt;
         /* printf("F4 trace timing %13.2f\n", *stf4); */
@@ -1940,8 +2087,9 @@ static void secondary_modular_steps(sp_matfglm_t **bmatrix,
             lml = j;
         }
         if(lml != num_gb[i]){
+            /* the hash table of bs[i] shares data with the one of bs_qq */
             if (bs[i] != NULL) {
-                free_basis(&(bs[i]));
+                free_basis_and_only_local_hash_table_data(&(bs[i]));
             }
             /* nmod_params[i] = NULL; */
             bad_primes[i] = 1;
@@ -1982,6 +2130,7 @@ static void secondary_modular_steps(sp_matfglm_t **bmatrix,
                         bdata_fglm[i],
                         bdata_bms[i],
                         nbsols,
+                        mpdeg,
                         info_level,
                         st)){
                 bad_primes[i] = 1;
@@ -1994,59 +2143,13 @@ static void secondary_modular_steps(sp_matfglm_t **bmatrix,
             free_basis_and_only_local_hash_table_data(&(bs[i]));
         }
     }
+#ifdef _OPENMP
+    omp_set_max_active_levels(max_levels);
+#endif
     st->nthrds = nthrds;
 }
 
 
-/* sets function pointer */
-void set_linear_function_pointer(int32_t fc){
-  int nbits = 0;
-  if(fc==0){
-    nbits = 32;
-  }
-  else{
-    if(fc < (int32_t)(1) << 8) {
-      nbits = 8;
-    }
-    else{
-      if(fc < (int32_t)(1) << 16){
-        nbits = 16;
-      }
-      else nbits = 32;
-    }
-  }
-  switch (nbits) {
-  case 8:
-    set_linear_poly = set_linear_poly_8;
-    check_and_set_linear_poly = check_and_set_linear_poly_8;
-    copy_poly_in_matrix_from_bs = copy_poly_in_matrix_from_bs_8;
-    copy_nf_in_matrix_from_bs = copy_nf_in_matrix_from_bs_8;
-    break;
-  case 16:
-    set_linear_poly = set_linear_poly_16;
-    check_and_set_linear_poly = check_and_set_linear_poly_16;
-    copy_poly_in_matrix_from_bs = copy_poly_in_matrix_from_bs_16;
-    copy_nf_in_matrix_from_bs = copy_nf_in_matrix_from_bs_16;
-    break;
-  case 32:
-    set_linear_poly = set_linear_poly_32;
-    check_and_set_linear_poly = check_and_set_linear_poly_32;
-    copy_poly_in_matrix_from_bs = copy_poly_in_matrix_from_bs_32;
-    copy_nf_in_matrix_from_bs = copy_nf_in_matrix_from_bs_32;
-    break;
-  case 0:
-    set_linear_poly = set_linear_poly_32;
-    check_and_set_linear_poly = check_and_set_linear_poly_32;
-    copy_poly_in_matrix_from_bs = copy_poly_in_matrix_from_bs_32;
-    copy_nf_in_matrix_from_bs = copy_nf_in_matrix_from_bs_32;
-    break;
-  default:
-    set_linear_poly = set_linear_poly_32;
-    check_and_set_linear_poly = check_and_set_linear_poly_32;
-    copy_poly_in_matrix_from_bs = copy_poly_in_matrix_from_bs_32;
-    copy_nf_in_matrix_from_bs = copy_nf_in_matrix_from_bs_32;
-  }
-}
 
 
 
@@ -2054,6 +2157,177 @@ void set_linear_function_pointer(int32_t fc){
 
 
 
+/* counters of the multi-modular loop of msolve_trace_qq stored in its
+ * checkpoints: rerun, mcheck, nbdoit, prdone, lpow2, clog, br, mat_lifted
+ * and nprimes */
+#define TRACE_CHECKPOINT_NCOUNTERS 9
+
+/* writes the state of the multi-modular loop of msolve_trace_qq in the
+ * checkpoint fn: the prime used for learning, the last prime used, the
+ * loop counters, the current CRT modulus, the CRT lifts of the
+ * parametrization (tmp_mpz_param) and of the trace and determinant, and
+ * the already reconstructed data (mpz_param, is_lifted) */
+static void trace_checkpoint_save(const char *fn,
+                                  const uint32_t primeinit,
+                                  const uint32_t prime,
+                                  const int *counters,
+                                  const long nbadprimes,
+                                  const deg_t maxrec,
+                                  const int *is_lifted,
+                                  mpz_t modulus,
+                                  trace_det_fglm_mat_t trace_det,
+                                  mpz_param_t tmp_mpz_param,
+                                  mpz_param_t mpz_param){
+  FILE *file = checkpoint_write_open(fn, "trace");
+  if(file == NULL){
+    return;
+  }
+  fprintf(file, "%u\n%u\n%ld\n%d\n", primeinit, prime, nbadprimes, maxrec);
+  for(int i = 0; i < TRACE_CHECKPOINT_NCOUNTERS; i++){
+    fprintf(file, "%d\n", counters[i]);
+  }
+  fprintf(file, "%d\n%d\n", mpz_param->nvars, mpz_param->nsols);
+  for(int i = 0; i < mpz_param->nvars; i++){
+    fprintf(file, "%d\n", is_lifted[i]);
+  }
+  fprintf(file, "%u\n%u\n%d\n%d\n%d\n%d\n",
+          trace_det->trace_idx, trace_det->det_idx,
+          trace_det->done_trace, trace_det->done_det,
+          trace_det->check_trace, trace_det->check_det);
+
+  checkpoint_out_mpz_upoly(file, tmp_mpz_param->elim);
+  for(long i = 0; i < tmp_mpz_param->nvars - 1; i++){
+    checkpoint_out_mpz_upoly(file, tmp_mpz_param->coords[i]);
+  }
+  mpz_out_raw(file, modulus);
+  mpz_out_raw(file, trace_det->trace_crt);
+  mpz_out_raw(file, trace_det->det_crt);
+  mpz_out_raw(file, trace_det->trace_num);
+  mpz_out_raw(file, trace_det->trace_den);
+  mpz_out_raw(file, trace_det->det_num);
+  mpz_out_raw(file, trace_det->det_den);
+  checkpoint_out_mpz_upoly(file, mpz_param->elim);
+  for(long i = 0; i < mpz_param->nvars - 1; i++){
+    checkpoint_out_mpz_upoly(file, mpz_param->coords[i]);
+  }
+  checkpoint_out_mpz_array(file, mpz_param->cfs, mpz_param->nvars - 1);
+
+  checkpoint_write_close(file, fn);
+}
+
+/* returns 1 if the residues modulo prime of the CRT lift pol are the
+ * coefficients of nmod_pol (which may be shorter than pol) */
+static inline int check_crt_mpz_upoly(const mpz_upoly_t pol,
+                                      const nmod_poly_t nmod_pol,
+                                      const uint32_t prime){
+  if(pol->length < nmod_pol->length){
+    return 0;
+  }
+  for(long i = 0; i < pol->length; i++){
+    uint32_t c = (i < nmod_pol->length) ? nmod_pol->coeffs[i] : 0;
+    if(mpz_fdiv_ui(pol->coeffs[i], prime) != c){
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* restores the state saved by trace_checkpoint_save, the learning phase
+ * has been redone with primeinit, giving nmod_param.
+ * returns 0 (and leaves the state unchanged) if the checkpoint does not
+ * match this computation */
+static int trace_checkpoint_load(const char *fn,
+                                 const uint32_t primeinit,
+                                 uint32_t *prime,
+                                 int *counters,
+                                 long *nbadprimes,
+                                 deg_t *maxrec,
+                                 int *is_lifted,
+                                 mpz_t modulus,
+                                 trace_det_fglm_mat_t trace_det,
+                                 mpz_param_t tmp_mpz_param,
+                                 mpz_param_t mpz_param,
+                                 param_t *nmod_param,
+                                 const int info_level){
+  FILE *file = checkpoint_read_open(fn, "trace");
+  if(file == NULL){
+    return 0;
+  }
+  uint32_t p0 = 0, p = 0, tridx = 0, detidx = 0;
+  long nbp = 0;
+  int mrec = 0, nvars = 0, nsols = 0;
+  int cnt[TRACE_CHECKPOINT_NCOUNTERS];
+  int b = (fscanf(file, "%u\n%u\n%ld\n%d\n", &p0, &p, &nbp, &mrec) == 4);
+  for(int i = 0; b && i < TRACE_CHECKPOINT_NCOUNTERS; i++){
+    b = (fscanf(file, "%d\n", cnt + i) == 1);
+  }
+  b = b && (fscanf(file, "%d\n%d\n", &nvars, &nsols) == 2);
+  b = b && p0 == primeinit && nvars == mpz_param->nvars
+    && nsols == mpz_param->nsols;
+  int *lifted = calloc(nvars > 0 ? nvars : 1, sizeof(int));
+  for(int i = 0; b && i < nvars; i++){
+    b = (fscanf(file, "%d\n", lifted + i) == 1);
+  }
+  int flags[4];
+  b = b && (fscanf(file, "%u\n%u\n%d\n%d\n%d\n%d\n", &tridx, &detidx,
+                   flags, flags + 1, flags + 2, flags + 3) == 6);
+  b = b && tridx == trace_det->trace_idx && detidx == trace_det->det_idx;
+
+  /* the CRT lifts have to agree with the parametrization computed modulo
+   * primeinit during the learning phase */
+  b = b && checkpoint_inp_mpz_upoly(file, tmp_mpz_param->elim)
+    && check_crt_mpz_upoly(tmp_mpz_param->elim, nmod_param->elim, primeinit);
+  for(long i = 0; b && i < nvars - 1; i++){
+    b = checkpoint_inp_mpz_upoly(file, tmp_mpz_param->coords[i])
+      && check_crt_mpz_upoly(tmp_mpz_param->coords[i],
+                             nmod_param->coords[i], primeinit);
+  }
+  if(!b){
+    fprintf(stderr, "Checkpoint %s does not match this computation, ", fn);
+    fprintf(stderr, "it is ignored\n");
+    set_mpz_param_nmod(tmp_mpz_param, nmod_param);
+    free(lifted);
+    fclose(file);
+    return 0;
+  }
+
+  b = mpz_inp_raw(modulus, file) && mpz_inp_raw(trace_det->trace_crt, file)
+    && mpz_inp_raw(trace_det->det_crt, file)
+    && mpz_inp_raw(trace_det->trace_num, file)
+    && mpz_inp_raw(trace_det->trace_den, file)
+    && mpz_inp_raw(trace_det->det_num, file)
+    && mpz_inp_raw(trace_det->det_den, file)
+    && checkpoint_inp_mpz_upoly(file, mpz_param->elim);
+  for(long i = 0; b && i < nvars - 1; i++){
+    b = checkpoint_inp_mpz_upoly(file, mpz_param->coords[i]);
+  }
+  b = b && checkpoint_inp_mpz_array(file, mpz_param->cfs, nvars - 1);
+  fclose(file);
+  if(!b){
+    fprintf(stderr, "Checkpoint %s is corrupted, remove it and restart\n", fn);
+    exit(1);
+  }
+  *prime = p;
+  *nbadprimes = nbp;
+  *maxrec = mrec;
+  for(int i = 0; i < TRACE_CHECKPOINT_NCOUNTERS; i++){
+    counters[i] = cnt[i];
+  }
+  for(int i = 0; i < nvars; i++){
+    is_lifted[i] = lifted[i];
+  }
+  free(lifted);
+  trace_det->done_trace = flags[0];
+  trace_det->done_det = flags[1];
+  trace_det->check_trace = flags[2];
+  trace_det->check_det = flags[3];
+  if(info_level){
+    fprintf(stderr, "Resumes from checkpoint %s (%d primes)\n",
+            fn, counters[TRACE_CHECKPOINT_NCOUNTERS - 1]);
+  }
+  return 1;
+}
+
 /*
 
   - renvoie 0 si le calcul est ok.
@@ -2090,6 +2364,8 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
                     int32_t info_level,
                     int32_t print_gb,
                     int32_t pbm_file,
+                    int64_t mem_budget,
+                    int64_t spa_min_ncols,
                     files_gb *files,
                     int round){
 
@@ -2139,6 +2415,9 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
     free(st);
     return -3;
   }
+  set_memory_budget(st, mem_budget);
+  set_spa_min_ncols(st, spa_min_ncols);
+  set_out_of_core_dir(st, files != NULL ? files->ooc_dir : NULL);
 
   /* lucky primes */
   primes_t *lp  = (primes_t *)calloc(st->nthrds, sizeof(primes_t));
@@ -2160,7 +2439,7 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
 
   /* sort initial elements, smallest lead term first */
   sort_r(bs_qq->hm, (unsigned long)bs_qq->ld, sizeof(hm_t *),
-          initial_input_cmp, bs_qq->ht);
+          st->fp.initial_input_cmp, bs_qq->ht);
   if(gens->field_char == 0){
     remove_content_of_initial_basis(bs_qq);
     /* generate lucky prime numbers */
@@ -2170,7 +2449,7 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
     lp->old = 0;
     lp->ld = 1;
     lp->p = calloc(1, sizeof(uint32_t));
-    normalize_initial_basis(bs_qq, st->fc);
+    st->fp.normalize_initial_basis(bs_qq, st->fc);
   }
 
   /* generate array to store modular bases */
@@ -2189,10 +2468,19 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
   uint32_t prime = 0; 
   uint32_t primeinit = 0;
   uint32_t lprime = 1303905299;
-  srand(time(0));
-  prime = next_prime(rand() % (1303905301 - (1<<30) + 1) + (1<<30));
+  prime = next_prime(random_number() % (1303905301 - (1<<30) + 1) + (1<<30));
   while(gens->field_char==0 && is_lucky_prime_ui(prime, bs_qq)){
-    prime = next_prime(rand() % (1303905301 - (1<<30) + 1) + (1<<30));
+    prime = next_prime(random_number() % (1303905301 - (1<<30) + 1) + (1<<30));
+  }
+  /* a computation resumed from a checkpoint redoes the learning phase with
+   * the same prime */
+  const char *ckpt = (files != NULL && gens->field_char == 0) ?
+    files->checkpoint_file : NULL;
+  int resume = 0;
+  if(ckpt != NULL && checkpoint_read_prime(ckpt, "trace", &primeinit)
+     && !is_lucky_prime_ui(primeinit, bs_qq)){
+    prime = primeinit;
+    resume = 1;
   }
 
   primeinit = prime;
@@ -2231,8 +2519,6 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
   bsquvars[0] = squvars;
   
 
-  set_linear_function_pointer(gens->field_char);
-
   int success = 1;
   int squares = 1;
 
@@ -2338,8 +2624,14 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
 
   /* btrace[0] = st->tr; */
 
+  set_multi_modular_thread_layout(st,
+                                  st->mm_pmem + fglm_memory(*bmatrix, nr_vars));
+  /* each round of the multi-modular computation handles one prime
+   * per team */
+  st->nprimes = st->mm_nteams;
+
   /* duplicate data for multi-threaded multi-mod computation */
-  duplicate_data_mthread_trace(st->nthrds, bs_qq, st, num_gb,
+  duplicate_data_mthread_trace(st->nprimes, bs_qq, st, num_gb,
                               leadmons_ori, leadmons_current,
                                /* btrace, */
                                bdata_bms, bdata_fglm,
@@ -2400,6 +2692,9 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
   set_mpz_param_nmod(tmp_mpz_param, nmod_params[0]);
 
   deg_t nsols = tmp_mpz_param->nsols;
+  /* degree of the minimal polynomial for the first prime, used to
+   * truncate the Krylov sequences for the next primes */
+  const long mpdeg = bdata_bms[0]->mpdeg;
 
   mpz_upoly_t numer;
   mpz_upoly_init2(numer, (nsols + 1),
@@ -2442,6 +2737,29 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
   /* measures time spent in rational reconstruction */
   double strat = 0;
 
+  int counters[TRACE_CHECKPOINT_NCOUNTERS];
+  /* becomes 1 once ckpt holds a checkpoint of this computation */
+  int ckpt_done = 0;
+  if(resume && trace_checkpoint_load(ckpt, primeinit, &prime, counters,
+                                     &nbadprimes, &maxrec, is_lifted,
+                                     modulus, trace_det, tmp_mpz_param,
+                                     *mpz_paramp, nmod_params[0],
+                                     info_level)){
+    rerun = counters[0];
+    mcheck = counters[1];
+    nbdoit = counters[2];
+    prdone = counters[3];
+    lpow2 = counters[4];
+    clog = counters[5];
+    br = counters[6];
+    mat_lifted = counters[7];
+    nprimes = counters[8];
+    ckpt_done = 1;
+  }
+  /* time of the last checkpoint */
+  double ckpt_t = realtime();
+  const double ckpt_delay = files->checkpoint_delay;
+
   while(rerun == 1 || mcheck == 1){
     
     /* controls call to rational reconstruction */
@@ -2461,7 +2779,7 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
       lp->p[0] = prime;
     }
 
-    for(len_t i = 1; i < st->nthrds; i++){
+    for(len_t i = 1; i < st->nprimes; i++){
       prime = next_prime(prime);
       if(prime >= lprime){
         prime = next_prime(1<<30);
@@ -2475,7 +2793,7 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
         lp->p[i] = prime;
       }
     }
-    prime = lp->p[st->nthrds - 1];
+    prime = lp->p[st->nprimes - 1];
 
     double ca0 = realtime();
 
@@ -2505,7 +2823,7 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
 			    bs_qq, st,
 			    field_char, unstable_staircase, 0, /* info_level, */
 			    bs, lmb_ori, *dquot_ptr, lp,
-			    gens, &stf4, nsols, bad_primes);
+			    gens, &stf4, nsols, mpdeg, bad_primes);
     double ca1 = realtime() - ca0;
 
     if(nprimes==1){
@@ -2524,7 +2842,7 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
       }
     }
 
-    for(int i = 0; i < st->nthrds; i++){
+    for(int i = 0; i < st->nprimes; i++){
       if(bad_primes[i] == 0){
         normalize_nmod_param(nmod_params[i]);
       }
@@ -2532,7 +2850,7 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
     /* scrr measures time spent in ratrecon for modular images */
     double crr = 0, scrr = 0;
     /* CRT + rational reconstruction */
-    for(len_t i = 0; i < st->nthrds; i++){
+    for(len_t i = 0; i < st->nprimes; i++){
       if(bad_primes[i] == 0){
         if(rerun == 0){
           mcheck = check_param_modular(*mpz_paramp, nmod_params[i], lp->p[i],
@@ -2615,6 +2933,29 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
         lpow2 = 2*lpow2;
     }
 
+    if(ckpt != NULL && (rerun == 1 || mcheck == 1)
+       && realtime() - ckpt_t >= ckpt_delay){
+      counters[0] = rerun;
+      counters[1] = mcheck;
+      counters[2] = nbdoit;
+      counters[3] = prdone;
+      counters[4] = lpow2;
+      counters[5] = clog;
+      counters[6] = br;
+      counters[7] = mat_lifted;
+      counters[8] = nprimes;
+      trace_checkpoint_save(ckpt, primeinit, prime, counters, nbadprimes,
+                            maxrec, is_lifted, modulus, trace_det,
+                            tmp_mpz_param, *mpz_paramp);
+      if(info_level){
+        fprintf(stderr, "<ckpt>");
+      }
+      ckpt_t = realtime();
+      ckpt_done = 1;
+    }
+  }
+  if(ckpt_done){
+    remove(ckpt);
   }
 
   (*mpz_paramp)->denom->length = (*mpz_paramp)->nsols;
@@ -2653,34 +2994,35 @@ int msolve_trace_qq(mpz_param_t *mpz_paramp,
 
   //here we should clean nmod_params
 
-  for(i = 0; i < st->nthrds; ++i){
+  for(i = 0; i < st->nprimes; ++i){
     if (bs[i] != NULL) {
       free_basis(&(bs[i]));
     }
     free_fglm_bms_data(bdata_bms[i]);
     free_fglm_data(bdata_fglm[i]);
-    free(bcfs_extra_nf[i]);
-    free(bexps_extra_nf[i]);
-    free(blens_extra_nf[i]);
-    free(bextra_nf[i]);
     free(blen_gb_xn[i]);
     free(bstart_cf_gb_xn[i]);
-    free(bdiv_xn[i]);
     free(bmatrix[i]->dense_mat);
     free(bmatrix[i]->dense_idx);
     free(bmatrix[i]->triv_idx);
     free(bmatrix[i]->triv_pos);
     free(bmatrix[i]->dst);
     free(bmatrix[i]);
-    free(leadmons_ori[i]);
     free(leadmons_current[i]);
     /* free_trace(&btrace[i]); */
     free(nmod_params[i]);
 
-    free(blinvars[i]);
     free(lineqs_ptr[i]);
-    free(bsquvars[i]);
   }
+  /* read-only data is shared by all threads */
+  free(bcfs_extra_nf[0]);
+  free(bexps_extra_nf[0]);
+  free(blens_extra_nf[0]);
+  free(bextra_nf[0]);
+  free(bdiv_xn[0]);
+  free(leadmons_ori[0]);
+  free(blinvars[0]);
+  free(bsquvars[0]);
 
   free_basis(&(bs_qq));
   free(bs);
@@ -2735,68 +3077,181 @@ void real_point_clear(real_point_t pt){
 }
 
 
-void display_real_point(FILE *fstream, real_point_t pt){
-  fprintf(fstream, "[");
-  for(long i = 0; i < pt->nvars - 1; i++){
-    fprintf(fstream, "[");
-    mpz_out_str(fstream, 10, pt->coords[i]->val_do);
-    if(pt->coords[i]->k_do && mpz_sgn(pt->coords[i]->val_do)){
-      fprintf(fstream, " / ");
-      fprintf(fstream, "2");
-      if(pt->coords[i]->k_do> 1){
-        fprintf(fstream, "^%d", pt->coords[i]->k_do);
-      }
-    }
-    fprintf(fstream, ", ");
-    mpz_out_str(fstream, 10, pt->coords[i]->val_up);
-    if(pt->coords[i]->k_up && mpz_sgn(pt->coords[i]->val_up)){
-      fprintf(fstream, " / ");
-      fprintf(fstream, "2");
-      if(pt->coords[i]->k_up> 1){
-        fprintf(fstream, "^%d", pt->coords[i]->k_up);
-      }
-    }
-    fprintf(fstream, "], ");
-  }
-  fprintf(fstream, "[");
-  mpz_out_str(fstream, 10, pt->coords[pt->nvars - 1]->val_do);
-  if(pt->coords[pt->nvars - 1]->k_do && mpz_sgn(pt->coords[pt->nvars - 1]->val_do)){
+static inline void display_dyadic_bound(FILE *fstream, const char *str,
+                                        const mpz_t val, const deg_t k){
+  fputs(str, fstream);
+  if(k && mpz_sgn(val)){
     fprintf(fstream, " / ");
     fprintf(fstream, "2");
-    if(pt->coords[pt->nvars - 1]->k_do> 1){
-      fprintf(fstream, "^%d", pt->coords[pt->nvars - 1]->k_do);
+    if(k > 1){
+      fprintf(fstream, "^%d", k);
     }
   }
-  fprintf(fstream, ", ");
+}
 
-  mpz_out_str(fstream, 10, pt->coords[pt->nvars - 1]->val_up);
-  if(pt->coords[pt->nvars - 1]->k_up && mpz_sgn(pt->coords[pt->nvars - 1]->val_up)){
-    fprintf(fstream, " / ");
-    fprintf(fstream, "2");
-    if(pt->coords[pt->nvars - 1]->k_up> 1){
-      fprintf(fstream, "^%d", pt->coords[pt->nvars - 1]->k_up);
+/* str holds the decimal strings of the lower and upper bounds
+ * of all coordinates of pt */
+static inline void display_real_point_str(FILE *fstream, real_point_t pt,
+                                          char **str){
+  fprintf(fstream, "[");
+  for(long i = 0; i < pt->nvars; i++){
+    fprintf(fstream, "[");
+    display_dyadic_bound(fstream, str[2*i], pt->coords[i]->val_do,
+                         pt->coords[i]->k_do);
+    fprintf(fstream, ", ");
+    display_dyadic_bound(fstream, str[2*i+1], pt->coords[i]->val_up,
+                         pt->coords[i]->k_up);
+    fprintf(fstream, "]");
+    if(i < pt->nvars - 1){
+      fprintf(fstream, ", ");
     }
   }
-
-  fprintf(fstream, "]");
   fprintf(fstream, "]");
+}
 
+static inline void real_point_get_str(real_point_t pt, char **str){
+  for(long i = 0; i < pt->nvars; i++){
+    str[2*i]   = mpz_get_dec_str(pt->coords[i]->val_do);
+    str[2*i+1] = mpz_get_dec_str(pt->coords[i]->val_up);
+  }
 }
 
-void display_real_points(FILE *fstream, real_point_t *pts, long nb){
+void display_real_point(FILE *fstream, real_point_t pt){
+  char **str = malloc(sizeof(char *) * 2 * pt->nvars);
+  real_point_get_str(pt, str);
+  display_real_point_str(fstream, pt, str);
+  for(long i = 0; i < 2 * pt->nvars; i++){
+    free(str[i]);
+  }
+  free(str);
+}
+
+/* decimal conversion of the coordinates is done in parallel
+ * for blocks of points */
+void display_real_points(FILE *fstream, real_point_t *pts, long nb,
+                         const int nthrds){
   fprintf(fstream, "[1,\n"); /* because at the moment we return a single list */
   fprintf(fstream, "[");
-  for(long i = 0; i < nb - 1; i++){
-    display_real_point(fstream, pts[i]);
-    fprintf(fstream, ", ");
-  }
   if(nb){
-    display_real_point(fstream, pts[nb - 1]);
+    const long nv  = pts[0]->nvars;
+    const long bsz = nthrds > 1 ? (long)OUT_STR_BLOCK * nthrds : 1;
+    char **str = malloc(sizeof(char *) * 2 * nv * bsz);
+    for(long k = 0; k < nb; k += bsz){
+      const long n = MIN(bsz, nb - k);
+#pragma omp parallel for num_threads(nthrds) schedule(dynamic) if(n > 1)
+      for(long i = 0; i < n; i++){
+        real_point_get_str(pts[k + i], str + 2 * nv * i);
+      }
+      for(long i = 0; i < n; i++){
+        display_real_point_str(fstream, pts[k + i], str + 2 * nv * i);
+        if(k + i < nb - 1){
+          fprintf(fstream, ", ");
+        }
+        for(long j = 0; j < 2 * nv; j++){
+          free(str[2 * nv * i + j]);
+        }
+      }
+    }
+    free(str);
   }
   fprintf(fstream, "]\n");
   fprintf(fstream, "]");
 }
 
+/* Binary format of real points, written after the parametrization
+ * (see mpz_param_out_raw):
+ *
+ * nb nvars\n                    number of points, number of coordinates
+ * for each point and coordinate:
+ *   raw integer, k\n            lower bound val_do / 2^k_do
+ *   raw integer, k\n            upper bound val_up / 2^k_up */
+static inline void real_points_out_raw(FILE *file, real_point_t *pts,
+                                       const long nb){
+  fprintf(file, "%ld %d\n", nb, nb ? pts[0]->nvars : 0);
+  for(long i = 0; i < nb; i++){
+    for(long j = 0; j < pts[i]->nvars; j++){
+      mpz_out_raw(file, pts[i]->coords[j]->val_do);
+      fprintf(file, "%d\n", pts[i]->coords[j]->k_do);
+      mpz_out_raw(file, pts[i]->coords[j]->val_up);
+      fprintf(file, "%d\n", pts[i]->coords[j]->k_up);
+    }
+  }
+}
+
+/* Binary format of the isolating intervals of the real roots of the
+ * elimination polynomial, written after the real points (see
+ * real_points_out_raw) so that they can be refined later on (see -R):
+ *
+ * nb lidx\n                     number of intervals, index of the variable
+ *                               swapped with the last one in the points
+ *                               (-1 if none)
+ * for each interval:
+ *   raw integer, k isexact sign_left\n
+ *                               [numer / 2^k, (numer + 1) / 2^k], or
+ *                               numer / 2^k if isexact is 1 */
+static inline void real_roots_out_raw(FILE *file, interval *roots,
+                                      const long nb, const int32_t lidx){
+  fprintf(file, "%ld %d\n", nb, lidx);
+  for(long i = 0; i < nb; i++){
+    mpz_out_raw(file, roots[i].numer);
+    fprintf(file, "%ld %u %d\n", roots[i].k, roots[i].isexact,
+            roots[i].sign_left);
+  }
+}
+
+/* reads back real points written by real_points_out_raw, returns 0 if the
+ * file is corrupted */
+static int real_points_inp_raw(FILE *file, real_point_t **pts_ptr,
+                               long *nb_ptr){
+  long nb = 0;
+  int32_t nv = 0;
+  if(fscanf(file, "%ld %d\n", &nb, &nv) != 2 || nb < 0 || nv < 0){
+    return 0;
+  }
+  real_point_t *pts = malloc(sizeof(real_point_t) * (nb + 1));
+  for(long i = 0; i < nb; i++){
+    real_point_init(pts[i], nv);
+  }
+  *pts_ptr = pts;
+  *nb_ptr = nb;
+  for(long i = 0; i < nb; i++){
+    for(long j = 0; j < nv; j++){
+      coord_struct *c = pts[i]->coords[j];
+      if(!mpz_inp_raw(c->val_do, file) ||
+         fscanf(file, "%d\n", &c->k_do) != 1 ||
+         !mpz_inp_raw(c->val_up, file) ||
+         fscanf(file, "%d\n", &c->k_up) != 1){
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* reads back isolating intervals written by real_roots_out_raw, returns 0
+ * if there are none or if the file is corrupted */
+static int real_roots_inp_raw(FILE *file, interval **roots_ptr, long *nb_ptr,
+                              int32_t *lidx){
+  long nb = 0;
+  if(fscanf(file, "%ld %d\n", &nb, lidx) != 2 || nb < 0){
+    return 0;
+  }
+  interval *roots = malloc(sizeof(interval) * (nb + 1));
+  for(long i = 0; i < nb; i++){
+    mpz_init(roots[i].numer);
+  }
+  *roots_ptr = roots;
+  *nb_ptr = nb;
+  for(long i = 0; i < nb; i++){
+    if(!mpz_inp_raw(roots[i].numer, file) ||
+       fscanf(file, "%ld %u %d\n", &roots[i].k, &roots[i].isexact,
+              &roots[i].sign_left) != 3){
+      return 0;
+    }
+  }
+  return 1;
+}
+
 void single_exact_real_root_param(mpz_param_t param, interval *rt, long nb,
                                   mpz_t *xdo, mpz_t *xup, mpz_t den_up, mpz_t den_do,
                                   mpz_t c, mpz_t tmp, mpz_t val_do, mpz_t val_up,
@@ -3312,9 +3767,162 @@ void normalize_points(real_point_t *pts, int64_t nb, int32_t nv){
   }
 }
 
-void extract_real_roots_param(mpz_param_t param, interval *roots, long nb,
-                              real_point_t *pts, long prec, long nbits,
-                              double step, int info_level){
+/* default minimal number of real roots for which extract_real_roots_param
+ * first evaluates the parametrization at all roots at once, see the
+ * parameter extract_min_roots of extract_real_roots_param */
+#ifndef BATCH_EXTRACT_MIN_ROOTS
+#define BATCH_EXTRACT_MIN_ROOTS 32
+#endif
+
+#if __FLINT_VERSION >= 3
+
+static void mpz_upoly_get_arb_poly(arb_poly_t res, const mpz_upoly_t pol){
+  const long len = MAX(pol->length, 0);
+  arb_poly_fit_length(res, len);
+  for(long i = 0; i < len; i++){
+    arf_set_mpz(arb_midref(res->coeffs + i), pol->coeffs[i]);
+    mag_zero(arb_radref(res->coeffs + i));
+  }
+  _arb_poly_set_length(res, len);
+  _arb_poly_normalise(res);
+}
+
+/*
+  Evaluates the denominator and the coordinates of the parametrization at
+  all the non-exact roots at once, by fast multipoint evaluation in ball
+  arithmetic (subproduct trees), each root [r/2^k, (r+1)/2^k] being the
+  ball of center (2r+1)/2^(k+1) and radius 1/2^(k+1).
+
+  Balls enclose the values whatever the working precision. The root nc is
+  certified, and done[nc] set to 1, when the value of the denominator does
+  not contain 0 and all the coordinates are known up to 2^(-prec); other
+  roots are left to lazy_single_real_root_param. Roots with done[nc] != 0
+  on input are skipped.
+
+  returns the number of certified roots
+ */
+static long batch_real_roots_param(mpz_param_t param, interval *roots, long nb,
+                                   real_point_t *pts, long prec, long nbits,
+                                   int *done){
+  long *idx = malloc(sizeof(long) * nb);
+  long m = 0, kmax = 0;
+  for(long nc = 0; nc < nb; nc++){
+    if(done[nc] == 0 && roots[nc].isexact == 0 && roots[nc].k >= 0){
+      idx[m] = nc;
+      m++;
+      kmax = MAX(kmax, roots[nc].k);
+    }
+  }
+  if(m == 0){
+    free(idx);
+    return 0;
+  }
+  /* cancellations in the subproduct tree grow with the size of the roots
+   * and the degree */
+  const slong wprec = kmax + prec + nbits + 2 * FLINT_BIT_COUNT(param->nsols) + 64;
+
+  arb_ptr xs = _arb_vec_init(m);
+  arb_ptr den = _arb_vec_init(m);
+  arb_ptr ys = _arb_vec_init(m);
+  arb_poly_t pol;
+  arb_poly_init(pol);
+  arb_t v;
+  arb_init(v);
+  arf_t t;
+  arf_init(t);
+  fmpz_t z, e;
+  fmpz_init(z);
+  fmpz_init(e);
+
+  for(long j = 0; j < m; j++){
+    interval *rt = roots + idx[j];
+    fmpz_set_mpz(z, rt->numer);
+    fmpz_mul_2exp(z, z, 1);
+    fmpz_add_ui(z, z, 1);
+    fmpz_set_si(e, -(rt->k + 1));
+    arb_set_fmpz_2exp(xs + j, z, e);
+    mag_set_ui_2exp_si(arb_radref(xs + j), 1, -(rt->k + 1));
+  }
+
+  mpz_upoly_get_arb_poly(pol, param->denom);
+  arb_poly_evaluate_vec_fast(den, pol, xs, m, wprec);
+  for(long j = 0; j < m; j++){
+    done[idx[j]] = !arb_contains_zero(den + j);
+  }
+
+  for(long nv = 0; nv < param->nvars - 1; nv++){
+    mpz_upoly_get_arb_poly(pol, param->coords[nv]);
+    arb_poly_evaluate_vec_fast(ys, pol, xs, m, wprec);
+    fmpz_set_mpz(z, param->cfs[nv]);
+
+    for(long j = 0; j < m; j++){
+      long nc = idx[j];
+      if(done[nc] == 0){
+        continue;
+      }
+      /* coordinate is -coords[nv] / (cfs[nv] * denom) */
+      arb_mul_fmpz(v, den + j, z, wprec);
+      arb_div(v, ys + j, v, wprec);
+      arb_neg(v, v);
+      if(!arb_is_finite(v) || mag_cmp_2exp_si(arb_radref(v), -prec) > 0){
+        done[nc] = 0;
+        continue;
+      }
+      arb_get_lbound_arf(t, v, wprec);
+      arf_mul_2exp_si(t, t, prec);
+      arf_get_fmpz(e, t, ARF_RND_FLOOR);
+      fmpz_get_mpz(pts[nc]->coords[nv]->val_do, e);
+
+      arb_get_ubound_arf(t, v, wprec);
+      arf_mul_2exp_si(t, t, prec);
+      arf_get_fmpz(e, t, ARF_RND_CEIL);
+      fmpz_get_mpz(pts[nc]->coords[nv]->val_up, e);
+
+      pts[nc]->coords[nv]->k_up = prec;
+      pts[nc]->coords[nv]->k_do = prec;
+      pts[nc]->coords[nv]->isexact = 0;
+    }
+  }
+
+  long nbatch = 0;
+  for(long j = 0; j < m; j++){
+    long nc = idx[j];
+    if(done[nc] == 0){
+      continue;
+    }
+    interval *rt = roots + nc;
+    coord_struct *last = pts[nc]->coords[param->nvars - 1];
+    mpz_set(last->val_do, rt->numer);
+    mpz_add_ui(last->val_up, rt->numer, 1);
+    last->k_up = rt->k;
+    last->k_do = rt->k;
+    last->isexact = 0;
+    nbatch++;
+  }
+
+  fmpz_clear(z);
+  fmpz_clear(e);
+  arf_clear(t);
+  arb_clear(v);
+  arb_poly_clear(pol);
+  _arb_vec_clear(xs, m);
+  _arb_vec_clear(den, m);
+  _arb_vec_clear(ys, m);
+  free(idx);
+  return nbatch;
+}
+#endif
+
+/* computes the coordinates of the real points pts[nc] for the roots nc of
+ * param->elim such that skip[nc] == 0, the other points are not touched.
+ * With at least extract_min_roots roots (< 0: BATCH_EXTRACT_MIN_ROOTS),
+ * the parametrization is first evaluated at all of them at once. */
+static void extract_real_roots_param_of(mpz_param_t param, interval *roots,
+                                        long nb, real_point_t *pts,
+                                        const int *skip, long prec,
+                                        long nbits, double step,
+                                        int32_t extract_min_roots,
+                                        int info_level){
   long nsols = param->elim->length - 1;
   mpz_t *xup = malloc(sizeof(mpz_t)*nsols);
   mpz_t *xdo = malloc(sizeof(mpz_t)*nsols);
@@ -3344,10 +3952,31 @@ void extract_real_roots_param(mpz_param_t param, interval *roots, long nb,
   mpz_t s;
   mpz_init(s);
 
+  /* roots whose coordinates are already certified */
+  int *done = malloc(nb * sizeof(int));
+  memcpy(done, skip, nb * sizeof(int));
+#if __FLINT_VERSION >= 3
+  const long min_roots = extract_min_roots < 0 ?
+    BATCH_EXTRACT_MIN_ROOTS : extract_min_roots;
+  if(nb >= min_roots && param->nvars > 1){
+    double bt = realtime();
+    long nbatch = batch_real_roots_param(param, roots, nb, pts, prec, nbits,
+                                         done);
+    if(info_level){
+      fprintf(stderr, "Roots certified by multipoint evaluation: %ld / %ld ",
+              nbatch, nb);
+      fprintf(stderr, "(elapsed: %.2f sec)\n", realtime() - bt);
+    }
+  }
+#endif
+
   double et = realtime();
 
   for(long nc = 0; nc < nb; nc++){
     interval *rt = roots+nc;
+    if(done[nc]){
+      continue;
+    }
 
     lazy_single_real_root_param(param, polelim, rt, nb, pos_root,
                                 xdo, xup, den_up, den_do,
@@ -3387,20 +4016,29 @@ void extract_real_roots_param(mpz_param_t param, interval *roots, long nb,
   mpz_clear(pos_root->numer);
   free(pos_root);
 
-  normalize_points(pts, nb, param->nvars);
+  for(long nc = 0; nc < nb; nc++){
+    if(skip[nc] == 0){
+      normalize_points(pts + nc, 1, param->nvars);
+    }
+  }
+  free(done);
 
 }
 
+void extract_real_roots_param(mpz_param_t param, interval *roots, long nb,
+                              real_point_t *pts, long prec, long nbits,
+                              double step, int32_t extract_min_roots,
+                              int info_level){
+  int *skip = calloc(nb, sizeof(int));
+  extract_real_roots_param_of(param, roots, nb, pts, skip, prec, nbits,
+                              step, extract_min_roots, info_level);
+  free(skip);
+}
 
-static real_point_t *isolate_real_roots_param(mpz_param_t param, long *nb_real_roots_ptr,
-                                              interval **real_roots_ptr, 
-                                              int32_t precision,
-                                              int32_t nr_threads, int32_t info_level){
-  mpz_t *pol = malloc(param->elim->length * sizeof(mpz_t));
 
-  for(long i = 0; i < param->elim->length; i++){
-    mpz_init_set(pol[i], param->elim->coeffs[i]);
-  }
+/* maximum bit size of the coefficients of the elimination polynomial and
+ * of the numerators of the coordinates */
+static long mpz_param_max_bsize_coeffs(mpz_param_t param){
   long maxnbits = mpz_poly_max_bsize_coeffs(param->elim->coeffs,
                                             param->elim->length - 1);
 
@@ -3409,6 +4047,20 @@ static real_point_t *isolate_real_roots_param(mpz_param_t param, long *nb_real_r
                                           param->coords[i]->length - 1);
     maxnbits = MAX(cmax, maxnbits);
   }
+  return maxnbits;
+}
+
+static real_point_t *isolate_real_roots_param(mpz_param_t param, long *nb_real_roots_ptr,
+                                              interval **real_roots_ptr, 
+                                              int32_t precision,
+                                              int32_t extract_min_roots,
+                                              int32_t nr_threads, int32_t info_level){
+  mpz_t *pol = malloc(param->elim->length * sizeof(mpz_t));
+
+  for(long i = 0; i < param->elim->length; i++){
+    mpz_init_set(pol[i], param->elim->coeffs[i]);
+  }
+  long maxnbits = mpz_param_max_bsize_coeffs(param);
   long prec = MAX(precision, 128 + (maxnbits) / 32 );
   double st = realtime();
 
@@ -3436,7 +4088,7 @@ static real_point_t *isolate_real_roots_param(mpz_param_t param, long *nb_real_r
     }
 
     extract_real_roots_param(param, roots, nb, pts, precision, maxnbits,
-                             step, info_level);
+                             step, extract_min_roots, info_level);
     if(info_level){
       fprintf(stderr, "Elapsed time (real root extraction) = %.2f\n",
               realtime() - st);
@@ -3452,9 +4104,73 @@ static real_point_t *isolate_real_roots_param(mpz_param_t param, long *nb_real_r
   return pts;
 }
 
+/*
+  Refines the real points pts[idx[0]], ..., pts[idx[nidx-1]] of param up to
+  precision, the other points are not touched.
+
+  roots and pts are the nb isolating intervals and real points returned by
+  isolate_real_roots_param (pts being given in the order of the variables
+  of param), e.g. read back from a binary output file. The selected
+  intervals are refined from their current value, i.e. without isolating
+  again the roots of param->elim, then the coordinates of the selected
+  points are computed again.
+
+  returns 0 if ok, 1 if some index is out of range
+ */
+int refine_real_roots_param(mpz_param_t param, interval *roots, long nb,
+                            real_point_t *pts, const long *idx, long nidx,
+                            int32_t precision, int32_t extract_min_roots,
+                            int32_t nr_threads, int32_t info_level){
+  for(long i = 0; i < nidx; i++){
+    if(idx[i] < 0 || idx[i] >= nb){
+      fprintf(stderr, "Real root %ld does not exist ", idx[i]);
+      fprintf(stderr, "(%ld real roots)\n", nb);
+      return 1;
+    }
+  }
+  if(nidx == 0){
+    return 0;
+  }
+  mpz_t *pol = malloc(param->elim->length * sizeof(mpz_t));
+
+  for(long i = 0; i < param->elim->length; i++){
+    mpz_init_set(pol[i], param->elim->coeffs[i]);
+  }
+  long maxnbits = mpz_param_max_bsize_coeffs(param);
+  long prec = MAX(precision, 128 + (maxnbits) / 32 );
+  double st = realtime();
+
+  refine_real_roots(pol, param->elim->length - 1, roots, nb, idx, nidx,
+                    prec, nr_threads, info_level);
+  double step = (realtime() - st) / (nidx) * 10 * LOG2(precision);
+
+  int *skip = malloc(nb * sizeof(int));
+  for(long i = 0; i < nb; i++){
+    skip[i] = 1;
+  }
+  for(long i = 0; i < nidx; i++){
+    skip[idx[i]] = 0;
+  }
+  st = realtime();
+  extract_real_roots_param_of(param, roots, nb, pts, skip, precision,
+                              maxnbits, step, extract_min_roots, info_level);
+  if(info_level){
+    fprintf(stderr, "Elapsed time (real root extraction) = %.2f\n",
+            realtime() - st);
+  }
+  free(skip);
+
+  for(long i = 0; i < param->elim->length; i++){
+    mpz_clear(pol[i]);
+  }
+  free(pol);
+  return 0;
+}
+
 void isolate_real_roots_lparam(mpz_param_array_t lparams, long **lnbr_ptr,
                                interval ***lreal_roots_ptr, real_point_t ***lreal_pts_ptr,
-                               int32_t precision, int32_t nr_threads, int32_t info_level){
+                               int32_t precision, int32_t extract_min_roots,
+                               int32_t nr_threads, int32_t info_level){
   long *lnbr = malloc(sizeof(long) * lparams->nb);
   interval **lreal_roots = malloc(sizeof(interval *) * lparams->nb);
   real_point_t **lreal_pts = malloc(sizeof(real_point_t *) * lparams->nb);
@@ -3466,7 +4182,8 @@ void isolate_real_roots_lparam(mpz_param_array_t lparams, long **lnbr_ptr,
   for(int i = 0; i < lparams->nb; i++){
     lreal_pts[i] = isolate_real_roots_param(lparams->params[i], lnbr + i,
                                             lreal_roots + i,
-                                            precision, nr_threads, info_level);
+                                            precision, extract_min_roots,
+                                            nr_threads, info_level);
   }
   (*lnbr_ptr)        = lnbr;
   (*lreal_roots_ptr) = lreal_roots;
@@ -3494,6 +4211,9 @@ int real_msolve_qq(mpz_param_t *mpz_paramp,
                    int32_t print_gb,
                    int32_t pbm_file,
                    int32_t precision,
+                   int32_t extract_min_roots,
+                   int64_t mem_budget,
+                   int64_t spa_min_ncols,
                    files_gb *files,
                    int round,
                    int32_t get_param){
@@ -3525,6 +4245,8 @@ int real_msolve_qq(mpz_param_t *mpz_paramp,
                           info_level,
                           print_gb,
                           pbm_file,
+                          mem_budget,
+                          spa_min_ncols,
                           files,
                           round);
   double ct1 = cputime();
@@ -3547,7 +4269,8 @@ int real_msolve_qq(mpz_param_t *mpz_paramp,
   if(b==0 && *dim_ptr == 0 && *dquot_ptr > 0 && gens->field_char == 0){
 
     pts = isolate_real_roots_param(*mpz_paramp, nb_real_roots_ptr, real_roots_ptr,
-                                   precision, nr_threads, info_level);
+                                   precision, extract_min_roots, nr_threads,
+                                   info_level);
     int32_t nb = *nb_real_roots_ptr;
     if(nb){
       /* If we added a linear form for genericity reasons remove do not
@@ -3580,25 +4303,26 @@ int real_msolve_qq(mpz_param_t *mpz_paramp,
   return b;
 }
 
-void display_arrays_of_real_roots(files_gb *files, int32_t len, real_point_t **lreal_pts, long *lnbr){
+void display_arrays_of_real_roots(files_gb *files, int32_t len, real_point_t **lreal_pts, long *lnbr,
+                                  const int32_t nthrds){
   if(files->out_file != NULL){
     FILE *ofile = fopen(files->out_file, "a+");
     fprintf(ofile, "[");
     for(int i = 0; i < len - 1; i++){
-      display_real_points(ofile, lreal_pts[i], lnbr[i]);
+      display_real_points(ofile, lreal_pts[i], lnbr[i], nthrds);
       fprintf(ofile, ", \n");
     }
-    display_real_points(ofile, lreal_pts[len - 1], lnbr[len - 1]);
+    display_real_points(ofile, lreal_pts[len - 1], lnbr[len - 1], nthrds);
     fprintf(ofile, "];\n");
     fclose(ofile);
   }
   else{
     fprintf(stdout, "[");
     for(int i = 0; i < len - 1; i++){
-      display_real_points(stdout, lreal_pts[i], lnbr[i]);
+      display_real_points(stdout, lreal_pts[i], lnbr[i], nthrds);
       fprintf(stdout, ", \n");
     }
-    display_real_points(stdout, lreal_pts[len - 1], lnbr[len - 1]);
+    display_real_points(stdout, lreal_pts[len - 1], lnbr[len - 1], nthrds);
     fprintf(stdout, "];\n");
   }
 
@@ -3606,12 +4330,43 @@ void display_arrays_of_real_roots(files_gb *files, int32_t len, real_point_t **l
 
 
 
+/* writes the parametrization and, if computed, the real points and their
+ * isolating intervals in the binary format described at mpz_param_out_raw,
+ * real_points_out_raw and real_roots_out_raw */
+static void display_output_raw(files_gb *files, data_gens_ff_t *gens,
+                               mpz_param_t *mpz_paramp,
+                               int get_param,
+                               long *nb_real_roots_ptr,
+                               interval **real_roots_ptr,
+                               real_point_t **real_pts_ptr){
+  FILE *ofile = fopen(files->bin_out_file, "wb");
+  if(ofile == NULL){
+    fprintf(stderr, "Cannot open binary output file\n");
+    return;
+  }
+  mpz_param_out_raw(ofile, *mpz_paramp);
+  if(get_param <= 1){
+    real_points_out_raw(ofile, *real_pts_ptr, *nb_real_roots_ptr);
+    /* see real_msolve_qq for the swap of variables in the points */
+    int32_t lidx = -1;
+    if(get_param == 0 &&
+       gens->change_var_order != -1 &&
+       gens->change_var_order != (*mpz_paramp)->nvars - 1 &&
+       gens->linear_form_base_coef == 0){
+      lidx = gens->change_var_order;
+    }
+    real_roots_out_raw(ofile, *real_roots_ptr, *nb_real_roots_ptr, lidx);
+  }
+  fclose(ofile);
+}
+
 void display_output(int b, int dim, int dquot,
                     files_gb *files, data_gens_ff_t *gens,
                     param_t *param, mpz_param_t *mpz_paramp, int get_param,
                     long *nb_real_roots_ptr,
                     interval **real_roots_ptr,
                     real_point_t **real_pts_ptr,
+                    int32_t nr_threads,
                     int info_level){
   if(dquot == 0){
     if(files->out_file != NULL){
@@ -3627,18 +4382,24 @@ void display_output(int b, int dim, int dquot,
 
   if(dim == 0 && dquot >= 0){
     (*mpz_paramp)->nvars  = gens->nvars;
+    if(files->bin_out_file != NULL && gens->field_char == 0){
+      display_output_raw(files, gens, mpz_paramp, get_param,
+                         nb_real_roots_ptr, real_roots_ptr, real_pts_ptr);
+    }
     if(files->out_file != NULL){
       FILE *ofile = fopen(files->out_file, "a+");
       fprintf(ofile, "[0, ");
       if (get_param >= 1 || gens->field_char) {
-        mpz_param_out_str_maple(ofile, gens, dquot, *mpz_paramp, param);
+        mpz_param_out_str_maple(ofile, gens, dquot, *mpz_paramp, param,
+                                nr_threads);
       }
       if(get_param <= 1 && gens->field_char == 0){
         if(get_param){
           fprintf(ofile, ",");
         }
         display_real_points(
-                            ofile, *real_pts_ptr, *nb_real_roots_ptr);
+                            ofile, *real_pts_ptr, *nb_real_roots_ptr,
+                            nr_threads);
       }
       fprintf(ofile, "]:\n");
       fclose(ofile);
@@ -3646,14 +4407,15 @@ void display_output(int b, int dim, int dquot,
     else{
       fprintf(stdout, "[0, ");
       if (get_param >= 1  || gens->field_char) {
-        mpz_param_out_str_maple(stdout, gens, dquot, *mpz_paramp, param);
+        mpz_param_out_str_maple(stdout, gens, dquot, *mpz_paramp, param,
+                                nr_threads);
       }
       if(get_param <= 1 && gens->field_char == 0){
         if(get_param){
           fprintf(stdout, ",");
         }
         display_real_points(stdout, *real_pts_ptr,
-                            *nb_real_roots_ptr);
+                            *nb_real_roots_ptr, nr_threads);
       }
       fprintf(stdout, "]:\n");
     }
@@ -3680,12 +4442,14 @@ void manage_output(int b, int dim, int dquot,
                    long *nb_real_roots_ptr,
                    interval **real_roots_ptr,
                    real_point_t **real_pts_ptr,
+                   int32_t nr_threads,
                    int info_level){
   if(b == 0){
     display_output(b, dim, dquot, files, gens, param, mpz_paramp, get_param,
                    nb_real_roots_ptr,
                    real_roots_ptr,
                    real_pts_ptr,
+                   nr_threads,
                    info_level);
   }
   if(b==-2){
@@ -3721,6 +4485,9 @@ int core_msolve(
   int32_t normal_form_matrix,
   int32_t is_gb,
   int32_t precision,
+  int32_t extract_min_roots,
+  int64_t mem_budget,
+  int64_t spa_min_ncols,
   files_gb *files,
   data_gens_ff_t *gens,
   param_t **paramp,
@@ -3767,13 +4534,14 @@ restart:
 
             int success = 0;
 
+            /* signature based computations always use 32 bit coefficient
+             * arrays, also for small field characteristics */
             success = initialize_gba_input_data(&bs, &bht, &st,
                     gens->lens, gens->exps, (void *)gens->cfs,
-                    1073741827, 0 /* DRL order */, elim_block_len, gens->nvars,
-                    /* gens->field_char, 0 [> DRL order <], gens->nvars, */
+                    gens->field_char, 0 /* DRL order */, elim_block_len, gens->nvars,
                     gens->ngens, saturate, initial_hts, nr_threads, max_pairs,
                     update_ht, la_option, use_signatures, 1 /* reduce_gb */, 0,
-                    info_level);
+                    info_level, mem_budget, spa_min_ncols, files->ooc_dir);
 
             if (st->homogeneous != 1) {
                 fprintf(stderr,
@@ -3782,11 +4550,6 @@ restart:
             }
 
             st->gfc  = gens->field_char;
-            if(info_level){
-                fprintf(stderr,
-                        "NOTE: Field characteristic is now corrected to %u\n",
-                        st->gfc);
-            }
             if (!success) {
                 printf("Bad input data, stopped computation.\n");
                 exit(1);
@@ -3813,6 +4576,10 @@ restart:
                 fprintf(stderr, "Something went wrong during the computation\n");
                 return -1;
             }
+            if (print_gb) {
+                print_ff_basis_data(files->out_file, "a", bs, bht,
+                        st, gens, print_gb);
+            }
             return 0;
         }
 
@@ -3851,7 +4618,7 @@ restart:
                     /* gens->field_char, 0 [> DRL order <], gens->nvars, */
                     gens->ngens, saturate, initial_hts, nr_threads, max_pairs,
                     update_ht, la_option, use_signatures, 1 /* reduce_gb */, 0,
-                    info_level);
+                    info_level, mem_budget, spa_min_ncols, files->ooc_dir);
 
             st->gfc  = gens->field_char;
             set_ff_bits(st, st->gfc);
@@ -3953,7 +4720,7 @@ restart:
                     /* gens->field_char, 0 [> DRL order <], gens->nvars, */
                     gens->ngens, 1, initial_hts, nr_threads, max_pairs,
                     update_ht, la_option, use_signatures, 1 /* reduce_gb */, 0,
-                    info_level);
+                    info_level, mem_budget, spa_min_ncols, files->ooc_dir);
 
 	    st->gfc  = gens->field_char;
             if(info_level){
@@ -4238,7 +5005,9 @@ restart:
 		       initial_hts, unstable_staircase, nr_threads, max_pairs,
                        elim_block_len, update_ht,
                        la_option, use_signatures, info_level, print_gb,
-                       generate_pbm, precision, files, round, get_param);
+                       generate_pbm, precision, extract_min_roots, mem_budget,
+                       spa_min_ncols, files,
+                       round, get_param);
           if(print_gb){
             return 0;
           }
@@ -4247,6 +5016,7 @@ restart:
                         nb_real_roots_ptr,
                         real_roots_ptr,
                         real_pts_ptr,
+                        nr_threads,
                         info_level);
 
 
@@ -4361,7 +5131,7 @@ restart:
                     /* gens->field_char, 0 [> DRL order <], gens->nvars, */
                     gens->ngens, normal_form, initial_hts, nr_threads, max_pairs,
                     update_ht, la_option, use_signatures, 1 /* reduce_gb */, 0,
-                    info_level);
+                    info_level, mem_budget, spa_min_ncols, files->ooc_dir);
 
             st->gfc  = gens->field_char;
             if (!success) {
@@ -4555,7 +5325,7 @@ restart:
 
             /* sort initial elements, smallest lead term first */
             sort_r(bs_qq->hm, (unsigned long)bs_qq->ld, sizeof(hm_t *),
-                    initial_input_cmp, bht);
+                    st->fp.initial_input_cmp, bht);
             remove_content_of_initial_basis(bs_qq);
 
 
@@ -4568,11 +5338,10 @@ restart:
             /* initialize tracer */
             trace_t *trace  = initialize_trace(bs_qq, st);
 
-            srand(time(0));
             uint32_t prime = next_prime(1<<30);
-            prime = next_prime(rand() % (1303905301 - (1<<30) + 1) + (1<<30));
+            prime = next_prime(random_number() % (1303905301 - (1<<30) + 1) + (1<<30));
             while(is_lucky_prime_ui(prime, bs_qq)){
-                prime = next_prime(rand() % (1303905301 - (1<<30) + 1) + (1<<30));
+                prime = next_prime(random_number() % (1303905301 - (1<<30) + 1) + (1<<30));
             }
 
             uint32_t primeinit = prime;
@@ -4666,220 +5435,66 @@ restart:
         }
 #endif
       /* characteristic is 0 */
-      /* characteristic is 0 and elim_block = 0 */
-      if (saturate == 1) {       /* characteristic is 0 and elim_block = 0 */
-            /* timings */
-            double ct0, ct1, rt0, rt1;
-            ct0 = cputime();
-            rt0 = realtime();
-            uint32_t field_char         = gens->field_char;
-            const uint32_t prime_start  = (uint32_t)(1) << 30;
-            const int32_t nr_primes     = nr_threads;
-
-            /* data structures for basis, hash table and statistics */
-            bs_t *sat_qq   = NULL;
-
-            /* initialize stuff */
-            md_t *st  = allocate_meta_data();
-
-            int *invalid_gens       =   NULL;
-            int32_t monomial_order  =   0;
-            int32_t reduce_gb       =   1;
-            int res = validate_input_data(&invalid_gens, gens->mpz_cfs,
-                    gens->lens, &field_char, &monomial_order, &elim_block_len,
-                    &gens->nvars, &gens->ngens, &saturate, &initial_hts,
-                    &nr_threads, &max_pairs, &update_ht, &la_option,
-                    &use_signatures, &reduce_gb, &info_level);
-
-            /* all data is corrupt */
-            if (res == -1) {
-                fprintf(stderr, "Invalid input generators, msolve now terminates.\n");
-                free(invalid_gens);
-                return -3;
-            }
-
-            /* checks and set all meta data. if a nonzero value is returned then
-             * some of the input data is corrupted. */
-            if (check_and_set_meta_data_trace(st, gens->lens, gens->exps,
-                        (void *)gens->mpz_cfs, invalid_gens,
-                        field_char, 0, elim_block_len, gens->nvars,
-                        gens->ngens, saturate, initial_hts, nr_threads,
-                        max_pairs, update_ht, la_option, use_signatures,
-                        1, prime_start, nr_primes, 0, info_level)) {
-                free(st);
-                return -3;
-            }
-
-            /* lucky primes */
-            primes_t *lp  = (primes_t *)calloc(1, sizeof(primes_t));
-
-            /*******************
-             * initialize basis
-             *******************/
-            bs_t *bs_qq = initialize_basis(st);
-            /* initialize basis hash table, update hash table, symbolic hash table */
-            ht_t *bht = bs_qq->ht;
-            /* hash table to store the hashes of the multiples of
-             * the basis elements stored in the trace */
-            ht_t *tht = initialize_secondary_hash_table(bht, st);
-            /* read in ideal, move coefficients to integers */
-            import_input_data(bs_qq, st, 0, st->ngens_input, gens->lens, gens->exps,
-                    (void *)gens->mpz_cfs, invalid_gens);
-            free(invalid_gens);
-            invalid_gens    =   NULL;
-
-            print_initial_statistics(stderr, st);
-
-            /* for faster divisibility checks, needs to be done after we have
-             * read some input data for applying heuristics */
-            calculate_divmask(bht);
-
-            /* sort initial elements, smallest lead term first */
-            sort_r(bs_qq->hm, (unsigned long)bs_qq->ld, sizeof(hm_t *),
-                    initial_input_cmp, bht);
-            remove_content_of_initial_basis(bs_qq);
-
-
-            /* generate lucky prime numbers */
-            generate_lucky_primes(lp, bs_qq, st->prime_start, st->nprimes);
-
-            /* generate array to store modular bases */
-            bs_t **bs = (bs_t **)calloc((unsigned long)st->nprimes, sizeof(bs_t *));
-
-            /* initialize tracer */
-            trace_t *trace  = initialize_trace(bs_qq, st);
-
-            st->tr = trace;
-
-            srand(time(0));
-            uint32_t prime = next_prime(1<<30);
-            prime = next_prime(rand() % (1303905301 - (1<<30) + 1) + (1<<30));
-            while(is_lucky_prime_ui(prime, bs_qq)){
-                prime = next_prime(rand() % (1303905301 - (1<<30) + 1) + (1<<30));
-            }
-
-            uint32_t primeinit = prime;
-            lp->p[0] = primeinit;
-
-
-            if (is_gb == 1) {
-                for (len_t k = 0; k < bs_qq->ld; ++k) {
-                    bs_qq->lmps[k] = k;
-                    bs_qq->lm[k]   = bht->hd[bs_qq->hm[k][OFFSET]].sdm;
-                    bs_qq->lml     = bs_qq->ld;
-                }
-            }
-            sat_qq = initialize_basis(st);
-            sat_qq->ht = bht;
-            import_input_data(
-                    sat_qq, st, gens->ngens-saturate, gens->ngens,
-                    gens->lens, gens->exps, (void *)gens->mpz_cfs, NULL);
-            sat_qq->ld = sat_qq->lml  =  saturate;
-            /* normalize_initial_basis(tbr, st->gfc); */
-            for (int k = 0; k < saturate; ++k) {
-                sat_qq->lmps[k]  = k; /* fix input element in tbr */
-            }
-
-            printf("LEARNING PHASE -- PART 1\n");
-            f4sat_trace_learning_phase_1(
-                    trace,
-                    tht,
-                    bs_qq,
-                    sat_qq,
-                    &bht,
-                    st,
-                    lp->p[0]);
-
-            /* int64_t nb  = export_results_from_gba(bld, blen, bexp,
-             *         bcf, &bs, &bht, &st); */
-
-            /* timings */
-            ct1 = cputime();
-            rt1 = realtime();
-            st->f4_ctime = ct1 - ct0;
-            st->f4_rtime = rt1 - rt0;
-
-            get_and_print_final_statistics(stderr, st, bs_qq);
-
-            if(info_level){
-                fprintf(stderr, "\nStarts trace based multi-modular computations\n");
+      if (normal_form > 0) {
+            /* the Groebner basis of the first generators and the normal
+             * forms of the last normal_form ones are computed modulo
+             * several primes in parallel, the normal forms are lifted */
+            if (elim_block_len > 0) {
+                fprintf(stderr, "Normal forms are only available for ");
+                fprintf(stderr, "degree reverse lexicographical orders.\n");
+                return -1;
             }
-
-            prime = next_prime(1<<30);
-
-            lp->p[0]  = prime;
-
-            printf("LEARNING PHASE -- PART 2\n");
-            f4sat_trace_learning_phase_2(
-                    trace,
-                    tht,
-                    bs_qq,
-                    sat_qq,
-                    &bht,
-                    st,
-                    lp->p[0]);
-
-            /* int64_t nb  = export_results_from_gba(bld, blen, bexp,
-             *         bcf, &bs, &bht, &st); */
-
-            /* timings */
-            ct1 = cputime();
-            rt1 = realtime();
-            st->f4_ctime = ct1 - ct0;
-            st->f4_rtime = rt1 - rt0;
-
-            get_and_print_final_statistics(stderr, st, bs_qq);
-
-            if(info_level){
-                fprintf(stderr, "\nStarts trace based multi-modular computations\n");
+            if (normal_form_matrix > 0) {
+                fprintf(stderr, "Warning: normal form matrices are not ");
+                fprintf(stderr, "available over the rationals.\n");
             }
-
-            int i;
-
-            ht_t *lht = copy_hash_table(bht);
-
-            prime = next_prime(1<<30);
-
-            /* while(rerun == 1 || mcheck == 1){ */
-
-                /* generate lucky prime numbers */
-                prime = next_prime(prime);
-                lp->p[0] = prime;
-                while(is_lucky_prime_ui(prime, bs_qq) || prime==primeinit){
-                    prime = next_prime(prime);
-                    lp->p[0] = prime;
-                }
-
-                for(len_t i = 1; i < st->nprimes; i++){
-                    prime = next_prime(prime);
-                    lp->p[i] = prime;
-                    while(is_lucky_prime_ui(prime, bs_qq) || prime==primeinit){
-                        prime = next_prime(prime);
-                        lp->p[i] = prime;
-                    }
-                }
-                prime = lp->p[st->nprimes - 1];
-
-                double ca0;
-
-                double stf4 = 0;
-
-                for (i = 0; i < st->nprimes; ++i){
-                    ca0 = realtime();
-                    bs[i] = f4sat_trace_application_phase(
-                            trace,
-                            tht,
-                            bs_qq,
-                            sat_qq,
-                            lht,
-                            st,
-                            lp->p[i]);
-
-                    stf4 = realtime()-ca0;
-                    printf("F4 trace timing %13.2f\n", stf4);
-                    /* printf("bs[%u]->lml = %u\n", i, bs[i]->lml); */
-                }
-            /* } */
+            msflags_t flags;
+
+            flags->ht_size = initial_hts;
+            flags->nr_threads = nr_threads;
+            flags->max_nr_pairs = max_pairs;
+            flags->elim_block_len = 0;
+            flags->truncate_lifting = 0;
+            flags->saturate = 0;
+            flags->normal_form = normal_form;
+            flags->reset_ht = update_ht;
+            flags->la_option = la_option;
+            flags->use_signatures = use_signatures;
+            flags->info_level = info_level;
+            flags->pbm_file = generate_pbm;
+            flags->mem_budget = mem_budget;
+            flags->spa_min_ncols = spa_min_ncols;
+            flags->print_gb = 2;
+            flags->files = files;
+
+            print_msolve_gbtrace_qq(gens, flags);
+            return 0;
+      }
+      /* characteristic is 0 and elim_block = 0 */
+      if (saturate == 1) {       /* characteristic is 0 and elim_block = 0 */
+            /* the saturated ideal is lifted from its reduced Groebner
+             * bases modulo several primes computed in parallel by the
+             * f4sat tracer, there is no parametrization to compute */
+            msflags_t flags;
+
+            flags->ht_size = initial_hts;
+            flags->nr_threads = nr_threads;
+            flags->max_nr_pairs = max_pairs;
+            flags->elim_block_len = elim_block_len;
+            flags->truncate_lifting = truncate_lifting;
+            flags->saturate = saturate;
+            flags->normal_form = 0;
+            flags->reset_ht = update_ht;
+            flags->la_option = la_option;
+            flags->use_signatures = use_signatures;
+            flags->info_level = info_level;
+            flags->pbm_file = generate_pbm;
+            flags->mem_budget = mem_budget;
+            flags->spa_min_ncols = spa_min_ncols;
+            flags->print_gb = print_gb > 0 ? print_gb : 2;
+            flags->files = files;
+
+            print_msolve_gbtrace_qq(gens, flags);
             return 0;
       } else {       /* characteristic is 0 and elim_block = 0 and saturate = 0 */
 
@@ -4903,11 +5518,15 @@ restart:
               flags->max_nr_pairs = max_pairs;
               flags->elim_block_len = elim_block_len;
               flags->truncate_lifting = truncate_lifting;
+              flags->saturate = 0;
+              flags->normal_form = 0;
               flags->reset_ht = update_ht;
               flags->la_option = la_option;
               flags->use_signatures = use_signatures;
               flags->info_level = info_level;
               flags->pbm_file = generate_pbm;
+              flags->mem_budget = mem_budget;
+              flags->spa_min_ncols = spa_min_ncols;
               flags->print_gb = print_gb;
               flags->files = files;
 
@@ -4926,7 +5545,9 @@ restart:
 		    initial_hts, unstable_staircase, nr_threads, max_pairs,
                     elim_block_len, update_ht,
                     la_option, use_signatures, info_level, print_gb,
-                    generate_pbm, precision, files, round, get_param);
+                    generate_pbm, precision, extract_min_roots, mem_budget,
+                    spa_min_ncols, files,
+                    round, get_param);
 
             if(print_gb){
               return 0;
@@ -4936,6 +5557,7 @@ restart:
                           nb_real_roots_ptr,
                           real_roots_ptr,
                           real_pts_ptr,
+                          nr_threads,
                           info_level);
             if (b == 1) {
                 free(bld);
@@ -5235,6 +5857,8 @@ void msolve_julia(
     interval *real_roots    = NULL;
     real_point_t *real_pts  = NULL;
 
+    set_random_seed((uint32_t)time(0));
+
     /* main msolve functionality */
     int ret = core_msolve(la_option, use_signatures, nr_threads, info_level,
 			  initial_hts, max_nr_pairs, elim_block_len, reset_ht,
@@ -5243,7 +5867,9 @@ void msolve_julia(
 			  genericity_handling, 0 /* unstable_staircase -> change to 2?*/,
 			  0 /* saturate */, 0 /* colon */,
 			  0 /* normal_form */, 0 /* normal_form_matrix */,
-			  0 /* is_gb */, precision, files,
+			  0 /* is_gb */, precision, -1 /* extract_min_roots */,
+			  0 /* mem_budget */,
+			  -1 /* spa_min_ncols */, files,
 			  gens, &param, &mpz_param, &nb_real_roots, &real_roots, &real_pts);
 
     if (ret == -1) {
@@ -40,6 +40,8 @@ int msolve_trace_qq(
         int32_t info_level,
         int32_t print_gb,
         int32_t pbm_file,
+        int64_t mem_budget,
+        int64_t spa_min_ncols,
         files_gb *files,
         int
         );
@@ -106,11 +108,27 @@ int real_msolve_qq(
         int32_t print_gb,
         int32_t pbm_file,
         int32_t precision,
+        int32_t extract_min_roots,
+        int64_t mem_budget,
+        int64_t spa_min_ncols,
         files_gb *files,
         int,
         int32_t
         );
 
+int refine_real_roots_param(
+        mpz_param_t param,
+        interval *roots,
+        long nb,
+        real_point_t *pts,
+        const long *idx,
+        long nidx,
+        int32_t precision,
+        int32_t extract_min_roots,
+        int32_t nr_threads,
+        int32_t info_level
+        );
+
 int core_msolve(
         int32_t la_option,
         int32_t use_signatures,
@@ -133,6 +151,9 @@ int core_msolve(
         int32_t normal_form_matrix,
         int32_t is_gb,
         int32_t precision,
+        int32_t extract_min_roots,
+        int64_t mem_budget,
+        int64_t spa_min_ncols,
         files_gb *files,
         data_gens_ff_t *gens,
         param_t **paramp,
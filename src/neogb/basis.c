@@ -145,6 +145,9 @@ void free_basis_without_hash_table(
     bs->lm  = NULL;
     free(bs->red);
     bs->red = NULL;
+    free(bs->oco);
+    bs->oco = NULL;
+    free_out_of_core_storage(&(bs->oc));
     /* signatures */
     free(bs->sm);
     bs->sm  =   NULL;
@@ -242,6 +245,105 @@ void check_enlarge_basis(
             default:
                 exit(1);
         }
+        if (bs->oco != NULL) {
+            bs->oco = realloc(bs->oco, (unsigned long)bs->sz * sizeof(int64_t));
+            memset(bs->oco+bs->ld, -1,
+                    (unsigned long)(bs->sz-bs->ld) * sizeof(int64_t));
+        }
+    }
+}
+
+/* coefficient arrays of finite field bases, NULL otherwise */
+static void **basis_coefficients(
+        const bs_t * const bs,
+        const md_t * const st
+        )
+{
+    switch (st->ff_bits) {
+        case 8:
+            return (void **)bs->cf_8;
+        case 16:
+            return (void **)bs->cf_16;
+        case 32:
+            return (void **)bs->cf_32;
+        default:
+            return NULL;
+    }
+}
+
+/* redundant elements are only needed again if a pending S-pair still
+ * refers to them, so their coefficients are moved out of core. each
+ * array is written only once, later spills just free the copy read
+ * back by load_spilled_basis_elements(). */
+void spill_redundant_basis_elements(
+        bs_t *bs,
+        const md_t * const st
+        )
+{
+    len_t i;
+
+    void **cf = basis_coefficients(bs, st);
+    if (st->ooc_dir == NULL || cf == NULL) {
+        return;
+    }
+    if (bs->oc == NULL) {
+        bs->oc  = initialize_out_of_core_storage(st->ooc_dir);
+        if (bs->oc == NULL) {
+            return;
+        }
+        bs->oco = (int64_t *)malloc((unsigned long)bs->sz * sizeof(int64_t));
+        memset(bs->oco, -1, (unsigned long)bs->sz * sizeof(int64_t));
+    }
+
+    const int64_t cs  = st->ff_bits / 8;
+
+    for (i = 0; i < bs->ld; ++i) {
+        if (bs->red[i] == 0 || bs->hm[i] == NULL) {
+            continue;
+        }
+        const len_t idx = bs->hm[i][COEFFS];
+        if (cf[idx] == NULL) {
+            continue;
+        }
+        if (bs->oco[i] == -1) {
+            bs->oco[i] = write_out_of_core(bs->oc, cf[idx],
+                    (int64_t)bs->hm[i][LENGTH] * cs);
+            if (bs->oco[i] == -1) {
+                continue;
+            }
+        }
+        free(cf[idx]);
+        cf[idx] = NULL;
+    }
+}
+
+void load_spilled_basis_elements(
+        bs_t *bs,
+        const len_t *gens,
+        const len_t ngens,
+        const md_t * const st
+        )
+{
+    len_t i;
+
+    void **cf = basis_coefficients(bs, st);
+    if (bs->oc == NULL || cf == NULL) {
+        return;
+    }
+
+    const int64_t cs  = st->ff_bits / 8;
+
+    for (i = 0; i < ngens; ++i) {
+        const len_t idx = bs->hm[gens[i]][COEFFS];
+        if (cf[idx] != NULL) {
+            continue;
+        }
+        const int64_t len = (int64_t)bs->hm[gens[i]][LENGTH] * cs;
+        cf[idx] = malloc((unsigned long)len);
+        if (read_out_of_core(bs->oc, cf[idx], len, bs->oco[gens[i]]) == -1) {
+            fprintf(stderr, "Cannot read basis element from disk.\n");
+            exit(1);
+        }
     }
 }
 
@@ -392,7 +494,13 @@ bs_t *copy_basis_mod_p(
     bs->sz          = gbs->sz;
     bs->constant    = gbs->constant;
     if (st->f4_qq_round != 1) {
-        bs->ht = copy_hash_table(gbs->ht);
+        /* the global basis hash table is not changed during application
+         * runs, so we can share its exponent vectors */
+        if (st->trace_level == APPLY_TRACER) {
+            bs->ht = copy_hash_table_shared_exponents(gbs->ht);
+        } else {
+            bs->ht = copy_hash_table(gbs->ht);
+        }
     } else {
         bs->ht = gbs->ht;
     }
@@ -53,4 +53,16 @@ void check_enlarge_basis(
         const len_t added,
         const md_t *st
         );
+
+void spill_redundant_basis_elements(
+        bs_t *bs,
+        const md_t * const st
+        );
+
+void load_spilled_basis_elements(
+        bs_t *bs,
+        const len_t *gens,
+        const len_t ngens,
+        const md_t * const st
+        );
 #endif
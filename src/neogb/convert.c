@@ -49,7 +49,7 @@ static void convert_multipliers_to_columns(
     for (i = 0; i < sat->ld; ++i) {
         hcm[i]  = sat->hm[i][MULT];
     }
-    sort_r(hcm, (unsigned long)sat->ld, sizeof(hi_t), hcm_cmp, ht);
+    sort_r(hcm, (unsigned long)sat->ld, sizeof(hi_t), st->fp.hcm_cmp, ht);
 
     /* printf("hcmm\n");
      * for (int ii=0; ii<sat->ld; ++ii) {
@@ -114,7 +114,7 @@ static void convert_hashes_to_columns_sat(
             k++;
         }
     }
-    sort_r(hcm, (unsigned long)j, sizeof(hi_t), hcm_cmp, sht);
+    sort_r(hcm, (unsigned long)j, sizeof(hi_t), st->fp.hcm_cmp, sht);
 
     /* printf("hcm\n");
      * for (int ii=0; ii<j; ++ii) {
@@ -242,7 +242,7 @@ static void sba_convert_hashes_to_columns(
     }
 
     hcm = realloc(hcm, (unsigned long)k * sizeof(hi_t));
-    sort_r(hcm, (unsigned long)k, sizeof(hi_t), hcm_cmp, ht);
+    sort_r(hcm, (unsigned long)k, sizeof(hi_t), st->fp.hcm_cmp, ht);
 
     smat->nc = k;
 
@@ -333,7 +333,7 @@ static void convert_hashes_to_columns(
             k++;
         }
     }
-    sort_r(hcm, (unsigned long)j, sizeof(hi_t), hcm_cmp, sht);
+    sort_r(hcm, (unsigned long)j, sizeof(hi_t), st->fp.hcm_cmp, sht);
 
     /* printf("hcm\n");
     for (int ii=0; ii<j; ++ii) {
@@ -408,6 +408,11 @@ static void convert_hashes_to_columns(
      * added elements have all their terms sorted correctly w.r.t. the given
      * monomial order. */
 
+    /* fill in due to symbolic preprocessing for the memory budget */
+    if (st->sel_nnz > 0) {
+        st->mat_fill  = (double)nterms / (double)st->sel_nnz;
+    }
+
     /* compute density of matrix */
     nterms  *=  100; /* for percentage */
     double density = (double)nterms / (double)mnr / (double)ld;
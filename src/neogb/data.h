@@ -48,6 +48,38 @@ inline omp_int_t omp_get_max_threads(void) { return 1;}
  * NOTE: if one changes UNROLL then also code needs to be changed:
  * the unrolled loops are hardcoded to 4 at the moment */
 #define UNROLL  4
+/* very sparse matrices are reduced with sparse accumulators, i.e. only
+ * touched columns are visited via a heap instead of scanning dense rows:
+ * the matrix needs at least SPA_MIN_NCOLS columns and its rows have to
+ * have on average less than ncols / SPA_DENSITY_RATIO entries. The column
+ * threshold can also be changed at runtime, see set_spa_min_ncols() */
+#ifndef SPA_MIN_NCOLS
+#define SPA_MIN_NCOLS     65536
+#endif
+#ifndef SPA_DENSITY_RATIO
+#define SPA_DENSITY_RATIO 1000
+#endif
+/* the basis hash table is compacted automatically if less than
+ * 1/HT_COMPACT_RATIO of its monomials are still in use, tables with
+ * less than HT_COMPACT_MIN_LOAD monomials are not checked */
+#define HT_COMPACT_RATIO    2
+#define HT_COMPACT_MIN_LOAD 65536
+/* on x86 the vector kernels are compiled for several SIMD extensions side
+ * by side via target attributes, the one used is chosen at runtime by
+ * simd_level(), so one binary runs on all cpus of a given architecture */
+#if (defined __x86_64__ || defined __i386__) && defined __GNUC__
+#define SIMD_DISPATCH 1
+#define TARGET_AVX2   __attribute__((target("avx2")))
+#define TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512bw")))
+#else
+#define TARGET_AVX2
+#define TARGET_AVX512
+#endif
+/* SIMD extensions for the vector kernels */
+#define SIMD_AUTO   0   /* best one supported by the cpu */
+#define SIMD_NONE   1
+#define SIMD_AVX2   2
+#define SIMD_AVX512 3
 /* we store some more information in the row arrays,
  * real data starts at index OFFSET */
 #define OFFSET  6           /* real data starts at OFFSET */
@@ -128,6 +160,10 @@ struct ht_t
     hl_t eld;     /* load of exponent vector */
     hl_t esz;     /* size of exponent vector */
     hl_t hsz;     /* size of hash map, might be 2^32 */
+    hl_t sld;     /* number of exponent vectors 1,...,sld shared read-only
+                   * with another hash table, 0 if all are owned by this
+                   * table; ev[0] is always owned and starts the local
+                   * exponent block */
     len_t ebl;    /* elimination block length:
                    * degree + #elimination variables,
                    * 0 if no elimination order */
@@ -141,6 +177,26 @@ struct ht_t
     len_t bpv;    /* bits per variable in divmask */
     val_t *rn;    /* random numbers for hash generation */
     uint32_t rsd; /* seed for random number generator */
+    /* monomial comparison w.r.t. the monomial order of the computation,
+     * stored here since comparisons only get the hash table as context */
+    int (*monomial_cmp)(
+            const hi_t a,
+            const hi_t b,
+            const ht_t *ht
+            );
+};
+
+/* storage of a freed hash table kept for the next hash table of the
+ * same sizes in the same thread, see enable_hash_table_reuse() */
+typedef struct hts_t hts_t;
+struct hts_t
+{
+    exp_t **ev;   /* exponent vector, ev[0] starts the exponent block */
+    hd_t *hd;     /* hash data */
+    hi_t *hmap;   /* hash map */
+    hl_t esz;     /* size of exponent vector */
+    hl_t hsz;     /* size of hash map */
+    len_t evl;    /* length of exponent vectors */
 };
 
 /* S-pair types */
@@ -174,6 +230,15 @@ struct crit_t
     len_t sz;   // allocated memory / size of the corresponding arrays
 };
 
+/* out-of-core storage: data is appended to an unlinked temporary file
+ * and read back on demand, see set_out_of_core_dir() */
+typedef struct oc_t oc_t;
+struct oc_t
+{
+    int fd;         /* file descriptor of the temporary file */
+    int64_t ld;     /* load of the file in bytes */
+};
+
 /* basis stuff */
 typedef struct bs_t bs_t;
 struct bs_t
@@ -197,6 +262,9 @@ struct bs_t
     cf32_t **cf_32; /* coefficients for finite fields (32 bit) */
     mpz_t **cf_qq;  /* coefficients for rationals (always multiplied such that
                        the denominator is 1) */
+    oc_t *oc;       /* out-of-core storage of redundant elements */
+    int64_t *oco;   /* offsets of coefficient arrays in oc, -1 if the
+                       coefficients were never written to oc */
 };
 
 /* matrix stuff */
@@ -296,6 +364,8 @@ struct td_t
     len_t rld;    /* load of reducer rows information*/
     len_t tld;    /* load of to be reduced rows information*/
     len_t nlm;    /* number of new leading monomials in this step */
+    int64_t off;  /* offset of rri, tri and rba in the trace file */
+    int64_t len;  /* bytes stored in the trace file, 0 if in core */
 };
 
 /* possible trace levels */
@@ -320,17 +390,175 @@ struct trace_t
                    * non-trivial kernels */
     len_t rld;    /* load of rounds stored, i.e. how often do saturate */
     len_t rsz;    /* size of rounds stored */
+    oc_t *oc;     /* out-of-core storage of td rounds */
+    char *map;    /* read-only mapping of oc used when applying */
+    int64_t msz;  /* size of map in bytes */
+    int nap;      /* number of runs currently applying the trace */
 };
 
 
-/* meta data stuff */
+/* dispatch table for all routines depending on the field characteristic,
+ * the monomial order and the chosen linear algebra, it is part of the
+ * meta data so that independent computations can run concurrently,
+ * see set_function_pointers() */
 typedef struct md_t md_t;
+typedef struct fp_t fp_t;
+struct fp_t
+{
+    void (*normalize_initial_basis)(
+            bs_t *bs,
+            const uint32_t fc
+            );
+
+    int (*initial_input_cmp)(
+            const void *a,
+            const void *b,
+            void *ht
+            );
+
+    int (*initial_gens_cmp)(
+            const void *a,
+            const void *b,
+            void *ht
+            );
+
+    int (*spair_cmp)(
+            const void *a,
+            const void *b,
+            void *htp
+            );
+
+    int (*hcm_cmp)(
+            const void *a,
+            const void *b,
+            void *htp
+            );
+
+    /* linear algebra routines */
+    void (*sba_linear_algebra)(
+            smat_t *smat,
+            crit_t *syz,
+            md_t *st,
+            const ht_t * const ht
+            );
+
+    void (*exact_linear_algebra)(
+            mat_t *mat,
+            const bs_t * const tbr,
+            const bs_t * const bs,
+            md_t *st
+            );
+
+    void (*linear_algebra)(
+            mat_t *mat,
+            const bs_t * const tbr,
+            const bs_t * const bs,
+            md_t *st
+            );
+
+    int (*application_linear_algebra)(
+            mat_t *mat,
+            const bs_t * const bs,
+            md_t *st
+            );
+
+    void (*trace_linear_algebra)(
+            trace_t *trace,
+            mat_t *mat,
+            const bs_t * const bs,
+            md_t *st
+            );
+
+    void (* interreduce_matrix_rows)(
+            mat_t *mat,
+            bs_t *bs,
+            md_t *st,
+            int free_basis
+            );
+
+    cf32_t *(*reduce_dense_row_by_old_pivots_ff_32)(
+            int64_t *dr,
+            mat_t *mat,
+            const bs_t * const bs,
+            hm_t * const * const pivs,
+            const hi_t dpiv,
+            const uint32_t fc
+            );
+
+    hm_t *(*sba_reduce_dense_row_by_known_pivots_sparse_ff_32)(
+            int64_t *dr,
+            smat_t *smat,
+            hm_t *const *pivs,
+            const hi_t dpiv,    /* pivot of dense row at the beginning */
+            const hm_t sm,      /* signature monomial of row reduced */
+            const len_t si,     /* signature index of row reduced */
+            const len_t ri,     /* index of row in matrix */
+            md_t *st
+            );
+
+    hm_t *(*reduce_dense_row_by_known_pivots_sparse_ff_32)(
+            int64_t *dr,
+            mat_t *mat,
+            const bs_t * const bs,
+            hm_t *const *pivs,
+            const hi_t dpiv,
+            const hm_t tmp_pos,
+            const len_t mh,     /* multiplier hash for tracing */
+            const len_t bi,     /* basis index of generating element */
+            const len_t tr,     /* trace data? */
+            md_t *st
+            );
+
+    hm_t *(*trace_reduce_dense_row_by_known_pivots_sparse_ff_32)(
+            rba_t *rba,
+            int64_t *dr,
+            mat_t *mat,
+            const bs_t * const bs,
+            hm_t *const *pivs,
+            const hi_t dpiv,
+            const hm_t tmp_pos,
+            const len_t mh,
+            const len_t bi,
+            md_t *st
+            );
+
+    cf32_t *(*reduce_dense_row_by_all_pivots_ff_32)(
+            int64_t *dr,
+            mat_t *mat,
+            const bs_t * const bs,
+            len_t *pc,
+            hm_t *const *pivs,
+            cf32_t *const *dpivs,
+            const uint32_t fc
+            );
+
+
+    cf32_t *(*reduce_dense_row_by_dense_new_pivots_ff_32)(
+            int64_t *dr,
+            len_t *pc,
+            cf32_t * const * const pivs,
+            const len_t ncr,
+            const uint32_t fc
+            );
+};
+
+/* meta data stuff */
 struct md_t
 {
+    /* routines used in this computation */
+    fp_t fp;
+
     /* trace data */
     trace_t *tr;
     tl_t trace_level;
     int32_t trace_rd;
+    /* reducers of the normal form step of core_nf(): triples of basis
+     * index, its leading monomial and the multiplier, both hashes of the
+     * basis hash table; recorded if nf_trace_level is LEARN_TRACER, used
+     * instead of symbolic preprocessing if it is APPLY_TRACER */
+    hi_t *nfr;
+    len_t nfrl;
+    tl_t nf_trace_level;
 
     /* hash table data */
     ht_t *ht;
@@ -376,6 +604,18 @@ struct md_t
     int64_t mat_max_nrows;
     int64_t mat_max_ncols;
     double  mat_max_density;
+    int64_t mem_budget;   /* memory budget for one matrix in bytes, see
+                           * set_memory_budget(), <= 0 = off */
+    int64_t sel_nnz;      /* number of terms of the selected matrix rows */
+    double  mat_fill;     /* #terms of the last matrix after symbolic
+                           * preprocessing divided by sel_nnz */
+    int64_t num_mem_splits; /* selections cut due to the memory budget */
+    int64_t peak_mem;     /* peak resident set size in bytes */
+    const char *ooc_dir;  /* directory for out-of-core storage of trace
+                           * rounds and redundant basis elements,
+                           * NULL = everything is kept in core */
+    int64_t spa_min_ncols; /* minimal number of columns for sparse
+                            * accumulators, 0 = used for all matrices */
 
     int32_t ngens_input;
     int32_t ngens_invalid;
@@ -391,7 +631,20 @@ struct md_t
     int32_t laopt;
     int32_t init_hts;
     int32_t nthrds;
+    int32_t mm_nteams; /* multi-modular runs: number of primes computed
+                        * in parallel */
+    int32_t mm_tsize;  /* multi-modular runs: number of threads used
+                        * for each of these primes */
+    int64_t mm_pmem;   /* multi-modular runs: memory in bytes needed for
+                        * one prime, measured in the learning run */
+    int64_t mm_mmem;   /* multi-modular runs: memory in bytes of the
+                        * largest matrix of the learning run */
     int32_t reset_ht;
+    int32_t ht_rd;  /* rounds since the last basis hash table compaction */
+    hl_t ht_chk;    /* basis hash table load for the next check for
+                     * monomials not used anymore */
+    hl_t ht_fix;    /* monomials 1,...,ht_fix-1 of the basis hash table
+                     * keep their position when it is compacted */
     int32_t current_rd;
     int32_t current_deg;
     deg_t max_gb_degree;
@@ -432,150 +685,4 @@ struct md_t
     uint32_t nr_kernel_elts;
 };
 
-/* function pointers */
-/* extern bs_t *(*initialize_basis)(
- *         const int32_t ngens
- *         ); */
-extern void (*normalize_initial_basis)(
-        bs_t *bs,
-        const uint32_t fc
-        );
-
-extern int (*initial_input_cmp)(
-        const void *a,
-        const void *b,
-        void *ht
-        );
-
-extern int (*initial_gens_cmp)(
-        const void *a,
-        const void *b,
-        void *ht
-        );
-
-extern int (*monomial_cmp)(
-        const hi_t a,
-        const hi_t b,
-        const ht_t *ht
-        );
-
-extern int (*spair_cmp)(
-        const void *a,
-        const void *b,
-        void *htp
-        );
-
-extern int (*hcm_cmp)(
-        const void *a,
-        const void *b,
-        void *htp
-        );
-
-/* linear algebra routines */
-extern void (*sba_linear_algebra)(
-        smat_t *smat,
-        crit_t *syz,
-        md_t *st,
-        const ht_t * const ht
-        );
-
-extern void (*exact_linear_algebra)(
-        mat_t *mat,
-        const bs_t * const tbr,
-        const bs_t * const bs,
-        md_t *st
-        );
-
-extern void (*linear_algebra)(
-        mat_t *mat,
-        const bs_t * const tbr,
-        const bs_t * const bs,
-        md_t *st
-        );
-
-extern int (*application_linear_algebra)(
-        mat_t *mat,
-        const bs_t * const bs,
-        md_t *st
-        );
-
-extern void (*trace_linear_algebra)(
-        trace_t *trace,
-        mat_t *mat,
-        const bs_t * const bs,
-        md_t *st
-        );
-
-extern void (* interreduce_matrix_rows)(
-        mat_t *mat,
-        bs_t *bs,
-        md_t *st,
-        int free_basis
-        );
-
-extern cf32_t *(*reduce_dense_row_by_old_pivots_ff_32)(
-        int64_t *dr,
-        mat_t *mat,
-        const bs_t * const bs,
-        hm_t * const * const pivs,
-        const hi_t dpiv,
-        const uint32_t fc
-        );
-
-extern hm_t *(*sba_reduce_dense_row_by_known_pivots_sparse_ff_32)(
-        int64_t *dr,
-        smat_t *smat,
-        hm_t *const *pivs,
-        const hi_t dpiv,    /* pivot of dense row at the beginning */
-        const hm_t sm,      /* signature monomial of row reduced */
-        const len_t si,     /* signature index of row reduced */
-        const len_t ri,     /* index of row in matrix */
-        md_t *st
-        );
-
-extern hm_t *(*reduce_dense_row_by_known_pivots_sparse_ff_32)(
-        int64_t *dr,
-        mat_t *mat,
-        const bs_t * const bs,
-        hm_t *const *pivs,
-        const hi_t dpiv,
-        const hm_t tmp_pos,
-        const len_t mh,     /* multiplier hash for tracing */
-        const len_t bi,     /* basis index of generating element */
-        const len_t tr,     /* trace data? */
-        md_t *st
-        );
-
-extern hm_t *(*trace_reduce_dense_row_by_known_pivots_sparse_ff_32)(
-        rba_t *rba,
-        int64_t *dr,
-        mat_t *mat,
-        const bs_t * const bs,
-        hm_t *const *pivs,
-        const hi_t dpiv,
-        const hm_t tmp_pos,
-        const len_t mh,
-        const len_t bi,
-        md_t *st
-        );
-
-extern cf32_t *(*reduce_dense_row_by_all_pivots_ff_32)(
-        int64_t *dr,
-        mat_t *mat,
-        const bs_t * const bs,
-        len_t *pc,
-        hm_t *const *pivs,
-        cf32_t *const *dpivs,
-        const uint32_t fc
-        );
-
-
-extern cf32_t *(*reduce_dense_row_by_dense_new_pivots_ff_32)(
-        int64_t *dr,
-        len_t *pc,
-        cf32_t * const * const pivs,
-        const len_t ncr,
-        const uint32_t fc
-        );
-
 #endif
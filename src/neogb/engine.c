@@ -43,7 +43,10 @@ int initialize_gba_input_data(
         int32_t use_signatures,
         int32_t reduce_gb,
         int32_t pbm_file,
-        int32_t info_level
+        int32_t info_level,
+        int64_t mem_budget,
+        int64_t spa_min_ncols,
+        const char *ooc_dir
         )
 {
     bs_t *bs    = *bsp;
@@ -72,7 +75,9 @@ int initialize_gba_input_data(
                 use_signatures, reduce_gb, pbm_file, info_level)) {
         return 0;
     }
-
+    set_memory_budget(st, mem_budget);
+    set_spa_min_ncols(st, spa_min_ncols);
+    set_out_of_core_dir(st, ooc_dir);
 
     /* initialize basis */
     bs  = initialize_basis(st);
@@ -88,10 +93,10 @@ int initialize_gba_input_data(
 
     /* sort initial elements, smallest lead term first */
     sort_r(bs->hm, (unsigned long)bs->ld, sizeof(hm_t *),
-            initial_input_cmp, bht);
+            st->fp.initial_input_cmp, bht);
     /* normalize input generators */
     if (st->fc > 0) {
-        normalize_initial_basis(bs, st->fc);
+        st->fp.normalize_initial_basis(bs, st->fc);
     } else {
         if (st->fc == 0) {
             remove_content_of_initial_basis(bs);
@@ -129,12 +134,10 @@ int64_t export_results_from_gba(
     md_t **stp
     )
 {
-    if ((*stp)->use_signatures == 0) {
-        return export_results_from_f4(bld, blen, bexp, bcf,
-                mallocp, bsp, bhtp, stp);
-    } else {
-        exit(1);
-    }
+    /* core_sba_schreyer() returns the basis in the same format as
+     * core_f4(), so both are exported the same way */
+    return export_results_from_f4(bld, blen, bexp, bcf,
+            mallocp, bsp, bhtp, stp);
 }
 
 bs_t *gba_trace_learning_phase(
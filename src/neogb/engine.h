@@ -46,7 +46,10 @@ int initialize_gba_input_data(
         int32_t use_signatures,
         int32_t reduce_gb,
         int32_t pbm_file,
-        int32_t info_level
+        int32_t info_level,
+        int64_t mem_budget,     /* see set_memory_budget() */
+        int64_t spa_min_ncols,  /* see set_spa_min_ncols() */
+        const char *ooc_dir     /* see set_out_of_core_dir() */
         );
 
 bs_t *core_gba(
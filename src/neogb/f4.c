@@ -187,7 +187,7 @@ static void intermediate_reduce_basis(
     /* sort rows */
     sort_matrix_rows_decreasing(mat->rr, mat->nru);
     /* do the linear algebra reduction, do NOT free basis data */
-    interreduce_matrix_rows(mat, bs, st, 0);
+    st->fp.interreduce_matrix_rows(mat, bs, st, 0);
     /* remap rows to basis elements (keeping their position in bs) */
     convert_sparse_matrix_rows_to_basis_elements(mat, bs, bht, sht, st);
 
@@ -301,7 +301,7 @@ static void reduce_basis(
     /* sort rows */
     sort_matrix_rows_decreasing(mat->rr, mat->nru);
     /* do the linear algebra reduction and free basis data afterwards */
-    interreduce_matrix_rows(mat, bs, md, 1);
+    md->fp.interreduce_matrix_rows(mat, bs, md, 1);
 
     convert_sparse_matrix_rows_to_basis_elements(
             1, mat, bs, bht, sht, md);
@@ -360,7 +360,7 @@ static int32_t initialize_f4(
     md->hcm = (hi_t *)malloc(sizeof(hi_t));
 
     if (gmd->fc != fc) {
-        reset_function_pointers(fc, md->laopt);
+        reset_function_pointers(md, fc, md->laopt);
         bs = copy_basis_mod_p(gbs, md);
         if (md->laopt < 40) {
             if (md->trace_level != APPLY_TRACER) {
@@ -371,8 +371,10 @@ static int32_t initialize_f4(
         bs = gbs;
         md->trace_level = NO_TRACER;
     }
-    normalize_initial_basis(bs, fc);
+    md->fp.normalize_initial_basis(bs, fc);
     md->ht = initialize_secondary_hash_table(bs->ht, md);
+    /* the input basis may share the basis hash table with other runs */
+    md->ht_fix  = bs->ht->eld;
 
     /* matrix holding sparse information generated
        during symbolic preprocessing */
@@ -427,7 +429,7 @@ static int32_t compute_new_elements(
 
     convert_hashes_to_columns(mat, md, sht);
     sort_matrix_rows_decreasing(mat->rr, mat->nru);
-    linear_algebra(mat, bs, bs, md);
+    md->fp.linear_algebra(mat, bs, bs, md);
 
     /* check for bad prime */
     if (md->trace_level == APPLY_TRACER) {
@@ -465,6 +467,7 @@ static int32_t compute_new_elements(
     if (md->trace_level == LEARN_TRACER && md->np > 0) {
         add_lms_to_trace(md->tr, bs, md->np);
         md->tr->ltd++;
+        spill_trace_round(md->tr, md->tr->ltd-1);
     }
     if (md->trace_level == APPLY_TRACER) {
         bs->ld += md->np;
@@ -611,7 +614,7 @@ static void reduce_final_basis(
         sort_matrix_rows_decreasing(mat->rr, mat->nru);
         sort_matrix_rows_increasing(mat->tr, mat->nrl);
 
-        exact_linear_algebra(mat, bs, bs, md);
+        md->fp.exact_linear_algebra(mat, bs, bs, md);
 
         free_basis_elements(bs);
 
@@ -661,6 +664,16 @@ static void finalize_f4(
     if ((*lmdp)->trace_level == LEARN_TRACER) {
         gmd->tr = (*lmdp)->tr;
         gmd->trace_level = APPLY_TRACER;
+        /* each prime the trace is applied to needs its own basis, hash
+         * tables and matrices, the trace and the exponent vectors of the
+         * basis hash table are shared, see copy_basis_mod_p() */
+        if (*bsp != NULL) {
+            const ht_t *bht = (*bsp)->ht;
+            gmd->mm_pmem = basis_memory(*bsp) + hash_table_memory(bht)
+                - (int64_t)(bht->eld - 1 - bht->sld) * bht->evl * sizeof(exp_t)
+                + hash_table_memory((*lmdp)->ht) + matrix_memory(*lmdp);
+            gmd->mm_mmem = matrix_memory(*lmdp);
+        }
     }
     gmd->min_deg_in_first_deg_fall = (*lmdp)->min_deg_in_first_deg_fall;
     free_local_data(matp, lmdp);
@@ -708,6 +721,11 @@ bs_t *core_f4(
         }
         if (!done && md->trace_level != APPLY_TRACER) {
             done = update(bs, md);
+            spill_redundant_basis_elements(bs, md);
+        }
+        /* hash values have to be stable when applying a tracer */
+        if (!done && md->trace_level != APPLY_TRACER) {
+            compact_basis_hash_table(bs, md);
         }
 
         print_round_timings(stdout, md, rrt, crt);
@@ -725,6 +743,7 @@ bs_t *core_f4(
 
         md->f4_rtime = realtime() - rt;
         md->f4_ctime = cputime() - ct;
+        md->peak_mem = peak_memory();
 
         get_and_print_final_statistics(stdout, md, bs);
 
@@ -809,7 +828,9 @@ int64_t export_f4(
             lens, exps, cfs, field_char, mon_order, elim_block_len,
             nr_vars, nr_gens, 0 /* # normal forms */, ht_size,
             nr_threads, max_nr_pairs, reset_ht, la_option, use_signatures,
-            reduce_gb, pbm_file, info_level);
+            reduce_gb, pbm_file, info_level, 0 /* default memory budget */,
+            -1 /* default sparse accumulator threshold */,
+            NULL /* in core */);
 
     /* all input generators are invalid */
     if (success == -1) {
@@ -837,6 +858,7 @@ int64_t export_f4(
     rt1 = realtime();
     md->f4_ctime = ct1 - ct0;
     md->f4_rtime = rt1 - rt0;
+    md->peak_mem = peak_memory();
 
     get_and_print_final_statistics(stderr, md, bs);
 
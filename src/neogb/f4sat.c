@@ -577,7 +577,7 @@ end_sat_step:
         sort_matrix_rows_decreasing(mat->rr, mat->nru);
         sort_matrix_rows_increasing(mat->tr, mat->nrl);
         /* linear algebra, depending on choice, see set_function_pointers() */
-        linear_algebra(mat, bs, bs, st);
+        st->fp.linear_algebra(mat, bs, bs, st);
         /* columns indices are mapped back to exponent hashes */
         if (mat->np > 0) {
             convert_sparse_matrix_rows_to_basis_elements(
@@ -738,6 +738,7 @@ end_sat_step:
     }
     st->f4_rtime = realtime() - rt;
     st->f4_ctime = cputime() - ct;
+    st->peak_mem = peak_memory();
 
     get_and_print_final_statistics(stdout, st, bs);
 /*     printf("basis has  %u elements.\n", bs->lml);
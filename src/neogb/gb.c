@@ -27,7 +27,6 @@
 #include <gmp.h>
 
 #include "libneogb.h"
-#include "data.c"
 #include "meta_data.c"/* computational meta data */
 #include "tools.c"    /* tools like inversion mod p,
                        * tracer construction, timings etc. */
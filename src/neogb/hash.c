@@ -30,6 +30,25 @@
 /* The idea of the structure of the hash table is taken from an
  * implementation by Roman Pearce and Michael Monagan in Maple. */
 
+/* monomial comparisons, see order.c */
+static inline int monomial_cmp_lex(
+        const hi_t a,
+        const hi_t b,
+        const ht_t *ht
+        );
+
+static inline int monomial_cmp_drl(
+        const hi_t a,
+        const hi_t b,
+        const ht_t *ht
+        );
+
+static inline int monomial_cmp_be(
+        const hi_t a,
+        const hi_t b,
+        const ht_t *ht
+        );
+
 static val_t pseudo_random_number_generator(
     uint32_t *seed
     )
@@ -42,6 +61,104 @@ static val_t pseudo_random_number_generator(
     return (val_t)rseed;
 }
 
+/* Hash tables freed by a thread are kept in a small pool of this thread
+ * once enable_hash_table_reuse() was called. The next basis or secondary
+ * hash table of the same sizes initialized by the thread takes over their
+ * storage instead of allocating it again. This is used in batch mode where
+ * each thread solves many small systems one after the other. Only tables
+ * owning all of their exponent vectors are kept. */
+#define HT_POOL_SIZE 8
+
+static int ht_reuse       = 0;
+static len_t ht_pool_len  = 0;
+static hts_t ht_pool[HT_POOL_SIZE];
+#pragma omp threadprivate(ht_reuse, ht_pool_len, ht_pool)
+
+static void free_hash_table_storage(
+    hts_t *hs
+    )
+{
+    free(hs->hmap);
+    free(hs->hd);
+    free(hs->ev[0]);
+    free(hs->ev);
+}
+
+void enable_hash_table_reuse(
+    void
+    )
+{
+    ht_reuse  = 1;
+}
+
+void release_hash_table_storage(
+    void
+    )
+{
+    len_t i;
+
+    for (i = 0; i < ht_pool_len; ++i) {
+        free_hash_table_storage(ht_pool + i);
+    }
+    ht_pool_len = 0;
+    ht_reuse    = 0;
+}
+
+/* returns 1 if ht got the storage of a pooled table of the same sizes,
+ * hash map and hash data are zeroed as if they were freshly allocated */
+static int take_hash_table_storage(
+    ht_t *ht
+    )
+{
+    len_t i;
+    hl_t j;
+
+    for (i = ht_pool_len; i > 0; --i) {
+        hts_t *hs = ht_pool + i - 1;
+        if (hs->hsz == ht->hsz && hs->esz == ht->esz && hs->evl == ht->evl) {
+            ht->hmap  = hs->hmap;
+            ht->hd    = hs->hd;
+            ht->ev    = hs->ev;
+            memset(ht->hmap, 0, (unsigned long)ht->hsz * sizeof(hi_t));
+            memset(ht->hd, 0, (unsigned long)ht->esz * sizeof(hd_t));
+            for (j = 1; j < ht->esz; ++j) {
+                ht->ev[j]  = ht->ev[0] + (j*ht->evl);
+            }
+            ht_pool[i-1]  = ht_pool[--ht_pool_len];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* returns 1 if the storage of ht was moved to the pool, the oldest
+ * pooled table is freed if the pool is full */
+static int keep_hash_table_storage(
+    ht_t *ht
+    )
+{
+    if (ht_reuse == 0 || ht->sld != 0
+            || ht->hmap == NULL || ht->hd == NULL || ht->ev == NULL) {
+        return 0;
+    }
+    if (ht_pool_len == HT_POOL_SIZE) {
+        free_hash_table_storage(ht_pool);
+        memmove(ht_pool, ht_pool + 1, (HT_POOL_SIZE - 1) * sizeof(hts_t));
+        ht_pool_len--;
+    }
+    hts_t *hs = ht_pool + ht_pool_len++;
+    hs->hmap  = ht->hmap;
+    hs->hd    = ht->hd;
+    hs->ev    = ht->ev;
+    hs->hsz   = ht->hsz;
+    hs->esz   = ht->esz;
+    hs->evl   = ht->evl;
+    ht->hmap  = NULL;
+    ht->hd    = NULL;
+    ht->ev    = NULL;
+    return 1;
+}
+
 ht_t *initialize_basis_hash_table(
     md_t *st
     )
@@ -53,6 +170,14 @@ ht_t *initialize_basis_hash_table(
 
     ht_t *ht  = (ht_t *)malloc(sizeof(ht_t));
     ht->nv    = nv;
+    ht->sld   = 0;
+
+    /* block elimination order if nev > 0, otherwise lex or drl, see order.c */
+    if (st->nev > 0) {
+        ht->monomial_cmp  = monomial_cmp_be;
+    } else {
+        ht->monomial_cmp  = st->mo == 1 ? monomial_cmp_lex : monomial_cmp_drl;
+    }
     /* generate map */
     ht->bpv = (len_t)((CHAR_BIT * sizeof(sdm_t)) / (unsigned long)nv);
     if (ht->bpv == 0) {
@@ -64,7 +189,6 @@ ht_t *initialize_basis_hash_table(
 
     ht->hsz   = (hl_t)pow(2, st->init_hts);
     ht->esz   = ht->hsz / 2;
-    ht->hmap  = calloc(ht->hsz, sizeof(hi_t));
 
     if (st->nev == 0) {
         ht->evl = nv + 1; /* store also degree at first position */
@@ -105,7 +229,63 @@ ht_t *initialize_basis_hash_table(
     /* generate exponent vector */
     /* keep first entry empty for faster divisibility checks */
     ht->eld = 1;
+    if (take_hash_table_storage(ht) == 0) {
+        ht->hmap  = calloc(ht->hsz, sizeof(hi_t));
+        ht->hd    = (hd_t *)calloc(ht->esz, sizeof(hd_t));
+        ht->ev    = (exp_t **)malloc(ht->esz * sizeof(exp_t *));
+        if (ht->ev == NULL) {
+            fprintf(stderr, "Computation needs too much memory on this machine,\n");
+            fprintf(stderr, "could not initialize exponent vector for hash table,\n");
+            fprintf(stderr, "esz = %lu, segmentation fault will follow.\n", (unsigned long)ht->esz);
+        }
+        exp_t *tmp  = (exp_t *)malloc(
+                (unsigned long)ht->evl * ht->esz * sizeof(exp_t));
+        if (tmp == NULL) {
+            fprintf(stderr, "Exponent storage needs too much memory on this machine,\n");
+            fprintf(stderr, "initialization failed, esz = %lu,\n", (unsigned long)ht->esz);
+            fprintf(stderr, "segmentation fault will follow.\n");
+        }
+        const hl_t esz  = ht->esz;
+        for (j = 0; j < esz; ++j) {
+            ht->ev[j]  = tmp + (j*ht->evl);
+        }
+    }
+    st->max_bht_size  = ht->esz;
+    return ht;
+}
+
+ht_t *copy_hash_table(
+    const ht_t *bht
+    )
+{
+    hl_t j;
+
+    ht_t *ht  = (ht_t *)malloc(sizeof(ht_t));
+
+    ht->nv    = bht->nv;
+    ht->evl   = bht->evl;
+    ht->ebl   = bht->ebl;
+    ht->monomial_cmp  = bht->monomial_cmp;
+    ht->sld   = 0;
+    ht->hsz   = bht->hsz;
+    ht->esz   = bht->esz;
+
+    ht->hmap  = calloc(ht->hsz, sizeof(hi_t));
+    memcpy(ht->hmap, bht->hmap, (unsigned long)ht->hsz * sizeof(hi_t));
+
+    ht->ndv = bht->ndv;
+    ht->bpv = bht->bpv;
+    ht->dm  = bht->dm;
+    ht->rn  = bht->rn;
+
+    ht->dv  = (len_t *)calloc((unsigned long)ht->ndv, sizeof(len_t));
+    memcpy(ht->dv, bht->dv, (unsigned long)ht->ndv * sizeof(len_t));
+
+    /* generate exponent vector */
+    /* keep first entry empty for faster divisibility checks */
     ht->hd  = (hd_t *)calloc(ht->esz, sizeof(hd_t));
+
+    memcpy(ht->hd, bht->hd, (unsigned long)ht->esz * sizeof(hd_t));
     ht->ev  = (exp_t **)malloc(ht->esz * sizeof(exp_t *));
     if (ht->ev == NULL) {
         fprintf(stderr, "Computation needs too much memory on this machine,\n");
@@ -119,15 +299,26 @@ ht_t *initialize_basis_hash_table(
         fprintf(stderr, "initialization failed, esz = %lu,\n", (unsigned long)ht->esz);
         fprintf(stderr, "segmentation fault will follow.\n");
     }
+    ht->eld = bht->eld;
     const hl_t esz  = ht->esz;
     for (j = 0; j < esz; ++j) {
         ht->ev[j]  = tmp + (j*ht->evl);
     }
-    st->max_bht_size  = ht->esz;
+    /* bht may itself share parts of its exponent storage,
+     * so we copy entry by entry */
+    for (j = 0; j < ht->eld; ++j) {
+        memcpy(ht->ev[j], bht->ev[j], (unsigned long)ht->evl * sizeof(exp_t));
+    }
     return ht;
 }
 
-ht_t *copy_hash_table(
+/* Copies the hash table bht, but the exponent vectors already stored in bht
+ * are not duplicated: the new table points to the exponent storage of bht for
+ * them and only allocates memory for ev[0] and newly inserted monomials.
+ * Thus bht must not be changed or freed before the copy is freed. This is
+ * used for the application runs in multi-modular computations where several
+ * threads work on copies of the same basis hash table at the same time. */
+ht_t *copy_hash_table_shared_exponents(
     const ht_t *bht
     )
 {
@@ -138,8 +329,12 @@ ht_t *copy_hash_table(
     ht->nv    = bht->nv;
     ht->evl   = bht->evl;
     ht->ebl   = bht->ebl;
+    ht->monomial_cmp  = bht->monomial_cmp;
     ht->hsz   = bht->hsz;
     ht->esz   = bht->esz;
+    ht->eld   = bht->eld;
+    ht->elo   = bht->elo;
+    ht->sld   = bht->eld - 1;
 
     ht->hmap  = calloc(ht->hsz, sizeof(hi_t));
     memcpy(ht->hmap, bht->hmap, (unsigned long)ht->hsz * sizeof(hi_t));
@@ -152,29 +347,31 @@ ht_t *copy_hash_table(
     ht->dv  = (len_t *)calloc((unsigned long)ht->ndv, sizeof(len_t));
     memcpy(ht->dv, bht->dv, (unsigned long)ht->ndv * sizeof(len_t));
 
-    /* generate exponent vector */
-    /* keep first entry empty for faster divisibility checks */
     ht->hd  = (hd_t *)calloc(ht->esz, sizeof(hd_t));
+    memcpy(ht->hd, bht->hd, (unsigned long)ht->eld * sizeof(hd_t));
 
-    memcpy(ht->hd, bht->hd, (unsigned long)ht->esz * sizeof(hd_t));
     ht->ev  = (exp_t **)malloc(ht->esz * sizeof(exp_t *));
     if (ht->ev == NULL) {
         fprintf(stderr, "Computation needs too much memory on this machine,\n");
         fprintf(stderr, "could not initialize exponent vector for hash table,\n");
         fprintf(stderr, "esz = %lu, segmentation fault will follow.\n", (unsigned long)ht->esz);
     }
-    exp_t *tmp  = (exp_t *)malloc(
-            (unsigned long)ht->evl * ht->esz * sizeof(exp_t));
+    /* local block: ev[0] followed by all entries after the shared ones */
+    exp_t *tmp  = (exp_t *)calloc(
+            (unsigned long)ht->evl * (ht->esz - ht->sld), sizeof(exp_t));
     if (tmp == NULL) {
         fprintf(stderr, "Exponent storage needs too much memory on this machine,\n");
         fprintf(stderr, "initialization failed, esz = %lu,\n", (unsigned long)ht->esz);
         fprintf(stderr, "segmentation fault will follow.\n");
     }
-    memcpy(tmp, bht->ev[0], (unsigned long)ht->evl * ht->esz * sizeof(exp_t));
-    ht->eld = bht->eld;
     const hl_t esz  = ht->esz;
-    for (j = 0; j < esz; ++j) {
-        ht->ev[j]  = tmp + (j*ht->evl);
+    const hl_t sld  = ht->sld;
+    ht->ev[0] = tmp;
+    for (j = 1; j <= sld; ++j) {
+        ht->ev[j]  = bht->ev[j];
+    }
+    for (j = sld+1; j < esz; ++j) {
+        ht->ev[j]  = tmp + ((j-sld)*ht->evl);
     }
     return ht;
 }
@@ -191,12 +388,13 @@ ht_t *initialize_secondary_hash_table(
     ht->nv    = bht->nv;
     ht->evl   = bht->evl;
     ht->ebl   = bht->ebl;
+    ht->monomial_cmp  = bht->monomial_cmp;
+    ht->sld   = 0;
 
     /* generate map */
     int32_t min = 3 > md->init_hts-5 ? 3 : md->init_hts-5;
     ht->hsz   = (hl_t)pow(2, min);
     ht->esz   = ht->hsz / 2;
-    ht->hmap  = calloc(ht->hsz, sizeof(hi_t));
 
     /* divisor mask and random number seeds from basis hash table */
     ht->ndv = bht->ndv;
@@ -208,23 +406,26 @@ ht_t *initialize_secondary_hash_table(
     /* generate exponent vector */
     /* keep first entry empty for faster divisibility checks */
     ht->eld = 1;
-    ht->hd  = (hd_t *)calloc(ht->esz, sizeof(hd_t));
-    ht->ev  = (exp_t **)malloc(ht->esz * sizeof(exp_t *));
-    if (ht->ev == NULL) {
-        fprintf(stderr, "Computation needs too much memory on this machine,\n");
-        fprintf(stderr, "could not initialize exponent vector for hash table,\n");
-        fprintf(stderr, "esz = %lu, segmentation fault will follow.\n", (unsigned long)ht->esz);
-    }
-    exp_t *tmp  = (exp_t *)malloc(
-            (unsigned long)ht->evl * ht->esz * sizeof(exp_t));
-    if (tmp == NULL) {
-        fprintf(stderr, "Exponent storage needs too much memory on this machine,\n");
-        fprintf(stderr, "initialization failed, esz = %lu,\n", (unsigned long)ht->esz);
-        fprintf(stderr, "segmentation fault will follow.\n");
-    }
-    const hl_t esz  = ht->esz;
-    for (j = 0; j < esz; ++j) {
-        ht->ev[j]  = tmp + (j*ht->evl);
+    if (take_hash_table_storage(ht) == 0) {
+        ht->hmap  = calloc(ht->hsz, sizeof(hi_t));
+        ht->hd    = (hd_t *)calloc(ht->esz, sizeof(hd_t));
+        ht->ev    = (exp_t **)malloc(ht->esz * sizeof(exp_t *));
+        if (ht->ev == NULL) {
+            fprintf(stderr, "Computation needs too much memory on this machine,\n");
+            fprintf(stderr, "could not initialize exponent vector for hash table,\n");
+            fprintf(stderr, "esz = %lu, segmentation fault will follow.\n", (unsigned long)ht->esz);
+        }
+        exp_t *tmp  = (exp_t *)malloc(
+                (unsigned long)ht->evl * ht->esz * sizeof(exp_t));
+        if (tmp == NULL) {
+            fprintf(stderr, "Exponent storage needs too much memory on this machine,\n");
+            fprintf(stderr, "initialization failed, esz = %lu,\n", (unsigned long)ht->esz);
+            fprintf(stderr, "segmentation fault will follow.\n");
+        }
+        const hl_t esz  = ht->esz;
+        for (j = 0; j < esz; ++j) {
+            ht->ev[j]  = tmp + (j*ht->evl);
+        }
     }
     return ht;
 }
@@ -254,6 +455,7 @@ void free_hash_table(
     )
 {
     ht_t *ht  = *htp;
+    keep_hash_table_storage(ht);
     if (ht->hmap) {
         free(ht->hmap);
         ht->hmap = NULL;
@@ -279,6 +481,7 @@ void full_free_hash_table(
                      )
 {
   ht_t *ht  = *htp;
+  keep_hash_table_storage(ht);
   if (ht->hmap) {
     free(ht->hmap);
     ht->hmap = NULL;
@@ -333,17 +536,18 @@ static void enlarge_hash_table(
         fprintf(stderr, "segmentation fault will follow.\n");
     }
     /* note: memory is allocated as one big block, so reallocating
-     *       memory from ev[0] is enough    */
+     *       memory from ev[0] is enough, shared entries are not touched */
+    const hl_t sld  = ht->sld;
     ht->ev[0] = realloc(ht->ev[0],
-            esz * (unsigned long)ht->evl * sizeof(exp_t));
+            (esz - sld) * (unsigned long)ht->evl * sizeof(exp_t));
     if (ht->ev[0] == NULL) {
         fprintf(stderr, "Enlarging exponent vector for hash table failed\n");
         fprintf(stderr, "for esz = %lu, segmentation fault will follow.\n", (unsigned long)esz);
     }
-    /* due to realloc we have to reset ALL ev entries,
+    /* due to realloc we have to reset ALL local ev entries,
      * memory might have been moved */
-    for (i = 1; i < esz; ++i) {
-        ht->ev[i] = ht->ev[0] + (i*ht->evl);
+    for (i = sld+1; i < esz; ++i) {
+        ht->ev[i] = ht->ev[0] + ((i-sld)*ht->evl);
     }
 
     /* The hash table should be double the size of the exponent space in
@@ -1271,6 +1475,7 @@ static void reset_hash_table(
         ht->ev[k]  = tmp + k*evl;
     }
     ht->eld = 1;
+    ht->sld = 0;
     memset(ht->hmap, 0, ht->hsz * sizeof(hi_t));
     memset(ht->hd, 0, esz * sizeof(hd_t));
 
@@ -1300,6 +1505,220 @@ static void reset_hash_table(
     st->rht_rtime  +=  rt1 - rt0;
 }
 
+static int hashes_cmp_by_monomial_order(
+        const void *a,
+        const void *b,
+        void *htp
+        )
+{
+    const ht_t *ht  = (ht_t *)htp;
+
+    return ht->monomial_cmp(*((hi_t *)a), *((hi_t *)b), ht);
+}
+
+/* Compacts the basis hash table if many of its monomials do not appear
+ * in the basis, in the pair set nor in the trace learned so far anymore.
+ * The monomials 1,...,st->ht_fix-1 keep their position, so the input
+ * basis, which may share the table with other runs, and exponent vectors
+ * shared with another table stay valid. The remaining monomials are stored
+ * w.r.t. the monomial order, so that monomials of similar degree are close
+ * to each other in ev and hd. Basis elements, spairs and the learned trace
+ * are rewritten correspondingly. */
+static void compact_basis_hash_table(
+    bs_t *bs,
+    md_t *st
+    )
+{
+    len_t i, j;
+    hl_t k;
+
+    ht_t *ht      = bs->ht;
+    ps_t *psl     = st->ps;
+    trace_t *tr   = st->trace_level == LEARN_TRACER ? st->tr : NULL;
+    const hl_t eld  = ht->eld;
+
+    /* rounds of the trace already stored out of core are not rewritten */
+    if (tr != NULL && tr->oc != NULL) {
+        return;
+    }
+    st->ht_rd++;
+    if (st->reset_ht != 2147483647) {
+        /* fixed schedule given by the user */
+        if (st->ht_rd < st->reset_ht) {
+            return;
+        }
+    } else {
+        if (eld < HT_COMPACT_MIN_LOAD || eld < st->ht_chk) {
+            return;
+        }
+    }
+
+    /* timings */
+    double ct0, ct1, rt0, rt1;
+    ct0 = cputime();
+    rt0 = realtime();
+
+    const len_t evl = ht->evl;
+    const hl_t esz  = ht->esz;
+    const hl_t sld  = ht->sld;
+    const hl_t fix  = st->ht_fix > sld + 1 ? st->ht_fix : sld + 1;
+    const bl_t bld  = bs->ld;
+    const len_t pld = psl->ld;
+    const int32_t nthrds  = st->nthrds;
+    spair_t *ps     = psl->p;
+
+    /* mark all monomials still in use, nh[k] becomes the new position */
+    hi_t *nh  = (hi_t *)calloc((unsigned long)eld, sizeof(hi_t));
+#pragma omp parallel for num_threads(nthrds) private(i, j)
+    for (i = 0; i < bld; ++i) {
+        const hm_t * const row  = bs->hm[i];
+        if (row != NULL) {
+            const len_t len = row[LENGTH] + OFFSET;
+            for (j = OFFSET; j < len; ++j) {
+                nh[row[j]]  = 1;
+            }
+        }
+    }
+    for (i = 0; i < pld; ++i) {
+        nh[ps[i].lcm] = 1;
+    }
+    /* multipliers and new leading monomials of the trace */
+    if (tr != NULL) {
+        for (i = 0; i < tr->ltd; ++i) {
+            const td_t * const td = tr->td + i;
+            for (j = 1; j < td->rld; j += 2) {
+                nh[td->rri[j]]  = 1;
+            }
+            for (j = 1; j < td->tld; j += 2) {
+                nh[td->tri[j]]  = 1;
+            }
+            for (j = 0; j < td->nlm; ++j) {
+                nh[td->nlms[j]] = 1;
+            }
+        }
+    }
+    hl_t nl = 0;
+    for (k = fix; k < eld; ++k) {
+        nl  +=  nh[k];
+    }
+    if (st->reset_ht == 2147483647 && (fix - 1 + nl) * HT_COMPACT_RATIO > eld) {
+        /* not enough dead monomials, check again once the table grew */
+        st->ht_chk  = 2 * eld;
+        free(nh);
+        return;
+    }
+
+    hi_t *lv  = (hi_t *)malloc((unsigned long)nl * sizeof(hi_t));
+    for (k = fix, nl = 0; k < eld; ++k) {
+        if (nh[k] != 0) {
+            lv[nl++]  = (hi_t)k;
+        }
+    }
+    sort_r(lv, (unsigned long)nl, sizeof(hi_t),
+            hashes_cmp_by_monomial_order, ht);
+
+    /* new exponent vectors and hash data, the hash map is regenerated,
+     * shared exponent vectors 1,...,sld are kept */
+    exp_t **oev = ht->ev;
+    hd_t *ohd   = ht->hd;
+    ht->ev  = (exp_t **)malloc((unsigned long)esz * sizeof(exp_t *));
+    ht->hd  = (hd_t *)calloc((unsigned long)esz, sizeof(hd_t));
+    exp_t *tmp  = (exp_t *)malloc(
+            (unsigned long)evl * (esz - sld) * sizeof(exp_t));
+    if (ht->ev == NULL || ht->hd == NULL || tmp == NULL) {
+        fprintf(stderr, "Computation needs too much memory on this machine,\n");
+        fprintf(stderr, "compacting table failed, esz = %lu\n", (unsigned long)esz);
+        fprintf(stderr, "segmentation fault will follow.\n");
+    }
+    ht->ev[0] = tmp;
+    for (k = 1; k <= sld; ++k) {
+        ht->ev[k]  = oev[k];
+    }
+    for (k = sld+1; k < esz; ++k) {
+        ht->ev[k]  = tmp + (k-sld)*evl;
+    }
+    memset(ht->hmap, 0, ht->hsz * sizeof(hi_t));
+    memcpy(ht->ev[0], oev[0], (unsigned long)evl * sizeof(exp_t));
+    memcpy(ht->hd, ohd, (unsigned long)fix * sizeof(hd_t));
+    for (k = sld+1; k < fix; ++k) {
+        memcpy(ht->ev[k], oev[k], (unsigned long)evl * sizeof(exp_t));
+    }
+    for (k = 1; k < fix; ++k) {
+        nh[k] = (hi_t)k;
+    }
+
+    const hl_t hsz  = ht->hsz;
+    const hi_t mod  = (hi_t)(hsz - 1);
+#pragma omp parallel for num_threads(nthrds) private(k)
+    for (k = 0; k < nl; ++k) {
+        memcpy(ht->ev[fix+k], oev[lv[k]], (unsigned long)evl * sizeof(exp_t));
+        ht->hd[fix+k]     = ohd[lv[k]];
+        ht->hd[fix+k].idx = 0;
+        nh[lv[k]]         = (hi_t)(fix+k);
+    }
+    /* hash values are already known, the probing is the same
+     * as in insert_in_hash_table() */
+    for (k = 1; k < fix + nl; ++k) {
+        hi_t p  = (hi_t)ht->hd[k].val;
+        for (hl_t l = 0; l < hsz; ++l) {
+            p = (hi_t)((p+l) & mod);
+            if (!ht->hmap[p]) {
+                break;
+            }
+        }
+        ht->hmap[p] = (hi_t)k;
+    }
+    ht->eld = fix + nl;
+
+    /* rewrite basis elements, spairs and the trace */
+#pragma omp parallel for num_threads(nthrds) private(i, j)
+    for (i = 0; i < bld; ++i) {
+        hm_t *row = bs->hm[i];
+        if (row != NULL) {
+            const len_t len = row[LENGTH] + OFFSET;
+            for (j = OFFSET; j < len; ++j) {
+                row[j]  = nh[row[j]];
+            }
+        }
+    }
+#pragma omp parallel for num_threads(nthrds) private(i)
+    for (i = 0; i < pld; ++i) {
+        ps[i].lcm = nh[ps[i].lcm];
+    }
+    if (tr != NULL) {
+        for (i = 0; i < tr->ltd; ++i) {
+            td_t *td  = tr->td + i;
+            for (j = 1; j < td->rld; j += 2) {
+                td->rri[j]  = nh[td->rri[j]];
+            }
+            for (j = 1; j < td->tld; j += 2) {
+                td->tri[j]  = nh[td->tri[j]];
+            }
+            for (j = 0; j < td->nlm; ++j) {
+                td->nlms[j] = nh[td->nlms[j]];
+            }
+        }
+    }
+
+    /* note: all local memory is allocated as a big block starting
+     *       at oev[0], shared entries are not freed. */
+    free(oev[0]);
+    free(oev);
+    free(ohd);
+    free(nh);
+    free(lv);
+
+    st->ht_rd   = 0;
+    st->ht_chk  = 2 * ht->eld;
+    st->num_rht++;
+
+    /* timings */
+    ct1 = cputime();
+    rt1 = realtime();
+    st->rht_ctime  +=  ct1 - ct0;
+    st->rht_rtime  +=  rt1 - rt0;
+}
+
 /* computes lcm of a and b from ht1 and inserts it in ht2 */
 static inline hi_t get_lcm(
     const hi_t a,
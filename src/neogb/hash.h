@@ -46,6 +46,10 @@ ht_t *copy_hash_table(
     const ht_t *bht
     );
 
+ht_t *copy_hash_table_shared_exponents(
+    const ht_t *bht
+    );
+
 ht_t *initialize_secondary_hash_table(
     const ht_t * const ht,
     const md_t * const md
@@ -63,6 +67,14 @@ void full_free_hash_table(
                      ht_t **htp
                      );
 
+void enable_hash_table_reuse(
+    void
+    );
+
+void release_hash_table_storage(
+    void
+    );
+
 void calculate_divmask(
     ht_t *ht
     );
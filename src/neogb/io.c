@@ -58,7 +58,8 @@ static inline void set_exponent_vector(
 void sort_terms_ff_8(
     cf8_t **cfp,
     hm_t **hmp,
-    ht_t *ht
+    ht_t *ht,
+    const md_t * const st
     )
 {
   cf8_t *cf = *cfp;
@@ -79,7 +80,7 @@ void sort_terms_ff_8(
   }
 
   /* sort pointers to hm entries -> getting permutations */
-  sort_r(phm, (unsigned long)len, sizeof(phm[0]), initial_gens_cmp, ht);
+  sort_r(phm, (unsigned long)len, sizeof(phm[0]), st->fp.initial_gens_cmp, ht);
 
   /* sort cf and hm using permutations stored in phm */
   for (i = 0; i < len; ++i) {
@@ -106,7 +107,8 @@ void sort_terms_ff_8(
 void sort_terms_ff_16(
     cf16_t **cfp,
     hm_t **hmp,
-    ht_t *ht
+    ht_t *ht,
+    const md_t * const st
     )
 {
   cf16_t *cf  = *cfp;
@@ -127,7 +129,7 @@ void sort_terms_ff_16(
   }
 
   /* sort pointers to hm entries -> getting permutations */
-  sort_r(phm, (unsigned long)len, sizeof(phm[0]), initial_gens_cmp, ht);
+  sort_r(phm, (unsigned long)len, sizeof(phm[0]), st->fp.initial_gens_cmp, ht);
 
   /* sort cf and hm using permutations stored in phm */
   for (i = 0; i < len; ++i) {
@@ -154,7 +156,8 @@ void sort_terms_ff_16(
 void sort_terms_ff_32(
     cf32_t **cfp,
     hm_t **hmp,
-    ht_t *ht
+    ht_t *ht,
+    const md_t * const st
     )
 {
   cf32_t *cf  = *cfp;
@@ -175,7 +178,7 @@ void sort_terms_ff_32(
   }
 
   /* sort pointers to hm entries -> getting permutations */
-  sort_r(phm, (unsigned long)len, sizeof(phm[0]), initial_gens_cmp, ht);
+  sort_r(phm, (unsigned long)len, sizeof(phm[0]), st->fp.initial_gens_cmp, ht);
 
   /* sort cf and hm using permutations stored in phm */
   for (i = 0; i < len; ++i) {
@@ -202,7 +205,8 @@ void sort_terms_ff_32(
 void sort_terms_qq(
     mpz_t **cfp,
     hm_t **hmp,
-    ht_t *ht
+    ht_t *ht,
+    const md_t * const st
     )
 {
   mpz_t *cf = *cfp;
@@ -224,7 +228,7 @@ void sort_terms_qq(
   }
 
   /* sort pointers to hm entries -> getting permutations */
-  sort_r(phm, (unsigned long)len, sizeof(phm[0]), initial_gens_cmp, ht);
+  sort_r(phm, (unsigned long)len, sizeof(phm[0]), st->fp.initial_gens_cmp, ht);
 
   /* sort cf and hm using permutations stored in phm */
   for (i = 0; i < len; ++i) {
@@ -329,7 +333,7 @@ void import_input_data(
                         cfs_ff[j]   +=  (cfs_ff[j] >> 31) & fc;
                         cf8[j-off]  =   (cf8_t)(cfs_ff[j] % fc);
                     }
-                    sort_terms_ff_8(&(bs->cf_8[ctr]), &(bs->hm[ctr]), ht);
+                    sort_terms_ff_8(&(bs->cf_8[ctr]), &(bs->hm[ctr]), ht, st);
                     ctr++;
                 }
                 off +=  lens[i];
@@ -347,7 +351,7 @@ void import_input_data(
                         cfs_ff[j]   +=  (cfs_ff[j] >> 31) & fc;
                         cf16[j-off] =   (cf16_t)(cfs_ff[j] % fc);
                     }
-                    sort_terms_ff_16(&(bs->cf_16[ctr]), &(bs->hm[ctr]), ht);
+                    sort_terms_ff_16(&(bs->cf_16[ctr]), &(bs->hm[ctr]), ht, st);
                     ctr++;
                 }
                 off +=  lens[i];
@@ -365,7 +369,7 @@ void import_input_data(
                         cfs_ff[j]   +=  (cfs_ff[j] >> 31) & fc;
                         cf32[j-off] =   (cf32_t)(cfs_ff[j] % fc);
                     }
-                    sort_terms_ff_32(&(bs->cf_32[ctr]), &(bs->hm[ctr]), ht);
+                    sort_terms_ff_32(&(bs->cf_32[ctr]), &(bs->hm[ctr]), ht, st);
                     ctr++;
                 }
                 off +=  lens[i];
@@ -395,7 +399,7 @@ void import_input_data(
                         mpz_divexact(mul, prod_den, *(cfs_qq[2*j+1]));
                         mpz_mul(cfq[j-off], mul, *(cfs_qq[2*j]));
                     }
-                    sort_terms_qq(&(bs->cf_qq[ctr]), &(bs->hm[ctr]), ht);
+                    sort_terms_qq(&(bs->cf_qq[ctr]), &(bs->hm[ctr]), ht, st);
                     ctr++;
                 }
                 off +=  lens[i];
@@ -613,6 +617,11 @@ void set_ff_bits(md_t *st, int32_t fc){
                 }
             }
         }
+        /* signature based linear algebra is only available for 32 bit
+         * coefficients, smaller primes are handled there, too */
+        if (st->use_signatures > 0) {
+            st->ff_bits = 32;
+        }
     }
 }
 
@@ -675,6 +684,7 @@ int validate_input_data(
         *max_nr_pairsp  =   0;
     }
     if (*la_optionp != 1 && *la_optionp != 2 &&
+            *la_optionp != 3 &&
             *la_optionp != 42 && *la_optionp != 44) {
         fprintf(stderr, "Fixes linear algebra option to exact sparse.\n");
         *la_optionp =   2;
@@ -791,10 +801,10 @@ int32_t check_and_set_meta_data(
     /* note: prime check should be done in julia */
     st->fc    = field_char;
 
-    set_ff_bits(st, st->fc);
-
     st->use_signatures  =   use_signatures;
 
+    set_ff_bits(st, st->fc);
+
     /* monomial order */
     if (mon_order != 0 && mon_order != 1) {
         st->mo  = 0;
@@ -837,6 +847,16 @@ int32_t check_and_set_meta_data(
         st->mnsel = max_nr_pairs;
     }
 
+    /* default memory budget for one matrix, see set_memory_budget() */
+    st->mem_budget  = memory_budget();
+
+    /* everything is kept in core, see set_out_of_core_dir() */
+    st->ooc_dir = NULL;
+
+    /* default column threshold for sparse accumulators,
+     * see set_spa_min_ncols() */
+    st->spa_min_ncols = SPA_MIN_NCOLS;
+
     /* set linear algebra option */
     if (la_option <= 0) {
         st->laopt = 1;
@@ -855,38 +875,34 @@ int32_t check_and_set_meta_data(
 }
 
 void set_function_pointers(
-        const md_t *st
+        md_t *st
         )
 {
   /* todo: this needs to be generalized for different monomial orders */
     if (st->nev > 0) {
-      initial_input_cmp   = initial_input_cmp_be;
-      initial_gens_cmp    = initial_gens_cmp_be;
-      monomial_cmp        = monomial_cmp_be;
-      spair_cmp           = spair_cmp_be;
-      hcm_cmp             = hcm_cmp_pivots_be;
+      st->fp.initial_input_cmp   = initial_input_cmp_be;
+      st->fp.initial_gens_cmp    = initial_gens_cmp_be;
+      st->fp.spair_cmp           = spair_cmp_be;
+      st->fp.hcm_cmp             = hcm_cmp_pivots_be;
     } else {
         switch (st->mo) {
             case 0:
-                initial_input_cmp   = initial_input_cmp_drl;
-                initial_gens_cmp    = initial_gens_cmp_drl;
-                monomial_cmp        = monomial_cmp_drl;
-                spair_cmp           = spair_cmp_drl;
-                hcm_cmp             = hcm_cmp_pivots_drl;
+                st->fp.initial_input_cmp   = initial_input_cmp_drl;
+                st->fp.initial_gens_cmp    = initial_gens_cmp_drl;
+                st->fp.spair_cmp           = spair_cmp_drl;
+                st->fp.hcm_cmp             = hcm_cmp_pivots_drl;
                 break;
             case 1:
-                initial_input_cmp   = initial_input_cmp_lex;
-                initial_gens_cmp    = initial_gens_cmp_lex;
-                monomial_cmp        = monomial_cmp_lex;
-                spair_cmp           = spair_cmp_deglex;
-                hcm_cmp             = hcm_cmp_pivots_lex;
+                st->fp.initial_input_cmp   = initial_input_cmp_lex;
+                st->fp.initial_gens_cmp    = initial_gens_cmp_lex;
+                st->fp.spair_cmp           = spair_cmp_deglex;
+                st->fp.hcm_cmp             = hcm_cmp_pivots_lex;
                 break;
             default:
-                initial_input_cmp   = initial_input_cmp_drl;
-                initial_gens_cmp    = initial_gens_cmp_drl;
-                monomial_cmp        = monomial_cmp_drl;
-                spair_cmp           = spair_cmp_drl;
-                hcm_cmp             = hcm_cmp_pivots_drl;
+                st->fp.initial_input_cmp   = initial_input_cmp_drl;
+                st->fp.initial_gens_cmp    = initial_gens_cmp_drl;
+                st->fp.spair_cmp           = spair_cmp_drl;
+                st->fp.hcm_cmp             = hcm_cmp_pivots_drl;
         }
     }
 
@@ -896,112 +912,115 @@ void set_function_pointers(
     case 0:
       switch (st->laopt) {
         case 1:
-          linear_algebra  = exact_sparse_linear_algebra_ab_first_qq;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_ab_first_qq;
           break;
         case 2:
-          linear_algebra  = exact_sparse_linear_algebra_qq;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_qq;
           break;
         default:
-          linear_algebra  = exact_sparse_linear_algebra_qq;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_qq;
       }
-      interreduce_matrix_rows = interreduce_matrix_rows_qq;
+      st->fp.interreduce_matrix_rows = interreduce_matrix_rows_qq;
       break;
 
     case 8:
       switch (st->laopt) {
         case 1:
-          linear_algebra  = exact_sparse_dense_linear_algebra_ff_8;
+          st->fp.linear_algebra  = exact_sparse_dense_linear_algebra_ff_8;
           break;
         case 2:
-          linear_algebra  = exact_sparse_linear_algebra_ff_8;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_8;
           break;
         case 42:
-          linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_8;
+          st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_8;
           break;
         case 43:
-          linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_8_2;
+          st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_8_2;
           break;
         case 44:
-          linear_algebra  = probabilistic_sparse_linear_algebra_ff_8;
+          st->fp.linear_algebra  = probabilistic_sparse_linear_algebra_ff_8;
           break;
         default:
-          linear_algebra  = exact_sparse_linear_algebra_ff_8;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_8;
       }
-      exact_linear_algebra    = exact_sparse_linear_algebra_ff_8;
-      interreduce_matrix_rows = interreduce_matrix_rows_ff_8;
-      normalize_initial_basis = normalize_initial_basis_ff_8;
+      st->fp.exact_linear_algebra    = exact_sparse_linear_algebra_ff_8;
+      st->fp.interreduce_matrix_rows = interreduce_matrix_rows_ff_8;
+      st->fp.normalize_initial_basis = normalize_initial_basis_ff_8;
       break;
 
     case 16:
       switch (st->laopt) {
         case 1:
-          linear_algebra  = exact_sparse_dense_linear_algebra_ff_16;
+          st->fp.linear_algebra  = exact_sparse_dense_linear_algebra_ff_16;
           break;
         case 2:
-          linear_algebra  = exact_sparse_linear_algebra_ff_16;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_16;
           break;
         case 42:
-          linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_16;
+          st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_16;
           break;
         case 43:
-          linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_16_2;
+          st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_16_2;
           break;
         case 44:
-          linear_algebra  = probabilistic_sparse_linear_algebra_ff_16;
+          st->fp.linear_algebra  = probabilistic_sparse_linear_algebra_ff_16;
           break;
         default:
-          linear_algebra  = exact_sparse_linear_algebra_ff_16;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_16;
       }
-      exact_linear_algebra    = exact_sparse_linear_algebra_ff_16;
-      interreduce_matrix_rows = interreduce_matrix_rows_ff_16;
-      normalize_initial_basis = normalize_initial_basis_ff_16;
+      st->fp.exact_linear_algebra    = exact_sparse_linear_algebra_ff_16;
+      st->fp.interreduce_matrix_rows = interreduce_matrix_rows_ff_16;
+      st->fp.normalize_initial_basis = normalize_initial_basis_ff_16;
       break;
 
     case 32:
       switch (st->laopt) {
         case 1:
-          linear_algebra  = exact_sparse_dense_linear_algebra_ff_32;
+          st->fp.linear_algebra  = exact_sparse_dense_linear_algebra_ff_32;
           break;
         case 2:
-          linear_algebra  = exact_sparse_linear_algebra_ff_32;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_32;
+          break;
+        case 3:
+          st->fp.linear_algebra  = exact_sparse_block_linear_algebra_ff_32;
           break;
         case 42:
-          linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32;
+          st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32;
           break;
         case 43:
-          linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32_2;
+          st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32_2;
           break;
         case 44:
-          linear_algebra  = probabilistic_sparse_linear_algebra_ff_32;
+          st->fp.linear_algebra  = probabilistic_sparse_linear_algebra_ff_32;
           break;
         default:
-          linear_algebra  = exact_sparse_linear_algebra_ff_32;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_32;
       }
-      exact_linear_algebra    = exact_sparse_linear_algebra_ff_32;
-      interreduce_matrix_rows = interreduce_matrix_rows_ff_32;
-      normalize_initial_basis = normalize_initial_basis_ff_32;
-      sba_linear_algebra      = sba_linear_algebra_ff_32;
+      st->fp.exact_linear_algebra    = exact_sparse_linear_algebra_ff_32;
+      st->fp.interreduce_matrix_rows = interreduce_matrix_rows_ff_32;
+      st->fp.normalize_initial_basis = normalize_initial_basis_ff_32;
+      st->fp.sba_linear_algebra      = sba_linear_algebra_ff_32;
 
-      sba_reduce_dense_row_by_known_pivots_sparse_ff_32 =
+      st->fp.sba_reduce_dense_row_by_known_pivots_sparse_ff_32 =
         sba_reduce_dense_row_by_known_pivots_sparse_31_bit;
       /* if coeffs are smaller than 17 bit we can optimize reductions */
       if (st->fc < (int32_t)(1) << 18) {
-        reduce_dense_row_by_all_pivots_ff_32 =
+        st->fp.reduce_dense_row_by_all_pivots_ff_32 =
           reduce_dense_row_by_all_pivots_17_bit;
-        reduce_dense_row_by_old_pivots_ff_32 =
+        st->fp.reduce_dense_row_by_old_pivots_ff_32 =
           reduce_dense_row_by_old_pivots_17_bit;
-        reduce_dense_row_by_known_pivots_sparse_ff_32 =
+        st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32 =
           reduce_dense_row_by_known_pivots_sparse_17_bit;
-        reduce_dense_row_by_dense_new_pivots_ff_32  =
+        st->fp.reduce_dense_row_by_dense_new_pivots_ff_32  =
           reduce_dense_row_by_dense_new_pivots_17_bit;
       } else {
-          reduce_dense_row_by_all_pivots_ff_32 =
+          st->fp.reduce_dense_row_by_all_pivots_ff_32 =
             reduce_dense_row_by_all_pivots_31_bit;
-          reduce_dense_row_by_old_pivots_ff_32 =
+          st->fp.reduce_dense_row_by_old_pivots_ff_32 =
             reduce_dense_row_by_old_pivots_31_bit;
-          reduce_dense_row_by_known_pivots_sparse_ff_32 =
+          st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32 =
             reduce_dense_row_by_known_pivots_sparse_31_bit;
-          reduce_dense_row_by_dense_new_pivots_ff_32  =
+          st->fp.reduce_dense_row_by_dense_new_pivots_ff_32  =
             reduce_dense_row_by_dense_new_pivots_31_bit;
       }
       break;
@@ -1009,45 +1028,48 @@ void set_function_pointers(
     default:
       switch (st->laopt) {
         case 1:
-          linear_algebra  = exact_sparse_dense_linear_algebra_ff_32;
+          st->fp.linear_algebra  = exact_sparse_dense_linear_algebra_ff_32;
           break;
         case 2:
-          linear_algebra  = exact_sparse_linear_algebra_ff_32;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_32;
+          break;
+        case 3:
+          st->fp.linear_algebra  = exact_sparse_block_linear_algebra_ff_32;
           break;
         case 42:
-          linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32;
+          st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32;
           break;
         case 43:
-          linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32_2;
+          st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32_2;
           break;
         case 44:
-          linear_algebra  = probabilistic_sparse_linear_algebra_ff_32;
+          st->fp.linear_algebra  = probabilistic_sparse_linear_algebra_ff_32;
           break;
         default:
-          linear_algebra  = exact_sparse_linear_algebra_ff_32;
+          st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_32;
       }
-      exact_linear_algebra    = exact_sparse_linear_algebra_ff_32;
-      interreduce_matrix_rows = interreduce_matrix_rows_ff_32;
-      normalize_initial_basis = normalize_initial_basis_ff_32;
+      st->fp.exact_linear_algebra    = exact_sparse_linear_algebra_ff_32;
+      st->fp.interreduce_matrix_rows = interreduce_matrix_rows_ff_32;
+      st->fp.normalize_initial_basis = normalize_initial_basis_ff_32;
 
       /* if coeffs are smaller than 17 bit we can optimize reductions */
       if (st->fc < (int32_t)(1) << 18) {
-        reduce_dense_row_by_all_pivots_ff_32 =
+        st->fp.reduce_dense_row_by_all_pivots_ff_32 =
           reduce_dense_row_by_all_pivots_17_bit;
-        reduce_dense_row_by_old_pivots_ff_32 =
+        st->fp.reduce_dense_row_by_old_pivots_ff_32 =
           reduce_dense_row_by_old_pivots_17_bit;
-        reduce_dense_row_by_known_pivots_sparse_ff_32 =
+        st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32 =
           reduce_dense_row_by_known_pivots_sparse_17_bit;
-        reduce_dense_row_by_dense_new_pivots_ff_32  =
+        st->fp.reduce_dense_row_by_dense_new_pivots_ff_32  =
           reduce_dense_row_by_dense_new_pivots_17_bit;
       } else {
-          reduce_dense_row_by_all_pivots_ff_32 =
+          st->fp.reduce_dense_row_by_all_pivots_ff_32 =
             reduce_dense_row_by_all_pivots_31_bit;
-          reduce_dense_row_by_old_pivots_ff_32 =
+          st->fp.reduce_dense_row_by_old_pivots_ff_32 =
             reduce_dense_row_by_old_pivots_31_bit;
-          reduce_dense_row_by_known_pivots_sparse_ff_32 =
+          st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32 =
             reduce_dense_row_by_known_pivots_sparse_31_bit;
-          reduce_dense_row_by_dense_new_pivots_ff_32  =
+          st->fp.reduce_dense_row_by_dense_new_pivots_ff_32  =
             reduce_dense_row_by_dense_new_pivots_31_bit;
       }
   }
@@ -1092,98 +1114,138 @@ int32_t check_and_set_meta_data_trace(
             la_option, use_signatures, reduce_gb, pbm_file, info_level);
 }
 
+/* sets the memory budget for one matrix in bytes: 0 keeps the default one
+ * taken from the available memory, < 0 switches the budget off */
+void set_memory_budget(
+        md_t *st,
+        const int64_t mem_budget
+        )
+{
+    if (mem_budget != 0) {
+        st->mem_budget  = mem_budget < 0 ? -1 : mem_budget;
+    }
+}
+
+/* switches on the out-of-core storage of trace rounds and redundant basis
+ * elements in temporary files in directory dir, NULL or an empty name
+ * keeps everything in core. dir must live as long as st. */
+void set_out_of_core_dir(
+        md_t *st,
+        const char *dir
+        )
+{
+    st->ooc_dir = (dir != NULL && dir[0] != '\0') ? dir : NULL;
+}
+
+/* sets the minimal number of columns of matrices reduced with sparse
+ * accumulators: < 0 keeps the default SPA_MIN_NCOLS, 0 uses them for
+ * all matrices, e.g. in order to check them on small examples */
+void set_spa_min_ncols(
+        md_t *st,
+        const int64_t spa_min_ncols
+        )
+{
+    if (spa_min_ncols >= 0) {
+        st->spa_min_ncols = spa_min_ncols;
+    }
+}
+
 static inline void reset_function_pointers(
+        md_t *st,
         const uint32_t prime,
         const uint32_t laopt
         )
 {
     if (prime < (int32_t)(1) << 8) {
-        exact_linear_algebra    = exact_sparse_linear_algebra_ff_8;
-        interreduce_matrix_rows = interreduce_matrix_rows_ff_8;
-        normalize_initial_basis = normalize_initial_basis_ff_8;
+        st->fp.exact_linear_algebra    = exact_sparse_linear_algebra_ff_8;
+        st->fp.interreduce_matrix_rows = interreduce_matrix_rows_ff_8;
+        st->fp.normalize_initial_basis = normalize_initial_basis_ff_8;
         switch (laopt) {
           case 1:
-            linear_algebra  = exact_sparse_dense_linear_algebra_ff_8;
+            st->fp.linear_algebra  = exact_sparse_dense_linear_algebra_ff_8;
             break;
           case 2:
-            linear_algebra  = exact_sparse_linear_algebra_ff_8;
+            st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_8;
             break;
           case 42:
-            linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_8;
+            st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_8;
             break;
           case 43:
-            linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_8_2;
+            st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_8_2;
             break;
           case 44:
-            linear_algebra  = probabilistic_sparse_linear_algebra_ff_8;
+            st->fp.linear_algebra  = probabilistic_sparse_linear_algebra_ff_8;
             break;
           default:
-            linear_algebra  = exact_sparse_linear_algebra_ff_8;
+            st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_8;
         }
     } else {
         if (prime < (int32_t)(1) << 16) {
-            exact_linear_algebra    = exact_sparse_linear_algebra_ff_16;
-            interreduce_matrix_rows = interreduce_matrix_rows_ff_16;
-            normalize_initial_basis = normalize_initial_basis_ff_16;
+            st->fp.exact_linear_algebra    = exact_sparse_linear_algebra_ff_16;
+            st->fp.interreduce_matrix_rows = interreduce_matrix_rows_ff_16;
+            st->fp.normalize_initial_basis = normalize_initial_basis_ff_16;
             switch (laopt) {
               case 1:
-                linear_algebra  = exact_sparse_dense_linear_algebra_ff_16;
+                st->fp.linear_algebra  = exact_sparse_dense_linear_algebra_ff_16;
                 break;
               case 2:
-                linear_algebra  = exact_sparse_linear_algebra_ff_16;
+                st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_16;
                 break;
               case 42:
-                linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_16;
+                st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_16;
                 break;
               case 43:
-                linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_16_2;
+                st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_16_2;
                 break;
               case 44:
-                linear_algebra  = probabilistic_sparse_linear_algebra_ff_16;
+                st->fp.linear_algebra  = probabilistic_sparse_linear_algebra_ff_16;
                 break;
               default:
-                linear_algebra  = exact_sparse_linear_algebra_ff_16;
+                st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_16;
             }
         } else {
-            exact_linear_algebra    = exact_sparse_linear_algebra_ff_32;
-            interreduce_matrix_rows = interreduce_matrix_rows_ff_32;
-            normalize_initial_basis = normalize_initial_basis_ff_32;
+            st->fp.exact_linear_algebra    = exact_sparse_linear_algebra_ff_32;
+            st->fp.interreduce_matrix_rows = interreduce_matrix_rows_ff_32;
+            st->fp.normalize_initial_basis = normalize_initial_basis_ff_32;
             switch (laopt) {
               case 1:
-                linear_algebra  = exact_sparse_dense_linear_algebra_ff_32;
+                st->fp.linear_algebra  = exact_sparse_dense_linear_algebra_ff_32;
                 break;
               case 2:
-                linear_algebra  = exact_sparse_linear_algebra_ff_32;
+                st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_32;
+                break;
+              case 3:
+                st->fp.linear_algebra  = exact_sparse_block_linear_algebra_ff_32;
                 break;
               case 42:
-                linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32;
+                st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32;
                 break;
               case 43:
-                linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32_2;
+                st->fp.linear_algebra  = probabilistic_sparse_dense_linear_algebra_ff_32_2;
                 break;
               case 44:
-                linear_algebra  = probabilistic_sparse_linear_algebra_ff_32;
+                st->fp.linear_algebra  = probabilistic_sparse_linear_algebra_ff_32;
                 break;
               default:
-                linear_algebra  = exact_sparse_linear_algebra_ff_32;
+                st->fp.linear_algebra  = exact_sparse_linear_algebra_ff_32;
             }
             if (prime < (int32_t)(1) << 18) {
-                reduce_dense_row_by_all_pivots_ff_32 =
+                st->fp.reduce_dense_row_by_all_pivots_ff_32 =
                     reduce_dense_row_by_all_pivots_17_bit;
-                reduce_dense_row_by_old_pivots_ff_32 =
+                st->fp.reduce_dense_row_by_old_pivots_ff_32 =
                     reduce_dense_row_by_old_pivots_17_bit;
-                reduce_dense_row_by_known_pivots_sparse_ff_32 =
+                st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32 =
                     reduce_dense_row_by_known_pivots_sparse_17_bit;
-                reduce_dense_row_by_dense_new_pivots_ff_32  =
+                st->fp.reduce_dense_row_by_dense_new_pivots_ff_32  =
                     reduce_dense_row_by_dense_new_pivots_17_bit;
             } else {
-                reduce_dense_row_by_all_pivots_ff_32 =
+                st->fp.reduce_dense_row_by_all_pivots_ff_32 =
                   reduce_dense_row_by_all_pivots_31_bit;
-                reduce_dense_row_by_old_pivots_ff_32 =
+                st->fp.reduce_dense_row_by_old_pivots_ff_32 =
                   reduce_dense_row_by_old_pivots_31_bit;
-                reduce_dense_row_by_known_pivots_sparse_ff_32 =
+                st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32 =
                   reduce_dense_row_by_known_pivots_sparse_31_bit;
-                reduce_dense_row_by_dense_new_pivots_ff_32  =
+                st->fp.reduce_dense_row_by_dense_new_pivots_ff_32  =
                   reduce_dense_row_by_dense_new_pivots_31_bit;
             }
         }
@@ -1191,49 +1253,50 @@ static inline void reset_function_pointers(
 
 }
 static inline void reset_trace_function_pointers(
+        md_t *st,
         const uint32_t prime
         )
 {
     if (prime < (int32_t)(1) << 8) {
-        exact_linear_algebra        = exact_sparse_linear_algebra_ff_8;
-        interreduce_matrix_rows     = interreduce_matrix_rows_ff_8;
-        normalize_initial_basis     = normalize_initial_basis_ff_8;
-        application_linear_algebra  = exact_application_sparse_linear_algebra_ff_8;
-        trace_linear_algebra        = exact_trace_sparse_linear_algebra_ff_8;
+        st->fp.exact_linear_algebra        = exact_sparse_linear_algebra_ff_8;
+        st->fp.interreduce_matrix_rows     = interreduce_matrix_rows_ff_8;
+        st->fp.normalize_initial_basis     = normalize_initial_basis_ff_8;
+        st->fp.application_linear_algebra  = exact_application_sparse_linear_algebra_ff_8;
+        st->fp.trace_linear_algebra        = exact_trace_sparse_linear_algebra_ff_8;
     } else {
         if (prime < (int32_t)(1) << 16) {
-            exact_linear_algebra        = exact_sparse_linear_algebra_ff_16;
-            interreduce_matrix_rows     = interreduce_matrix_rows_ff_16;
-            normalize_initial_basis     = normalize_initial_basis_ff_16;
-            application_linear_algebra  = exact_application_sparse_linear_algebra_ff_16;
-            trace_linear_algebra        = exact_trace_sparse_linear_algebra_ff_16;
+            st->fp.exact_linear_algebra        = exact_sparse_linear_algebra_ff_16;
+            st->fp.interreduce_matrix_rows     = interreduce_matrix_rows_ff_16;
+            st->fp.normalize_initial_basis     = normalize_initial_basis_ff_16;
+            st->fp.application_linear_algebra  = exact_application_sparse_linear_algebra_ff_16;
+            st->fp.trace_linear_algebra        = exact_trace_sparse_linear_algebra_ff_16;
         } else {
-            exact_linear_algebra        = exact_sparse_linear_algebra_ff_32;
-            interreduce_matrix_rows     = interreduce_matrix_rows_ff_32;
-            normalize_initial_basis     = normalize_initial_basis_ff_32;
-            application_linear_algebra  = exact_application_sparse_linear_algebra_ff_32;
-            trace_linear_algebra        = exact_trace_sparse_linear_algebra_ff_32;
+            st->fp.exact_linear_algebra        = exact_sparse_linear_algebra_ff_32;
+            st->fp.interreduce_matrix_rows     = interreduce_matrix_rows_ff_32;
+            st->fp.normalize_initial_basis     = normalize_initial_basis_ff_32;
+            st->fp.application_linear_algebra  = exact_application_sparse_linear_algebra_ff_32;
+            st->fp.trace_linear_algebra        = exact_trace_sparse_linear_algebra_ff_32;
             if (prime < (int32_t)(1) << 18) {
-                reduce_dense_row_by_all_pivots_ff_32 =
+                st->fp.reduce_dense_row_by_all_pivots_ff_32 =
                     reduce_dense_row_by_all_pivots_17_bit;
-                reduce_dense_row_by_old_pivots_ff_32 =
+                st->fp.reduce_dense_row_by_old_pivots_ff_32 =
                     reduce_dense_row_by_old_pivots_17_bit;
-                trace_reduce_dense_row_by_known_pivots_sparse_ff_32 =
+                st->fp.trace_reduce_dense_row_by_known_pivots_sparse_ff_32 =
                     trace_reduce_dense_row_by_known_pivots_sparse_17_bit;
-                reduce_dense_row_by_known_pivots_sparse_ff_32 =
+                st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32 =
                     reduce_dense_row_by_known_pivots_sparse_17_bit;
-                reduce_dense_row_by_dense_new_pivots_ff_32  =
+                st->fp.reduce_dense_row_by_dense_new_pivots_ff_32  =
                     reduce_dense_row_by_dense_new_pivots_17_bit;
             } else {
-                reduce_dense_row_by_all_pivots_ff_32 =
+                st->fp.reduce_dense_row_by_all_pivots_ff_32 =
                   reduce_dense_row_by_all_pivots_31_bit;
-                reduce_dense_row_by_old_pivots_ff_32 =
+                st->fp.reduce_dense_row_by_old_pivots_ff_32 =
                   reduce_dense_row_by_old_pivots_31_bit;
-                trace_reduce_dense_row_by_known_pivots_sparse_ff_32 =
+                st->fp.trace_reduce_dense_row_by_known_pivots_sparse_ff_32 =
                   trace_reduce_dense_row_by_known_pivots_sparse_31_bit;
-                reduce_dense_row_by_known_pivots_sparse_ff_32 =
+                st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32 =
                   reduce_dense_row_by_known_pivots_sparse_31_bit;
-                reduce_dense_row_by_dense_new_pivots_ff_32  =
+                st->fp.reduce_dense_row_by_dense_new_pivots_ff_32  =
                   reduce_dense_row_by_dense_new_pivots_31_bit;
             }
         }
@@ -24,7 +24,7 @@
 #include "data.h"
 
 void set_function_pointers(
-        const md_t *st
+        md_t *st
         );
 
 void set_ff_bits(md_t *st, int32_t fc);
@@ -32,25 +32,29 @@ void set_ff_bits(md_t *st, int32_t fc);
 void sort_terms_ff_8(
     cf8_t **cfp,
     hm_t **hmp,
-    ht_t *ht
+    ht_t *ht,
+    const md_t * const st
     );
 
 void sort_terms_ff_16(
     cf16_t **cfp,
     hm_t **hmp,
-    ht_t *ht
+    ht_t *ht,
+    const md_t * const st
     );
 
 void sort_terms_ff_32(
     cf32_t **cfp,
     hm_t **hmp,
-    ht_t *ht
+    ht_t *ht,
+    const md_t * const st
     );
 
 void sort_terms_qq(
     mpz_t **cfp,
     hm_t **hmp,
-    ht_t *ht
+    ht_t *ht,
+    const md_t * const st
     );
 
 void import_input_data(
@@ -112,6 +116,21 @@ int32_t check_and_set_meta_data_trace(
         const int32_t info_level
         );
 
+void set_memory_budget(
+        md_t *st,
+        const int64_t mem_budget
+        );
+
+void set_out_of_core_dir(
+        md_t *st,
+        const char *dir
+        );
+
+void set_spa_min_ncols(
+        md_t *st,
+        const int64_t spa_min_ncols
+        );
+
 /* for normal form input data */
 void import_input_data_nf_ff_32(
         bs_t *tbr,
@@ -21,7 +21,7 @@
 #include "data.h"
 
 /* That's also enough if AVX512 is avaialable on the system */
-#if defined HAVE_AVX2
+#if defined HAVE_AVX2 || defined SIMD_DISPATCH
 #include <immintrin.h>
 #elif defined __aarch64__
 #include <arm_neon.h>
@@ -185,7 +185,7 @@ static int is_kernel_trivial(
 
     /* fill random value array */
     for (i = 0; i < ncr; ++i) {
-        mul[i]  = (int64_t)rand() & fc;
+        mul[i]  = (int64_t)random_number() & fc;
     }
     for (i = 0; i < sat->ld; ++i) {
         memset(dr, 0, (unsigned long)dim * sizeof(int64_t));
@@ -302,6 +302,144 @@ static inline cf32_t *multiply_sparse_matrix_row_ff_32(
     return row;
 }
 
+static inline void add_multiple_of_row_17_bit_scalar(
+        int64_t *dr,
+        const hm_t * const dts,
+        const cf32_t * const cfs,
+        const int64_t mul
+        )
+{
+    len_t j;
+    const len_t os  = dts[PRELOOP];
+    const len_t len = dts[LENGTH];
+    const hm_t * const ds  = dts + OFFSET;
+    for (j = 0; j < os; ++j) {
+        dr[ds[j]] +=  mul * cfs[j];
+    }
+    for (; j < len; j += UNROLL) {
+        dr[ds[j]]   +=  mul * cfs[j];
+        dr[ds[j+1]] +=  mul * cfs[j+1];
+        dr[ds[j+2]] +=  mul * cfs[j+2];
+        dr[ds[j+3]] +=  mul * cfs[j+3];
+    }
+}
+
+#if defined SIMD_DISPATCH
+TARGET_AVX2 static void add_multiple_of_row_17_bit_avx2(
+        int64_t *dr,
+        const hm_t * const dts,
+        const cf32_t * const cfs,
+        const int64_t mul
+        )
+{
+    len_t j;
+    int64_t res[4] __attribute__((aligned(32)));
+    __m256i redv, mulv, prodv, drv, resv;
+    const len_t len = dts[LENGTH];
+    const len_t os  = len % 8;
+    const hm_t * const ds  = dts + OFFSET;
+    const uint32_t mul32 = (int32_t)mul;
+    mulv  = _mm256_set1_epi32(mul32);
+    for (j = 0; j < os; ++j) {
+        dr[ds[j]]  +=  mul * cfs[j];
+    }
+    for (; j < len; j += 8) {
+        redv  = _mm256_lddqu_si256((__m256i*)(cfs+j));
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j+1]],
+            dr[ds[j+3]],
+            dr[ds[j+5]],
+            dr[ds[j+7]]);
+        /* first four mult-adds -- lower */
+        prodv = _mm256_mul_epu32(mulv, _mm256_srli_epi64(redv, 32));
+        resv  = _mm256_add_epi64(drv, prodv);
+        _mm256_store_si256((__m256i*)(res), resv);
+        dr[ds[j+1]] = res[0];
+        dr[ds[j+3]] = res[1];
+        dr[ds[j+5]] = res[2];
+        dr[ds[j+7]] = res[3];
+        /* second four mult-adds -- higher */
+        prodv = _mm256_mul_epu32(mulv, redv);
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j]],
+            dr[ds[j+2]],
+            dr[ds[j+4]],
+            dr[ds[j+6]]);
+        resv  = _mm256_add_epi64(drv, prodv);
+        _mm256_store_si256((__m256i*)(res), resv);
+        dr[ds[j]]   = res[0];
+        dr[ds[j+2]] = res[1];
+        dr[ds[j+4]] = res[2];
+        dr[ds[j+6]] = res[3];
+    }
+}
+
+TARGET_AVX512 static void add_multiple_of_row_17_bit_avx512(
+        int64_t *dr,
+        const hm_t * const dts,
+        const cf32_t * const cfs,
+        const int64_t mul
+        )
+{
+    len_t j;
+    int64_t res[8] __attribute__((aligned(64)));
+    __m512i redv, mulv, prodv, drv, resv;
+    const len_t len = dts[LENGTH];
+    const len_t os  = len % 16;
+    const hm_t * const ds  = dts + OFFSET;
+    const uint32_t mul32 = (int32_t)mul;
+    mulv  = _mm512_set1_epi32(mul32);
+    for (j = 0; j < os; ++j) {
+        dr[ds[j]]  +=  mul * cfs[j];
+    }
+    for (; j < len; j += 16) {
+        redv  = _mm512_loadu_si512((__m512i*)(cfs+j));
+        drv   = _mm512_setr_epi64(
+            dr[ds[j+1]],
+            dr[ds[j+3]],
+            dr[ds[j+5]],
+            dr[ds[j+7]],
+            dr[ds[j+9]],
+            dr[ds[j+11]],
+            dr[ds[j+13]],
+            dr[ds[j+15]]);
+        /* first four mult-adds -- lower */
+        prodv = _mm512_mul_epu32(mulv, _mm512_srli_epi64(redv, 32));
+        resv  = _mm512_add_epi64(drv, prodv);
+        _mm512_store_si512((__m512*)(res), resv);
+        dr[ds[j+1]]  = res[0];
+        dr[ds[j+3]]  = res[1];
+        dr[ds[j+5]]  = res[2];
+        dr[ds[j+7]]  = res[3];
+        dr[ds[j+9]]  = res[4];
+        dr[ds[j+11]] = res[5];
+        dr[ds[j+13]] = res[6];
+        dr[ds[j+15]] = res[7];
+        /* second four mult-adds -- higher */
+        prodv = _mm512_mul_epu32(mulv, redv);
+        drv   = _mm512_setr_epi64(
+            dr[ds[j]],
+            dr[ds[j+2]],
+            dr[ds[j+4]],
+            dr[ds[j+6]],
+            dr[ds[j+8]],
+            dr[ds[j+10]],
+            dr[ds[j+12]],
+            dr[ds[j+14]]);
+        resv  = _mm512_add_epi64(drv, prodv);
+        _mm512_store_si512((__m512i*)(res), resv);
+        dr[ds[j]]    = res[0];
+        dr[ds[j+2]]  = res[1];
+        dr[ds[j+4]]  = res[2];
+        dr[ds[j+6]]  = res[3];
+        dr[ds[j+8]]  = res[4];
+        dr[ds[j+10]] = res[5];
+        dr[ds[j+12]] = res[6];
+        dr[ds[j+14]] = res[7];
+    }
+}
+#endif
+
 static hm_t *reduce_dense_row_by_known_pivots_sparse_17_bit(
         int64_t *dr,
         mat_t *mat,
@@ -330,16 +468,12 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_17_bit(
     } else {
         rba = NULL;
     }
-#if defined HAVE_AVX512_F
-    int64_t res[8] __attribute__((aligned(64)));
-    __m512i redv, mulv, prodv, drv, resv;
-#elif defined HAVE_AVX2
-    int64_t res[4] __attribute__((aligned(32)));
-    __m256i redv, mulv, prodv, drv, resv;
-#elif defined __aarch64__
+#if defined __aarch64__
     uint64_t tmp[2] __attribute__((aligned(32)));
     uint32x4_t redv;
     uint64x2_t drv, resv;
+#elif defined SIMD_DISPATCH
+    const int simd = simd_level();
 #endif
 
     k = 0;
@@ -368,99 +502,7 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_17_bit(
             }
         }
         cfs   = mcf[dts[COEFFS]];
-#if defined HAVE_AVX512_F
-        const len_t len = dts[LENGTH];
-        const len_t os  = len % 16;
-        const hm_t * const ds  = dts + OFFSET;
-        const uint32_t mul32 = (int32_t)(mod - dr[i]);
-        mulv  = _mm512_set1_epi32(mul32);
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]]  +=  mul * cfs[j];
-        }
-        for (; j < len; j += 16) {
-            redv  = _mm512_loadu_si512((__m512i*)(cfs+j));
-            drv   = _mm512_setr_epi64(
-                dr[ds[j+1]],
-                dr[ds[j+3]],
-                dr[ds[j+5]],
-                dr[ds[j+7]],
-                dr[ds[j+9]],
-                dr[ds[j+11]],
-                dr[ds[j+13]],
-                dr[ds[j+15]]);
-            /* first four mult-adds -- lower */
-            prodv = _mm512_mul_epu32(mulv, _mm512_srli_epi64(redv, 32));
-            resv  = _mm512_add_epi64(drv, prodv);
-            _mm512_store_si512((__m512*)(res), resv);
-            dr[ds[j+1]]  = res[0];
-            dr[ds[j+3]]  = res[1];
-            dr[ds[j+5]]  = res[2];
-            dr[ds[j+7]]  = res[3];
-            dr[ds[j+9]]  = res[4];
-            dr[ds[j+11]] = res[5];
-            dr[ds[j+13]] = res[6];
-            dr[ds[j+15]] = res[7];
-            /* second four mult-adds -- higher */
-            prodv = _mm512_mul_epu32(mulv, redv);
-            drv   = _mm512_setr_epi64(
-                dr[ds[j]],
-                dr[ds[j+2]],
-                dr[ds[j+4]],
-                dr[ds[j+6]],
-                dr[ds[j+8]],
-                dr[ds[j+10]],
-                dr[ds[j+12]],
-                dr[ds[j+14]]);
-            resv  = _mm512_add_epi64(drv, prodv);
-            _mm512_store_si512((__m512i*)(res), resv);
-            dr[ds[j]]    = res[0];
-            dr[ds[j+2]]  = res[1];
-            dr[ds[j+4]]  = res[2];
-            dr[ds[j+6]]  = res[3];
-            dr[ds[j+8]]  = res[4];
-            dr[ds[j+10]] = res[5];
-            dr[ds[j+12]] = res[6];
-            dr[ds[j+14]] = res[7];
-        }
-#elif defined HAVE_AVX2
-        const len_t len = dts[LENGTH];
-        const len_t os  = len % 8;
-        const hm_t * const ds  = dts + OFFSET;
-        const uint32_t mul32 = (int32_t)(mod - dr[i]);
-        mulv  = _mm256_set1_epi32(mul32);
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]]  +=  mul * cfs[j];
-        }
-        for (; j < len; j += 8) {
-            redv  = _mm256_lddqu_si256((__m256i*)(cfs+j));
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+1]],
-                dr[ds[j+3]],
-                dr[ds[j+5]],
-                dr[ds[j+7]]);
-            /* first four mult-adds -- lower */
-            prodv = _mm256_mul_epu32(mulv, _mm256_srli_epi64(redv, 32));
-            resv  = _mm256_add_epi64(drv, prodv);
-            _mm256_store_si256((__m256i*)(res), resv);
-            dr[ds[j+1]] = res[0];
-            dr[ds[j+3]] = res[1];
-            dr[ds[j+5]] = res[2];
-            dr[ds[j+7]] = res[3];
-            /* second four mult-adds -- higher */
-            prodv = _mm256_mul_epu32(mulv, redv);
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j]],
-                dr[ds[j+2]],
-                dr[ds[j+4]],
-                dr[ds[j+6]]);
-            resv  = _mm256_add_epi64(drv, prodv);
-            _mm256_store_si256((__m256i*)(res), resv);
-            dr[ds[j]]   = res[0];
-            dr[ds[j+2]] = res[1];
-            dr[ds[j+4]] = res[2];
-            dr[ds[j+6]] = res[3];
-        }
-#elif defined __aarch64__
+#if defined __aarch64__
         const len_t len       = dts[LENGTH];
         const len_t os        = len % 16;
         const hm_t * const ds = dts + OFFSET;
@@ -533,22 +575,24 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_17_bit(
             dr[ds[j+15]] = (int64_t)tmp[1];
         }
 #else
-        const len_t os  = dts[PRELOOP];
-        const len_t len = dts[LENGTH];
-        const hm_t * const ds  = dts + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] +=  mul * cfs[j];
-        }
-        for (; j < len; j += UNROLL) {
-            dr[ds[j]]   +=  mul * cfs[j];
-            dr[ds[j+1]] +=  mul * cfs[j+1];
-            dr[ds[j+2]] +=  mul * cfs[j+2];
-            dr[ds[j+3]] +=  mul * cfs[j+3];
+#if defined SIMD_DISPATCH
+        switch (simd) {
+            case SIMD_AVX512:
+                add_multiple_of_row_17_bit_avx512(dr, dts, cfs, mul);
+                break;
+            case SIMD_AVX2:
+                add_multiple_of_row_17_bit_avx2(dr, dts, cfs, mul);
+                break;
+            default:
+                add_multiple_of_row_17_bit_scalar(dr, dts, cfs, mul);
         }
+#else
+        add_multiple_of_row_17_bit_scalar(dr, dts, cfs, mul);
+#endif
 #endif
         dr[i] = 0;
-        st->application_nr_mult +=  len / 1000.0;
-        st->application_nr_add  +=  len / 1000.0;
+        st->application_nr_mult +=  dts[LENGTH] / 1000.0;
+        st->application_nr_add  +=  dts[LENGTH] / 1000.0;
         st->application_nr_red++;
     }
     if (k == 0) {
@@ -662,6 +706,193 @@ static hm_t *trace_reduce_dense_row_by_known_pivots_sparse_17_bit(
     return row;
 }
 
+/* dr -= mul * row modulo mod2, for the sparse row of length len with
+ * columns ds and coefficients cfs */
+static inline void add_multiple_of_row_31_bit_scalar(
+        int64_t *dr,
+        const hm_t * const ds,
+        const len_t len,
+        const cf32_t * const cfs,
+        const int64_t mul,
+        const int64_t mod2
+        )
+{
+    len_t j;
+    const len_t os  = len % UNROLL;
+    for (j = 0; j < os; ++j) {
+        dr[ds[j]]   -=  mul * cfs[j];
+        dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
+    }
+    for (; j < len; j += UNROLL) {
+        dr[ds[j]]   -=  mul * cfs[j];
+        dr[ds[j+1]] -=  mul * cfs[j+1];
+        dr[ds[j+2]] -=  mul * cfs[j+2];
+        dr[ds[j+3]] -=  mul * cfs[j+3];
+        dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
+        dr[ds[j+1]] +=  (dr[ds[j+1]] >> 63) & mod2;
+        dr[ds[j+2]] +=  (dr[ds[j+2]] >> 63) & mod2;
+        dr[ds[j+3]] +=  (dr[ds[j+3]] >> 63) & mod2;
+    }
+}
+
+#if defined SIMD_DISPATCH
+TARGET_AVX2 static void add_multiple_of_row_31_bit_avx2(
+        int64_t *dr,
+        const hm_t * const ds,
+        const len_t len,
+        const cf32_t * const cfs,
+        const int64_t mul,
+        const int64_t mod2
+        )
+{
+    len_t j;
+    int64_t res[4] __attribute__((aligned(32)));
+    __m256i cmpv, redv, drv, mulv, prodv, resv, rresv;
+    __m256i zerov= _mm256_set1_epi64x(0);
+    __m256i mod2v = _mm256_set1_epi64x(mod2);
+    const len_t os  = len % 8;
+    const uint32_t mul32 = (uint32_t)mul;
+    mulv  = _mm256_set1_epi32(mul32);
+    for (j = 0; j < os; ++j) {
+        dr[ds[j]] -=  mul * cfs[j];
+        dr[ds[j]] +=  (dr[ds[j]] >> 63) & mod2;
+    }
+    for (; j < len; j += 8) {
+        redv  = _mm256_loadu_si256((__m256i*)(cfs+j));
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j+1]],
+            dr[ds[j+3]],
+            dr[ds[j+5]],
+            dr[ds[j+7]]);
+        /* first four mult-adds -- lower */
+        prodv = _mm256_mul_epu32(mulv, _mm256_srli_epi64(redv, 32));
+        resv  = _mm256_sub_epi64(drv, prodv);
+        cmpv  = _mm256_cmpgt_epi64(zerov, resv);
+        rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
+        _mm256_store_si256((__m256i*)(res), rresv);
+        dr[ds[j+1]] = res[0];
+        dr[ds[j+3]] = res[1];
+        dr[ds[j+5]] = res[2];
+        dr[ds[j+7]] = res[3];
+        /* second four mult-adds -- higher */
+        prodv = _mm256_mul_epu32(mulv, redv);
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j]],
+            dr[ds[j+2]],
+            dr[ds[j+4]],
+            dr[ds[j+6]]);
+        resv  = _mm256_sub_epi64(drv, prodv);
+        cmpv  = _mm256_cmpgt_epi64(zerov, resv);
+        rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
+        _mm256_store_si256((__m256i*)(res), rresv);
+        dr[ds[j]]   = res[0];
+        dr[ds[j+2]] = res[1];
+        dr[ds[j+4]] = res[2];
+        dr[ds[j+6]] = res[3];
+    }
+}
+
+TARGET_AVX512 static void add_multiple_of_row_31_bit_avx512(
+        int64_t *dr,
+        const hm_t * const ds,
+        const len_t len,
+        const cf32_t * const cfs,
+        const int64_t mul,
+        const int64_t mod2
+        )
+{
+    len_t j;
+    int64_t res[8] __attribute__((aligned(64)));
+    __m512i redv, drv, mulv, prodv, resv, rresv;
+    __mmask8 cmpv;
+    __m512i zerov = _mm512_set1_epi64(0);
+    __m512i mod2v = _mm512_set1_epi64(mod2);
+    const len_t os  = len % 16;
+    const uint32_t mul32 = (int32_t)mul;
+    mulv  = _mm512_set1_epi32(mul32);
+    for (j = 0; j < os; ++j) {
+        dr[ds[j]] -= mul * cfs[j];
+        dr[ds[j]] += (dr[ds[j]] >> 63) & mod2;
+    }
+    for (; j < len; j += 16) {
+        redv  = _mm512_loadu_si512((__m512i*)(cfs+j));
+        drv   = _mm512_setr_epi64(
+            dr[ds[j+1]],
+            dr[ds[j+3]],
+            dr[ds[j+5]],
+            dr[ds[j+7]],
+            dr[ds[j+9]],
+            dr[ds[j+11]],
+            dr[ds[j+13]],
+            dr[ds[j+15]]);
+        /* first four mult-adds -- lower */
+        prodv = _mm512_mul_epu32(mulv, _mm512_srli_epi64(redv, 32));
+        resv  = _mm512_sub_epi64(drv, prodv);
+        cmpv  = _mm512_cmpgt_epi64_mask(zerov, resv);
+        rresv = _mm512_mask_add_epi64(resv, cmpv, resv, mod2v);
+        _mm512_store_si512((__m512*)(res), rresv);
+        dr[ds[j+1]]  = res[0];
+        dr[ds[j+3]]  = res[1];
+        dr[ds[j+5]]  = res[2];
+        dr[ds[j+7]]  = res[3];
+        dr[ds[j+9]]  = res[4];
+        dr[ds[j+11]] = res[5];
+        dr[ds[j+13]] = res[6];
+        dr[ds[j+15]] = res[7];
+        /* second four mult-adds -- higher */
+        prodv = _mm512_mul_epu32(mulv, redv);
+        drv   = _mm512_setr_epi64(
+            dr[ds[j]],
+            dr[ds[j+2]],
+            dr[ds[j+4]],
+            dr[ds[j+6]],
+            dr[ds[j+8]],
+            dr[ds[j+10]],
+            dr[ds[j+12]],
+            dr[ds[j+14]]);
+        resv  = _mm512_sub_epi64(drv, prodv);
+        cmpv  = _mm512_cmpgt_epi64_mask(zerov, resv);
+        rresv = _mm512_mask_add_epi64(resv, cmpv, resv, mod2v);
+        _mm512_store_si512((__m512i*)(res), rresv);
+        dr[ds[j]]    = res[0];
+        dr[ds[j+2]]  = res[1];
+        dr[ds[j+4]]  = res[2];
+        dr[ds[j+6]]  = res[3];
+        dr[ds[j+8]]  = res[4];
+        dr[ds[j+10]] = res[5];
+        dr[ds[j+12]] = res[6];
+        dr[ds[j+14]] = res[7];
+    }
+}
+#endif
+
+/* dispatches to the kernel of the SIMD extension simd (see simd_level()) */
+static inline void add_multiple_of_row_31_bit(
+        int64_t *dr,
+        const hm_t * const ds,
+        const len_t len,
+        const cf32_t * const cfs,
+        const int64_t mul,
+        const int64_t mod2,
+        const int simd
+        )
+{
+#if defined SIMD_DISPATCH
+    switch (simd) {
+        case SIMD_AVX512:
+            add_multiple_of_row_31_bit_avx512(dr, ds, len, cfs, mul, mod2);
+            break;
+        case SIMD_AVX2:
+            add_multiple_of_row_31_bit_avx2(dr, ds, len, cfs, mul, mod2);
+            break;
+        default:
+            add_multiple_of_row_31_bit_scalar(dr, ds, len, cfs, mul, mod2);
+    }
+#else
+    add_multiple_of_row_31_bit_scalar(dr, ds, len, cfs, mul, mod2);
+#endif
+}
+
 static hm_t *reduce_dense_row_by_known_pivots_sparse_up_to_ff_31_bit(
         int64_t *dr,
         bs_t *sat,
@@ -681,12 +912,7 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_up_to_ff_31_bit(
     int64_t np = -1;
     const int64_t mod   = (int64_t)st->fc;
     const int64_t mod2  = (int64_t)st->fc * st->fc;
-#ifdef HAVE_AVX2
-    int64_t res[4] __attribute__((aligned(32)));
-    __m256i cmpv, redv, drv, mulv, prodv, resv, rresv;
-    __m256i zerov= _mm256_set1_epi64x(0);
-    __m256i mod2v = _mm256_set1_epi64x(mod2);
-#endif
+    const int simd = simd_level();
 
     for (i = dpiv; i < end; ++i) {
         if (dr[i] != 0) {
@@ -706,68 +932,8 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_up_to_ff_31_bit(
         const int64_t mul = (int64_t)dr[i];
         dts = pivs[i];
         cfs = bs->cf_32[dts[COEFFS]];
-#ifdef HAVE_AVX2
         const len_t len = dts[LENGTH];
-        const len_t os  = len % 8;
-        const hm_t * const ds  = dts + OFFSET;
-        const uint32_t mul32 = (uint32_t)(dr[i]);
-        mulv  = _mm256_set1_epi32(mul32);
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] -=  mul * cfs[j];
-            dr[ds[j]] +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += 8) {
-            redv  = _mm256_loadu_si256((__m256i*)(cfs+j));
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+1]],
-                dr[ds[j+3]],
-                dr[ds[j+5]],
-                dr[ds[j+7]]);
-            /* first four mult-adds -- lower */
-            prodv = _mm256_mul_epu32(mulv, _mm256_srli_epi64(redv, 32));
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j+1]] = res[0];
-            dr[ds[j+3]] = res[1];
-            dr[ds[j+5]] = res[2];
-            dr[ds[j+7]] = res[3];
-            /* second four mult-adds -- higher */
-            prodv = _mm256_mul_epu32(mulv, redv);
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j]],
-                dr[ds[j+2]],
-                dr[ds[j+4]],
-                dr[ds[j+6]]);
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j]]   = res[0];
-            dr[ds[j+2]] = res[1];
-            dr[ds[j+4]] = res[2];
-            dr[ds[j+6]] = res[3];
-        }
-#else
-        const len_t os  = dts[PRELOOP];
-        const len_t len = dts[LENGTH];
-        const hm_t * const ds = dts + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]]   -=  mul * cfs[j];
-            dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += UNROLL) {
-            dr[ds[j]]   -=  mul * cfs[j];
-            dr[ds[j+1]] -=  mul * cfs[j+1];
-            dr[ds[j+2]] -=  mul * cfs[j+2];
-            dr[ds[j+3]] -=  mul * cfs[j+3];
-            dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
-            dr[ds[j+1]] +=  (dr[ds[j+1]] >> 63) & mod2;
-            dr[ds[j+2]] +=  (dr[ds[j+2]] >> 63) & mod2;
-            dr[ds[j+3]] +=  (dr[ds[j+3]] >> 63) & mod2;
-        }
-#endif
+        add_multiple_of_row_31_bit(dr, dts + OFFSET, len, cfs, mul, mod2, simd);
         dr[i] = 0;
         st->application_nr_mult +=  len / 1000.0;
         st->application_nr_add  +=  len / 1000.0;
@@ -823,12 +989,11 @@ static hm_t *sba_reduce_dense_row_by_known_pivots_sparse_31_bit(
     const int64_t mod  = (int64_t)st->fc;
     const int64_t mod2 = (int64_t)st->fc * st->fc;
     const len_t nc     = smat->nc;
-#ifdef HAVE_AVX2
-    int64_t res[4] __attribute__((aligned(32)));
-    __m256i cmpv, redv, drv, mulv, prodv, resv, rresv;
-    __m256i zerov= _mm256_set1_epi64x(0);
-    __m256i mod2v = _mm256_set1_epi64x(mod2);
-#endif
+    /* rows are reduced in parallel by sba_parallel_echelon_form_ff_32(),
+     * so we count locally and update the meta data once per row */
+    double nr_ops      = 0;
+    uint64_t nr_red    = 0;
+    const int simd = simd_level();
 
     k = 0;
     for (i = dpiv; i < nc; ++i) {
@@ -860,73 +1025,18 @@ static hm_t *sba_reduce_dense_row_by_known_pivots_sparse_31_bit(
         dts = pivs[i];
         cfs = smat->cc32[dts[SM_CFS]];
 
-#ifdef HAVE_AVX2
-        const len_t len = dts[SM_LEN];
-        const len_t os  = len % 8;
-        const hm_t * const ds  = dts + SM_OFFSET;
-        const uint32_t mul32 = (uint32_t)(dr[i]);
-        mulv  = _mm256_set1_epi32(mul32);
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] -=  mul * cfs[j];
-            dr[ds[j]] +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += 8) {
-            redv  = _mm256_loadu_si256((__m256i*)(cfs+j));
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+1]],
-                dr[ds[j+3]],
-                dr[ds[j+5]],
-                dr[ds[j+7]]);
-            /* first four mult-adds -- lower */
-            prodv = _mm256_mul_epu32(mulv, _mm256_srli_epi64(redv, 32));
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j+1]] = res[0];
-            dr[ds[j+3]] = res[1];
-            dr[ds[j+5]] = res[2];
-            dr[ds[j+7]] = res[3];
-            /* second four mult-adds -- higher */
-            prodv = _mm256_mul_epu32(mulv, redv);
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j]],
-                dr[ds[j+2]],
-                dr[ds[j+4]],
-                dr[ds[j+6]]);
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j]]   = res[0];
-            dr[ds[j+2]] = res[1];
-            dr[ds[j+4]] = res[2];
-            dr[ds[j+6]] = res[3];
-        }
-#else
-        const len_t os  = dts[SM_PRE];
         const len_t len = dts[SM_LEN];
-        const hm_t * const ds = dts + SM_OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]]   -=  mul * cfs[j];
-            dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += UNROLL) {
-            dr[ds[j]]   -=  mul * cfs[j];
-            dr[ds[j+1]] -=  mul * cfs[j+1];
-            dr[ds[j+2]] -=  mul * cfs[j+2];
-            dr[ds[j+3]] -=  mul * cfs[j+3];
-            dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
-            dr[ds[j+1]] +=  (dr[ds[j+1]] >> 63) & mod2;
-            dr[ds[j+2]] +=  (dr[ds[j+2]] >> 63) & mod2;
-            dr[ds[j+3]] +=  (dr[ds[j+3]] >> 63) & mod2;
-        }
-#endif
+        add_multiple_of_row_31_bit(dr, dts + SM_OFFSET, len, cfs, mul, mod2, simd);
         dr[i] = 0;
-        st->application_nr_mult +=  len / 1000.0;
-        st->application_nr_add  +=  len / 1000.0;
-        st->application_nr_red++;
+        nr_ops  +=  len / 1000.0;
+        nr_red++;
     }
+#pragma omp atomic
+    st->application_nr_mult +=  nr_ops;
+#pragma omp atomic
+    st->application_nr_add  +=  nr_ops;
+#pragma omp atomic
+    st->application_nr_red  +=  nr_red;
 
     if (k == 0) {
         free(smat->cr[ri]);
@@ -990,22 +1100,13 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_31_bit(
     } else {
         rba = NULL;
     }
-#if defined HAVE_AVX512_F
-    int64_t res[8] __attribute__((aligned(64)));
-    __m512i redv, drv, mulv, prodv, resv, rresv;
-    __mmask8 cmpv;
-    __m512i zerov = _mm512_set1_epi64(0);
-    __m512i mod2v = _mm512_set1_epi64(mod2);
-#elif defined HAVE_AVX2
-    int64_t res[4] __attribute__((aligned(32)));
-    __m256i cmpv, redv, drv, mulv, prodv, resv, rresv;
-    __m256i zerov= _mm256_set1_epi64x(0);
-    __m256i mod2v = _mm256_set1_epi64x(mod2);
-#elif defined __aarch64__
+#if defined __aarch64__
     const int64x2_t mod2v = vmovq_n_s64(mod2);
     int64_t tmp[2] __attribute__((aligned(32)));
     int32x4_t redv;
     int64x2_t drv, mask, resv;
+#else
+    const int simd = simd_level();
 #endif
 
     k = 0;
@@ -1035,109 +1136,7 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_31_bit(
             }
         }
         cfs   = mcf[dts[COEFFS]];
-#if defined HAVE_AVX512_F
-        const len_t len = dts[LENGTH];
-        const len_t os  = len % 16;
-        const hm_t * const ds  = dts + OFFSET;
-        const uint32_t mul32 = (int32_t)(dr[i]);
-        mulv  = _mm512_set1_epi32(mul32);
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] -= mul * cfs[j];
-            dr[ds[j]] += (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += 16) {
-            redv  = _mm512_loadu_si512((__m512i*)(cfs+j));
-            drv   = _mm512_setr_epi64(
-                dr[ds[j+1]],
-                dr[ds[j+3]],
-                dr[ds[j+5]],
-                dr[ds[j+7]],
-                dr[ds[j+9]],
-                dr[ds[j+11]],
-                dr[ds[j+13]],
-                dr[ds[j+15]]);
-            /* first four mult-adds -- lower */
-            prodv = _mm512_mul_epu32(mulv, _mm512_srli_epi64(redv, 32));
-            resv  = _mm512_sub_epi64(drv, prodv);
-            cmpv  = _mm512_cmpgt_epi64_mask(zerov, resv);
-            rresv = _mm512_mask_add_epi64(resv, cmpv, resv, mod2v);
-            _mm512_store_si512((__m512*)(res), rresv);
-            dr[ds[j+1]]  = res[0];
-            dr[ds[j+3]]  = res[1];
-            dr[ds[j+5]]  = res[2];
-            dr[ds[j+7]]  = res[3];
-            dr[ds[j+9]]  = res[4];
-            dr[ds[j+11]] = res[5];
-            dr[ds[j+13]] = res[6];
-            dr[ds[j+15]] = res[7];
-            /* second four mult-adds -- higher */
-            prodv = _mm512_mul_epu32(mulv, redv);
-            drv   = _mm512_setr_epi64(
-                dr[ds[j]],
-                dr[ds[j+2]],
-                dr[ds[j+4]],
-                dr[ds[j+6]],
-                dr[ds[j+8]],
-                dr[ds[j+10]],
-                dr[ds[j+12]],
-                dr[ds[j+14]]);
-            resv  = _mm512_sub_epi64(drv, prodv);
-            cmpv  = _mm512_cmpgt_epi64_mask(zerov, resv);
-            rresv = _mm512_mask_add_epi64(resv, cmpv, resv, mod2v);
-            _mm512_store_si512((__m512i*)(res), rresv);
-            dr[ds[j]]    = res[0];
-            dr[ds[j+2]]  = res[1];
-            dr[ds[j+4]]  = res[2];
-            dr[ds[j+6]]  = res[3];
-            dr[ds[j+8]]  = res[4];
-            dr[ds[j+10]] = res[5];
-            dr[ds[j+12]] = res[6];
-            dr[ds[j+14]] = res[7];
-        }
-#elif defined HAVE_AVX2
-        const len_t len = dts[LENGTH];
-        const len_t os  = len % 8;
-        const hm_t * const ds  = dts + OFFSET;
-        const uint32_t mul32 = (uint32_t)(dr[i]);
-        mulv  = _mm256_set1_epi32(mul32);
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] -=  mul * cfs[j];
-            dr[ds[j]] +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += 8) {
-            redv  = _mm256_loadu_si256((__m256i*)(cfs+j));
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+1]],
-                dr[ds[j+3]],
-                dr[ds[j+5]],
-                dr[ds[j+7]]);
-            /* first four mult-adds -- lower */
-            prodv = _mm256_mul_epu32(mulv, _mm256_srli_epi64(redv, 32));
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j+1]] = res[0];
-            dr[ds[j+3]] = res[1];
-            dr[ds[j+5]] = res[2];
-            dr[ds[j+7]] = res[3];
-            /* second four mult-adds -- higher */
-            prodv = _mm256_mul_epu32(mulv, redv);
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j]],
-                dr[ds[j+2]],
-                dr[ds[j+4]],
-                dr[ds[j+6]]);
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j]]   = res[0];
-            dr[ds[j+2]] = res[1];
-            dr[ds[j+4]] = res[2];
-            dr[ds[j+6]] = res[3];
-        }
-#elif defined __aarch64__
+#if defined __aarch64__
         const len_t len       = dts[LENGTH];
         const len_t os        = len % 8;
         const hm_t * const ds = dts + OFFSET;
@@ -1191,27 +1190,12 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_31_bit(
         }
 
 #else
-        const len_t os  = dts[PRELOOP];
-        const len_t len = dts[LENGTH];
-        const hm_t * const ds = dts + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]]   -=  mul * cfs[j];
-            dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += UNROLL) {
-            dr[ds[j]]   -=  mul * cfs[j];
-            dr[ds[j+1]] -=  mul * cfs[j+1];
-            dr[ds[j+2]] -=  mul * cfs[j+2];
-            dr[ds[j+3]] -=  mul * cfs[j+3];
-            dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
-            dr[ds[j+1]] +=  (dr[ds[j+1]] >> 63) & mod2;
-            dr[ds[j+2]] +=  (dr[ds[j+2]] >> 63) & mod2;
-            dr[ds[j+3]] +=  (dr[ds[j+3]] >> 63) & mod2;
-        }
+        add_multiple_of_row_31_bit(dr, dts + OFFSET, dts[LENGTH], cfs, mul, mod2,
+                simd);
 #endif
         dr[i] = 0;
-        st->application_nr_mult +=  len / 1000.0;
-        st->application_nr_add  +=  len / 1000.0;
+        st->application_nr_mult +=  dts[LENGTH] / 1000.0;
+        st->application_nr_add  +=  dts[LENGTH] / 1000.0;
         st->application_nr_red++;
     }
 
@@ -1241,6 +1225,115 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_31_bit(
 }
 
 
+/* Reduces the given row by the known pivots using a sparse accumulator:
+ * dr is zero on input and on output, only the columns stored in the heap
+ * hp are visited. Columns of the reduced row are collected at the end of
+ * hp, they are different from the ones still in the heap. */
+static hm_t *reduce_sparse_row_by_known_pivots_ff_32(
+        int64_t *dr,
+        hm_t *hp,
+        uint64_t *bm,
+        const hm_t * const row, /* row to be reduced */
+        const cf32_t * const rcf,
+        mat_t *mat,
+        hm_t *const *pivs,
+        const hm_t tmp_pos, /* position of new coeffs array in tmpcf */
+        const len_t mh,     /* multiplier hash for tracing */
+        const len_t bi,     /* basis index of generating element */
+        const len_t tr,     /* trace data? */
+        md_t *st
+        )
+{
+    hi_t i;
+    len_t j, k = 0, nh = 0;
+    cf32_t *cfs;
+    hm_t *dts;
+    const int64_t mod           = (int64_t)st->fc;
+    const int64_t mod2          = (int64_t)st->fc * st->fc;
+    const len_t ncols           = mat->nc;
+    const len_t ncl             = mat->ncl;
+    cf32_t * const * const mcf  = mat->cf_32;
+    hm_t * const rc             = hp + ncols - 1;
+
+    rba_t *rba;
+    if (tr > 0) {
+        rba = mat->rba[tmp_pos];
+    } else {
+        rba = NULL;
+    }
+
+    const len_t rlen  = row[LENGTH];
+    const hm_t * const rds  = row + OFFSET;
+    for (j = 0; j < rlen; ++j) {
+        dr[rds[j]]  = (int64_t)rcf[j];
+        spa_insert(hp, &nh, bm, rds[j]);
+    }
+
+    while (nh > 0) {
+        i = spa_extract_min(hp, &nh, bm);
+        if (dr[i] != 0) {
+            dr[i] = dr[i] % mod;
+        }
+        if (dr[i] == 0) {
+            continue;
+        }
+        if (pivs[i] == NULL) {
+            *(rc-k) = i;
+            k++;
+            continue;
+        }
+
+        /* found reducer row, get multiplier */
+        const int64_t mul = (int64_t)dr[i];
+        dts   = pivs[i];
+        if (i < ncl) {
+            /* set corresponding bit of reducer in reducer bit array */
+            if (tr > 0) {
+                rba[i/32] |= 1U << (i % 32);
+            }
+        }
+        cfs   = mcf[dts[COEFFS]];
+        const len_t len = dts[LENGTH];
+        const hm_t * const ds = dts + OFFSET;
+        /* the first entry is the pivot itself */
+        for (j = 1; j < len; ++j) {
+            spa_insert(hp, &nh, bm, ds[j]);
+            dr[ds[j]] -=  mul * cfs[j];
+            dr[ds[j]] +=  (dr[ds[j]] >> 63) & mod2;
+        }
+        dr[i] = 0;
+        st->application_nr_mult +=  len / 1000.0;
+        st->application_nr_add  +=  len / 1000.0;
+        st->application_nr_red++;
+    }
+
+    if (k == 0) {
+        return NULL;
+    }
+
+    hm_t *nrow  = (hm_t *)malloc((unsigned long)(k+OFFSET) * sizeof(hm_t));
+    cf32_t *cf  = (cf32_t *)malloc((unsigned long)(k) * sizeof(cf32_t));
+    hm_t *rs    = nrow + OFFSET;
+    len_t l     = 0;
+    for (j = 0; j < k; ++j) {
+        i = *(rc-j);
+        if (i >= ncl) {
+            rs[l] = (hm_t)i;
+            cf[l] = (cf32_t)dr[i];
+            l++;
+        }
+        dr[i] = 0;
+    }
+    nrow[BINDEX]  = bi;
+    nrow[MULT]    = mh;
+    nrow[COEFFS]  = tmp_pos;
+    nrow[PRELOOP] = l % UNROLL;
+    nrow[LENGTH]  = l;
+    mat->cf_32[tmp_pos]  = cf;
+
+    return nrow;
+}
+
 static hm_t *reduce_dense_row_by_known_pivots_sparse_sat_ff_31_bit(
         int64_t *dr,
         int64_t *drm,
@@ -1262,12 +1355,7 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_sat_ff_31_bit(
     int64_t np = -1;
     const int64_t mod           = (int64_t)st->fc;
     const int64_t mod2          = (int64_t)st->fc * st->fc;
-#ifdef HAVE_AVX2
-    int64_t res[4] __attribute__((aligned(32)));
-    __m256i cmpv, redv, drv, mulv, prodv, resv, rresv;
-    __m256i zerov= _mm256_set1_epi64x(0);
-    __m256i mod2v = _mm256_set1_epi64x(mod2);
-#endif
+    const int simd = simd_level();
 
     k = 0;
     for (i = dpiv; i < ncols; ++i) {
@@ -1287,131 +1375,14 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_sat_ff_31_bit(
 
         /* found reducer row, get multiplier */
         const int64_t mul = (int64_t)dr[i];
-        dts   = pivs[i];
-        dtsm  = mulh[dts[MULT]];
-        cfsm  = mulcf[dtsm[COEFFS]];
-        cfs   = pivcf[dts[COEFFS]];
-#ifdef HAVE_AVX2
-        const len_t len = dts[LENGTH];
-        const len_t os  = len % 8;
-        const hm_t * const ds  = dts + OFFSET;
-        const uint32_t mul32 = (uint32_t)(dr[i]);
-        mulv  = _mm256_set1_epi32(mul32);
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] -=  mul * cfs[j];
-            dr[ds[j]] +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += 8) {
-            redv  = _mm256_loadu_si256((__m256i*)(cfs+j));
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+1]],
-                dr[ds[j+3]],
-                dr[ds[j+5]],
-                dr[ds[j+7]]);
-            /* first four mult-adds -- lower */
-            prodv = _mm256_mul_epu32(mulv, _mm256_srli_epi64(redv, 32));
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j+1]] = res[0];
-            dr[ds[j+3]] = res[1];
-            dr[ds[j+5]] = res[2];
-            dr[ds[j+7]] = res[3];
-            /* second four mult-adds -- higher */
-            prodv = _mm256_mul_epu32(mulv, redv);
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j]],
-                dr[ds[j+2]],
-                dr[ds[j+4]],
-                dr[ds[j+6]]);
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j]]   = res[0];
-            dr[ds[j+2]] = res[1];
-            dr[ds[j+4]] = res[2];
-            dr[ds[j+6]] = res[3];
-        }
-        const len_t lenm = dtsm[LENGTH];
-        const len_t osm  = lenm % 8;
-        const hm_t * const dsm  = dtsm + OFFSET;
-        /* const uint32_t mulm32 = (uint32_t)(drm[i]); */
-        mulv  = _mm256_set1_epi32(mul32);
-        for (j = 0; j < osm; ++j) {
-            drm[dsm[j]] -=  mul * cfsm[j];
-            drm[dsm[j]] +=  (drm[dsm[j]] >> 63) & mod2;
-        }
-        for (; j < lenm; j += 8) {
-            redv  = _mm256_loadu_si256((__m256i*)(cfsm+j));
-            drv   = _mm256_setr_epi64x(
-                drm[dsm[j+1]],
-                drm[dsm[j+3]],
-                drm[dsm[j+5]],
-                drm[dsm[j+7]]);
-            /* first four mult-adds -- lower */
-            prodv = _mm256_mul_epu32(mulv, _mm256_srli_epi64(redv, 32));
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            drm[dsm[j+1]] = res[0];
-            drm[dsm[j+3]] = res[1];
-            drm[dsm[j+5]] = res[2];
-            drm[dsm[j+7]] = res[3];
-            /* second four mult-adds -- higher */
-            prodv = _mm256_mul_epu32(mulv, redv);
-            drv   = _mm256_setr_epi64x(
-                drm[dsm[j]],
-                drm[dsm[j+2]],
-                drm[dsm[j+4]],
-                drm[dsm[j+6]]);
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            drm[dsm[j]]   = res[0];
-            drm[dsm[j+2]] = res[1];
-            drm[dsm[j+4]] = res[2];
-            drm[dsm[j+6]] = res[3];
-        }
-#else
-        const len_t os  = dts[PRELOOP];
-        const len_t len = dts[LENGTH];
-        const hm_t * const ds = dts + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]]   -=  mul * cfs[j];
-            dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += UNROLL) {
-            dr[ds[j]]   -=  mul * cfs[j];
-            dr[ds[j+1]] -=  mul * cfs[j+1];
-            dr[ds[j+2]] -=  mul * cfs[j+2];
-            dr[ds[j+3]] -=  mul * cfs[j+3];
-            dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
-            dr[ds[j+1]] +=  (dr[ds[j+1]] >> 63) & mod2;
-            dr[ds[j+2]] +=  (dr[ds[j+2]] >> 63) & mod2;
-            dr[ds[j+3]] +=  (dr[ds[j+3]] >> 63) & mod2;
-        }
-        const len_t osm   = dtsm[PRELOOP];
-        const len_t lenm  = dtsm[LENGTH];
-        const hm_t * const dsm = dtsm + OFFSET;
-        for (j = 0; j < osm; ++j) {
-            drm[dsm[j]] -=  mul * cfsm[j];
-            drm[dsm[j]] +=  (drm[dsm[j]] >> 63) & mod2;
-        }
-        for (; j < lenm; j += UNROLL) {
-            drm[dsm[j]]   -=  mul * cfsm[j];
-            drm[dsm[j+1]] -=  mul * cfsm[j+1];
-            drm[dsm[j+2]] -=  mul * cfsm[j+2];
-            drm[dsm[j+3]] -=  mul * cfsm[j+3];
-            drm[dsm[j]]   +=  (drm[dsm[j]] >> 63) & mod2;
-            drm[dsm[j+1]] +=  (drm[dsm[j+1]] >> 63) & mod2;
-            drm[dsm[j+2]] +=  (drm[dsm[j+2]] >> 63) & mod2;
-            drm[dsm[j+3]] +=  (drm[dsm[j+3]] >> 63) & mod2;
-        }
-#endif
+        dts   = pivs[i];
+        dtsm  = mulh[dts[MULT]];
+        cfsm  = mulcf[dtsm[COEFFS]];
+        cfs   = pivcf[dts[COEFFS]];
+        const len_t len = dts[LENGTH];
+        add_multiple_of_row_31_bit(dr, dts + OFFSET, len, cfs, mul, mod2, simd);
+        add_multiple_of_row_31_bit(drm, dtsm + OFFSET, dtsm[LENGTH], cfsm, mul,
+                mod2, simd);
         dr[i] = 0;
         st->application_nr_mult +=  len / 1000.0;
         st->application_nr_add  +=  len / 1000.0;
@@ -1497,12 +1468,7 @@ static hm_t *trace_reduce_dense_row_by_known_pivots_sparse_31_bit(
     const len_t ncols           = mat->nc;
     const len_t ncl             = mat->ncl;
     cf32_t * const * const mcf  = mat->cf_32;
-#ifdef HAVE_AVX2
-    int64_t res[4] __attribute__((aligned(32)));
-    __m256i cmpv, redv, drv, mulv, prodv, resv, rresv;
-    __m256i zerov = _mm256_set1_epi64x(0);
-    __m256i mod2v = _mm256_set1_epi64x(mod2);
-#endif
+    const int simd = simd_level();
 
     k = 0;
     for (i = dpiv; i < ncols; ++i) {
@@ -1531,68 +1497,8 @@ static hm_t *trace_reduce_dense_row_by_known_pivots_sparse_31_bit(
             cfs   = mcf[dts[COEFFS]];
         }
 
-#ifdef HAVE_AVX2
-        const len_t len = dts[LENGTH];
-        const len_t os  = len % 8;
-        const hm_t * const ds  = dts + OFFSET;
-        const uint32_t mul32 = (uint32_t)(dr[i]);
-        mulv  = _mm256_set1_epi32(mul32);
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] -=  mul * cfs[j];
-            dr[ds[j]] +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += 8) {
-            redv  = _mm256_loadu_si256((__m256i*)(cfs+j));
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+1]],
-                dr[ds[j+3]],
-                dr[ds[j+5]],
-                dr[ds[j+7]]);
-            /* first four mult-adds -- lower */
-            prodv = _mm256_mul_epu32(mulv, _mm256_srli_epi64(redv, 32));
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j+1]] = res[0];
-            dr[ds[j+3]] = res[1];
-            dr[ds[j+5]] = res[2];
-            dr[ds[j+7]] = res[3];
-            /* second four mult-adds -- higher */
-            prodv = _mm256_mul_epu32(mulv, redv);
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j]],
-                dr[ds[j+2]],
-                dr[ds[j+4]],
-                dr[ds[j+6]]);
-            resv  = _mm256_sub_epi64(drv, prodv);
-            cmpv  = _mm256_cmpgt_epi64(zerov, resv);
-            rresv = _mm256_add_epi64(resv, _mm256_and_si256(cmpv, mod2v));
-            _mm256_store_si256((__m256i*)(res), rresv);
-            dr[ds[j]]   = res[0];
-            dr[ds[j+2]] = res[1];
-            dr[ds[j+4]] = res[2];
-            dr[ds[j+6]] = res[3];
-        }
-#else
-        const len_t os  = dts[PRELOOP];
         const len_t len = dts[LENGTH];
-        const hm_t * const ds = dts + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] -=  mul * cfs[j];
-            dr[ds[j]] +=  (dr[ds[j]] >> 63) & mod2;
-        }
-        for (; j < len; j += UNROLL) {
-            dr[ds[j]]   -=  mul * cfs[j];
-            dr[ds[j+1]] -=  mul * cfs[j+1];
-            dr[ds[j+2]] -=  mul * cfs[j+2];
-            dr[ds[j+3]] -=  mul * cfs[j+3];
-            dr[ds[j]]   +=  (dr[ds[j]] >> 63) & mod2;
-            dr[ds[j+1]] +=  (dr[ds[j+1]] >> 63) & mod2;
-            dr[ds[j+2]] +=  (dr[ds[j+2]] >> 63) & mod2;
-            dr[ds[j+3]] +=  (dr[ds[j+3]] >> 63) & mod2;
-        }
-#endif
+        add_multiple_of_row_31_bit(dr, dts + OFFSET, len, cfs, mul, mod2, simd);
         dr[i] = 0;
         st->trace_nr_mult +=  len / 1000.0;
         st->trace_nr_add  +=  len / 1000.0;
@@ -2375,7 +2281,7 @@ static void probabilistic_sparse_reduced_echelon_form_ff_32(
 
                 /* fill random value array */
                 for (j = 0; j < nrbl; ++j) {
-                    mull[j] = (int64_t)rand() & mask;
+                    mull[j] = (int64_t)random_number() & mask;
                 }
                 /* generate one dense row as random linear combination
                  * of the rows of the block */
@@ -2412,7 +2318,7 @@ static void probabilistic_sparse_reduced_echelon_form_ff_32(
                     cfs = NULL;
                     free(npiv);
                     npiv  = NULL;
-                    npiv  = reduce_dense_row_by_known_pivots_sparse_ff_32(
+                    npiv  = st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32(
                             drl, mat, bs, pivs, sc, cfp, 0, 0, 0, st);
                     if (!npiv) {
                         bctr  = nrbl;
@@ -2481,7 +2387,7 @@ static void probabilistic_sparse_reduced_echelon_form_ff_32(
             free(cfs);
             pivs[k] = NULL;
             pivs[k] = mat->tr[npivs++] =
-                reduce_dense_row_by_known_pivots_sparse_ff_32(
+                st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32(
                         dr, mat, bs, pivs, sc, cfp, mh, bi, 0, st);
         }
     }
@@ -2519,8 +2425,7 @@ static void sba_echelon_form_ff_32(
     int64_t *dr  = (int64_t *)malloc(
             (unsigned long)nc * sizeof(int64_t));
 
-    /* TODO: At the moment I do not see how to make this parallel due to
-     * reduction dependencies on the signatures. */
+    /* see sba_parallel_echelon_form_ff_32() for a parallel version */
     for (ri = 0, i = 0; i < nr; ++i) {
         hm_t *npiv      = smat->cr[i];
         cf32_t *cfs     = smat->pc32[npiv[SM_CFS]];
@@ -2548,7 +2453,7 @@ static void sba_echelon_form_ff_32(
          *     printf("%u ", ht->ev[sm][ii]);
          * }
          * printf("\n"); */
-        npiv = sba_reduce_dense_row_by_known_pivots_sparse_ff_32(
+        npiv = st->fp.sba_reduce_dense_row_by_known_pivots_sparse_ff_32(
                 dr, smat, pivs, offset, sm, si, ri, st);
         if (!npiv) {
             /* row s-reduced to zero, add syzygy and go on with next row */
@@ -2585,6 +2490,146 @@ static void sba_echelon_form_ff_32(
     dr   = NULL;
 }
 
+static void sba_parallel_echelon_form_ff_32(
+        smat_t *smat,
+        crit_t *syz,
+        md_t *st,
+        const ht_t * const ht
+        )
+{
+    len_t i, j, k;
+
+    /* row index, might differ from i if we encounter zero reductions */
+    len_t ri;
+
+    const len_t nc  = smat->nc;
+    const len_t nr  = smat->cld;
+    const int nthrds = st->nthrds;
+    /* number of rows reduced in parallel */
+    const len_t bsz = 4 * nthrds;
+
+    /* we fill in all known lead terms in pivs */
+    hm_t **pivs = (hm_t **)calloc((unsigned long)nc, sizeof(hm_t *));
+
+    int64_t *dr  = (int64_t *)malloc(
+            (unsigned long)nthrds * nc * sizeof(int64_t));
+
+    /* signatures of the rows of the current block */
+    hm_t *bsm   = (hm_t *)malloc((unsigned long)bsz * sizeof(hm_t));
+    len_t *bsi  = (len_t *)malloc((unsigned long)bsz * sizeof(len_t));
+
+    /* Rows are sorted by increasing signature, a row may only be reduced
+     * by rows of smaller signature. We handle blocks of bsz consecutive
+     * rows: First all rows of the block are reduced in parallel by the
+     * pivots of the previous blocks, then they are reduced one after the
+     * other by the new pivots of the block. */
+    for (ri = 0, i = 0; i < nr; i += bsz) {
+        const len_t nb = nr - i < bsz ? nr - i : bsz;
+#pragma omp parallel for num_threads(nthrds) \
+        private(j, k) schedule(dynamic)
+        for (k = 0; k < nb; ++k) {
+            int64_t *drl    = dr + (omp_get_thread_num() * nc);
+            hm_t *npiv      = smat->cr[i+k];
+            cf32_t *cfs     = smat->pc32[npiv[SM_CFS]];
+            const len_t os  = npiv[SM_PRE];
+            const len_t len = npiv[SM_LEN];
+            const hm_t * const ds = npiv + SM_OFFSET;
+            bsm[k] = npiv[SM_SMON];
+            bsi[k] = npiv[SM_SIDX];
+            memset(drl, 0, (unsigned long)nc * sizeof(int64_t));
+            for (j = 0; j < os; ++j) {
+                drl[ds[j]]  = (int64_t)cfs[j];
+            }
+            for (; j < len; j += UNROLL) {
+                drl[ds[j]]    = (int64_t)cfs[j];
+                drl[ds[j+1]]  = (int64_t)cfs[j+1];
+                drl[ds[j+2]]  = (int64_t)cfs[j+2];
+                drl[ds[j+3]]  = (int64_t)cfs[j+3];
+            }
+            const len_t offset = npiv[SM_OFFSET];
+            free(npiv);
+            smat->cr[i+k] = NULL;
+            /* the partially reduced row is stored at its own index,
+             * pivots of the previous blocks are stored at lower indices */
+            st->fp.sba_reduce_dense_row_by_known_pivots_sparse_ff_32(
+                    drl, smat, pivs, offset, bsm[k], bsi[k], i+k, st);
+        }
+        for (k = 0; k < nb; ++k) {
+            hm_t *npiv = smat->cr[i+k];
+            if (npiv == NULL) {
+                /* row s-reduced to zero, add syzygy and go on with next row */
+                add_syzygy_schreyer(syz, bsm[k], bsi[k], ht);
+                continue;
+            }
+            cf32_t *cfs     = smat->cc32[npiv[SM_CFS]];
+            if (pivs[npiv[SM_OFFSET]] == NULL) {
+                /* lead term is not reducible by the new pivots, the
+                 * row can be taken as it is */
+                smat->cr[i+k]   = NULL;
+                smat->cc32[i+k] = NULL;
+                npiv[SM_CFS]    = ri;
+                smat->cr[ri]    = npiv;
+                smat->cc32[ri]  = cfs;
+                ri++;
+                if (cfs[0] != 1) {
+                    normalize_sparse_matrix_row_ff_32(
+                            cfs, npiv[SM_PRE], npiv[SM_LEN], st->fc);
+                }
+                pivs[npiv[SM_OFFSET]] = npiv;
+                continue;
+            }
+            const len_t os  = npiv[SM_PRE];
+            const len_t len = npiv[SM_LEN];
+            const hm_t * const ds = npiv + SM_OFFSET;
+            memset(dr, 0, (unsigned long)nc * sizeof(int64_t));
+            for (j = 0; j < os; ++j) {
+                dr[ds[j]]  = (int64_t)cfs[j];
+            }
+            for (; j < len; j += UNROLL) {
+                dr[ds[j]]    = (int64_t)cfs[j];
+                dr[ds[j+1]]  = (int64_t)cfs[j+1];
+                dr[ds[j+2]]  = (int64_t)cfs[j+2];
+                dr[ds[j+3]]  = (int64_t)cfs[j+3];
+            }
+            const len_t offset = npiv[SM_OFFSET];
+            free(cfs);
+            smat->cc32[i+k] = NULL;
+            free(npiv);
+            smat->cr[i+k] = NULL;
+            npiv = st->fp.sba_reduce_dense_row_by_known_pivots_sparse_ff_32(
+                    dr, smat, pivs, offset, bsm[k], bsi[k], ri, st);
+            if (!npiv) {
+                add_syzygy_schreyer(syz, bsm[k], bsi[k], ht);
+                continue;
+            }
+            ri++;
+            if (smat->cc32[npiv[SM_CFS]][0] != 1) {
+                normalize_sparse_matrix_row_ff_32(
+                        smat->cc32[npiv[SM_CFS]], npiv[SM_PRE],
+                        npiv[SM_LEN], st->fc);
+            }
+            pivs[npiv[SM_OFFSET]] = npiv;
+        }
+    }
+
+    /* free initial coefficients coming from previous degree matrix */
+    for (i = 0; i < smat->pld; ++i) {
+        free(smat->pc32[i]);
+        smat->pc32[i] = NULL;
+    }
+    /* get number of zero reductions and adjust number of
+     * rows stored in matrix */
+    smat->nz  = smat->cld - ri;
+    smat->cld = ri;
+
+    free(bsm);
+    free(bsi);
+    free(pivs);
+    pivs = NULL;
+    free(dr);
+    dr   = NULL;
+}
+
 static void exact_sparse_reduced_echelon_form_ff_32(
         mat_t *mat,
         const bs_t * const tbr,
@@ -2623,8 +2668,21 @@ static void exact_sparse_reduced_echelon_form_ff_32(
     /* unkown pivot rows we have to reduce with the known pivots first */
     hm_t **upivs  = mat->tr;
 
-    int64_t *dr  = (int64_t *)malloc(
-            (unsigned long)(nthrds * ncols) * sizeof(int64_t));
+    /* very sparse matrices are reduced via sparse accumulators */
+    const int spa = use_sparse_accumulator(mat, st);
+
+    int64_t *dr  = NULL;
+    hm_t *hp     = NULL;
+    uint64_t *bm = NULL;
+    const len_t nbm = ncols / 64 + 1;
+    if (spa == 1) {
+        dr  = (int64_t *)calloc((unsigned long)nthrds * ncols, sizeof(int64_t));
+        hp  = (hm_t *)malloc((unsigned long)nthrds * ncols * sizeof(hm_t));
+        bm  = (uint64_t *)calloc((unsigned long)nthrds * nbm, sizeof(uint64_t));
+    } else {
+        dr  = (int64_t *)malloc(
+                (unsigned long)(nthrds * ncols) * sizeof(int64_t));
+    }
     /* mo need to have any sharing dependencies on parallel computation,
      * no data to be synchronized at this step of the linear algebra */
 #pragma omp parallel for num_threads(nthrds) \
@@ -2640,26 +2698,43 @@ static void exact_sparse_reduced_echelon_form_ff_32(
             const len_t bi  = npiv[BINDEX];
             const len_t mh  = npiv[MULT];
             const hm_t * const ds = npiv + OFFSET;
+            /* coefficients of the previous reduction result */
+            cf32_t *pcf     = NULL;
             k = 0;
-            memset(drl, 0, (unsigned long)ncols * sizeof(int64_t));
-            for (j = 0; j < os; ++j) {
-                drl[ds[j]]  = (int64_t)cfs[j];
-            }
-            for (; j < len; j += UNROLL) {
-                drl[ds[j]]    = (int64_t)cfs[j];
-                drl[ds[j+1]]  = (int64_t)cfs[j+1];
-                drl[ds[j+2]]  = (int64_t)cfs[j+2];
-                drl[ds[j+3]]  = (int64_t)cfs[j+3];
+            if (spa == 0) {
+                memset(drl, 0, (unsigned long)ncols * sizeof(int64_t));
+                for (j = 0; j < os; ++j) {
+                    drl[ds[j]]  = (int64_t)cfs[j];
+                }
+                for (; j < len; j += UNROLL) {
+                    drl[ds[j]]    = (int64_t)cfs[j];
+                    drl[ds[j+1]]  = (int64_t)cfs[j+1];
+                    drl[ds[j+2]]  = (int64_t)cfs[j+2];
+                    drl[ds[j+3]]  = (int64_t)cfs[j+3];
+                }
+                cfs = NULL;
             }
-            cfs = NULL;
             do {
-                /* If we do normal form computations the first monomial in the polynomial might not
-                be a known pivot, thus setting it to npiv[OFFSET] can lead to wrong results. */
-                sc  = st->nf == 0 ? npiv[OFFSET] : 0;
-                free(npiv);
-                free(cfs);
-                npiv  = mat->tr[i] = reduce_dense_row_by_known_pivots_sparse_ff_32(
-                        drl, mat, bs, pivs, sc, i, mh, bi, st->trace_level == LEARN_TRACER, st);
+                if (spa == 1) {
+                    /* the accumulator is empty after each reduction, so
+                     * the row is loaded again for each try */
+                    hm_t *row = reduce_sparse_row_by_known_pivots_ff_32(
+                            drl, hp + (omp_get_thread_num() * ncols),
+                            bm + (omp_get_thread_num() * nbm), npiv, cfs,
+                            mat, pivs, i, mh, bi,
+                            st->trace_level == LEARN_TRACER, st);
+                    free(npiv);
+                    free(pcf);
+                    npiv  = mat->tr[i] = row;
+                } else {
+                    /* If we do normal form computations the first monomial in the polynomial might not
+                    be a known pivot, thus setting it to npiv[OFFSET] can lead to wrong results. */
+                    sc  = st->nf == 0 ? npiv[OFFSET] : 0;
+                    free(npiv);
+                    free(cfs);
+                    npiv  = mat->tr[i] = st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32(
+                            drl, mat, bs, pivs, sc, i, mh, bi, st->trace_level == LEARN_TRACER, st);
+                }
                 if (st->nf > 0) {
                     if (!npiv) {
                         mat->tr[i]  = NULL;
@@ -2684,7 +2759,7 @@ static void exact_sparse_reduced_echelon_form_ff_32(
                                 mat->cf_32[npiv[COEFFS]], npiv[PRELOOP], npiv[LENGTH], st->fc);
                     }
                     k   = __sync_bool_compare_and_swap(&pivs[npiv[OFFSET]], NULL, npiv);
-                    cfs = mat->cf_32[npiv[COEFFS]];
+                    cfs = pcf = mat->cf_32[npiv[COEFFS]];
                 }
             } while (!k);
         }
@@ -2695,6 +2770,8 @@ static void exact_sparse_reduced_echelon_form_ff_32(
             free(pivs[i]);
             pivs[i] = NULL;
         }
+        free(hp);
+        free(bm);
         mat->np = 0;
         if (st->info_level > 0) {
             fprintf(stderr, "Zero reduction while applying tracer, bad prime.\n");
@@ -2724,7 +2801,17 @@ static void exact_sparse_reduced_echelon_form_ff_32(
         hm_t cf_array_pos;
         for (i = 0; i < ncr; ++i) {
             k = ncols-1-i;
-            if (pivs[k]) {
+            if (pivs[k] && spa == 1) {
+                hm_t *row = pivs[k];
+                cfs       = mat->cf_32[row[COEFFS]];
+                pivs[k]   = NULL;
+                pivs[k]   = mat->tr[npivs++] =
+                    reduce_sparse_row_by_known_pivots_ff_32(
+                            dr, hp, bm, row, cfs, mat, pivs, row[COEFFS],
+                            row[MULT], row[BINDEX], 0, st);
+                free(row);
+                free(cfs);
+            } else if (pivs[k]) {
                 memset(dr, 0, (unsigned long)ncols * sizeof(int64_t));
                 cfs = mat->cf_32[pivs[k][COEFFS]];
                 cf_array_pos    = pivs[k][COEFFS];
@@ -2747,7 +2834,7 @@ static void exact_sparse_reduced_echelon_form_ff_32(
                 free(cfs);
                 pivs[k] = NULL;
                 pivs[k] = mat->tr[npivs++] =
-                    reduce_dense_row_by_known_pivots_sparse_ff_32(
+                    st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32(
                             dr, mat, bs, pivs, sc, cf_array_pos, mh, bi, 0, st);
             }
         }
@@ -2760,6 +2847,8 @@ static void exact_sparse_reduced_echelon_form_ff_32(
     pivs  = NULL;
     free(dr);
     dr  = NULL;
+    free(hp);
+    free(bm);
 }
 
 static void exact_sparse_reduced_echelon_form_sat_ff_32(
@@ -3057,7 +3146,7 @@ static void exact_trace_sparse_reduced_echelon_form_ff_32(
             sc  = npiv[OFFSET];
             free(npiv);
             free(cfs);
-            npiv  = mat->tr[i]  = trace_reduce_dense_row_by_known_pivots_sparse_ff_32(
+            npiv  = mat->tr[i]  = st->fp.trace_reduce_dense_row_by_known_pivots_sparse_ff_32(
                     rba, drl, mat, bs, pivs, sc, i, mh, bi, st);
             if (!npiv) {
                 break;
@@ -3118,7 +3207,7 @@ static void exact_trace_sparse_reduced_echelon_form_ff_32(
             free(cfs);
             pivs[k] = NULL;
             pivs[k] = mat->tr[npivs++] =
-                reduce_dense_row_by_known_pivots_sparse_ff_32(
+                st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32(
                         dr, mat, bs, pivs, sc, cf_array_pos, mh, bi, 0, st);
         }
     }
@@ -3188,7 +3277,7 @@ static int exact_application_sparse_reduced_echelon_form_ff_32(
                 sc  = npiv[OFFSET];
                 free(npiv);
                 free(cfs);
-                npiv  = mat->tr[i]  = reduce_dense_row_by_known_pivots_sparse_ff_32(
+                npiv  = mat->tr[i]  = st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32(
                         drl, mat, bs, pivs, sc, i, mh, bi, 0, st);
                 if (!npiv) {
                     fprintf(stderr, "Unlucky prime detected, row reduced to zero.");
@@ -3253,7 +3342,7 @@ static int exact_application_sparse_reduced_echelon_form_ff_32(
             free(cfs);
             pivs[k] = NULL;
             pivs[k] = mat->tr[npivs++] =
-                reduce_dense_row_by_known_pivots_sparse_ff_32(
+                st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32(
                         dr, mat, bs, pivs, sc, cf_array_pos, mh, bi, 0, st);
         }
     }
@@ -3320,7 +3409,7 @@ static cf32_t **sparse_AB_CD_linear_algebra_ff_32(
         }
         sc  = ds[0];
         free(npiv);
-        drs[i]  = reduce_dense_row_by_old_pivots_ff_32(
+        drs[i]  = st->fp.reduce_dense_row_by_old_pivots_ff_32(
                 drl, mat, bs, pivs, sc, st->fc);
     }
     free(dr);
@@ -3353,10 +3442,11 @@ static cf32_t **sparse_AB_CD_linear_algebra_ff_32(
 static cf32_t **interreduce_dense_matrix_ff_32(
     cf32_t **dm,
     const len_t ncr,
-    const uint32_t fc
+    md_t *st
     )
 {
     len_t i, j, k, l;
+    const uint32_t fc = st->fc;
     int64_t *dr = malloc((unsigned long)ncr * sizeof(int64_t));
 
     for (i = 0; i < ncr; ++i) {
@@ -3378,7 +3468,7 @@ static cf32_t **interreduce_dense_matrix_ff_32(
             dm[k] = NULL;
             /* start with previous pivot the reduction process, so keep the
              * pivot element as it is */
-            dm[k] = reduce_dense_row_by_dense_new_pivots_ff_32(
+            dm[k] = st->fp.reduce_dense_row_by_dense_new_pivots_ff_32(
                     dr, &k, dm, ncr, fc);
         }
     }
@@ -3459,7 +3549,7 @@ static cf32_t **exact_dense_linear_algebra_ff_32(
         do {
             free(npiv);
             npiv = NULL;
-            npiv = reduce_dense_row_by_dense_new_pivots_ff_32(
+            npiv = st->fp.reduce_dense_row_by_dense_new_pivots_ff_32(
                     drl, &npc, nps, mat->ncr, st->fc);
             if (npc == -1) {
                 break;
@@ -3598,7 +3688,7 @@ static cf32_t **probabilistic_dense_linear_algebra_ff_32(
 
                 /* fill random value array */
                 for (j = 0; j < nrbl; ++j) {
-                    mull[j] = (int64_t)rand() & mask;
+                    mull[j] = (int64_t)random_number() & mask;
                 }
                 /* generate one dense row as random linear combination
                  * of the rows of the block */
@@ -3627,7 +3717,7 @@ static cf32_t **probabilistic_dense_linear_algebra_ff_32(
                 tmp = NULL;
                 do {
                     free(tmp);
-                    tmp = reduce_dense_row_by_dense_new_pivots_ff_32(
+                    tmp = st->fp.reduce_dense_row_by_dense_new_pivots_ff_32(
                             drl, &npc, nps, mat->ncr, st->fc);
                     if (npc == -1) {
                         bctr  = nrbl;
@@ -3730,7 +3820,7 @@ static cf32_t **probabilistic_sparse_dense_echelon_form_ff_32(
 
                 /* fill random value array */
                 for (j = 0; j < nrbl; ++j) {
-                    mull[j] = (int64_t)rand() % fc;
+                    mull[j] = (int64_t)random_number() % fc;
                 }
                 /* generate one dense row as random linear combination
                  * of the rows of the block */
@@ -3763,7 +3853,7 @@ static cf32_t **probabilistic_sparse_dense_echelon_form_ff_32(
                 tmp = NULL;
                 do {
                     free(tmp);
-                    tmp = reduce_dense_row_by_all_pivots_ff_32(
+                    tmp = st->fp.reduce_dense_row_by_all_pivots_ff_32(
                             drl, mat, bs, &npc, pivs, nps, st->fc);
                     if (npc == -1) {
                         bctr  = nrbl;
@@ -3944,7 +4034,11 @@ static void sba_linear_algebra_ff_32(
     smat->cc32 = realloc(smat->cc32,
             (unsigned long)smat->cld * sizeof(cf32_t *));
 
-    sba_echelon_form_ff_32(smat, syz, st, ht);
+    if (st->nthrds > 1) {
+        sba_parallel_echelon_form_ff_32(smat, syz, st, ht);
+    } else {
+        sba_echelon_form_ff_32(smat, syz, st, ht);
+    }
 
     /* timings */
     ct1 = cputime();
@@ -3988,6 +4082,383 @@ static void exact_sparse_linear_algebra_ff_32(
     }
 }
 
+/* Faugère-Lachartre like block reduction: the upper rows A|B of the
+ * matrix are the known pivots, the lower rows C|D have to be reduced.
+ * A and C live in the ncl left columns, B and D in the ncr right ones.
+ * B is stored in tiles of FL_TILE_WIDTH columns. First, for each row of
+ * C, the multipliers of the pivots are computed via a triangular solve
+ * with the left part A only. Then D is updated tile by tile: all rows
+ * are reduced by one tile of B before going on to the next one, so the
+ * tile and the accumulators stay in cache. */
+#define FL_TILE_WIDTH 8192
+
+static int fl_cmp_entries(
+        const void *a,
+        const void *b
+        )
+{
+    const uint64_t ea = *((uint64_t *)a);
+    const uint64_t eb = *((uint64_t *)b);
+
+    return (ea > eb) - (ea < eb);
+}
+
+/* maps each left column to the upper row having it as lead term, returns
+ * NULL if some left column has no such row or two rows share their lead */
+static len_t *fl_map_columns_to_pivots(
+        const mat_t * const mat
+        )
+{
+    len_t i;
+
+    const len_t nru = mat->nru;
+    const len_t ncl = mat->ncl;
+
+    if (nru != ncl) {
+        return NULL;
+    }
+    len_t *pr = (len_t *)malloc((unsigned long)ncl * sizeof(len_t));
+    for (i = 0; i < ncl; ++i) {
+        pr[i] = nru;
+    }
+    for (i = 0; i < nru; ++i) {
+        const hm_t lc = mat->rr[i][OFFSET];
+        if (lc >= ncl || pr[lc] != nru) {
+            free(pr);
+            return NULL;
+        }
+        pr[lc] = i;
+    }
+    return pr;
+}
+
+static void fl_reduce_lower_by_upper_rows_ff_32(
+        mat_t *mat,
+        const bs_t * const tbr,
+        const bs_t * const bs,
+        const len_t * const pr,
+        cf32_t **dcf,
+        md_t *st
+        )
+{
+    len_t i, j, k, t;
+
+    const len_t nru   = mat->nru;
+    const len_t nrl   = mat->nrl;
+    const len_t ncl   = mat->ncl;
+    const len_t ncr   = mat->ncr;
+    const int nthrds  = st->nthrds;
+    const int64_t mod   = (int64_t)st->fc;
+    const int64_t mod2  = (int64_t)st->fc * st->fc;
+
+    /* tiles of B, at most 64 of them */
+    len_t tw  = FL_TILE_WIDTH;
+    while (ncr / tw > 64) {
+        tw  *=  2;
+    }
+    const len_t ntl = ncr == 0 ? 0 : (ncr - 1) / tw + 1;
+
+    /* A: left parts of the pivots without their leading term,
+     * B: tile t holds the entries of pivot j in
+     *    bof[t*(nru+1)+j], ..., bof[t*(nru+1)+j+1]-1
+     *    with column indices relative to the tile */
+    int64_t *aof  = (int64_t *)calloc((unsigned long)nru + 1, sizeof(int64_t));
+    int64_t *bof  = (int64_t *)calloc((unsigned long)ntl * (nru + 1) + 1,
+            sizeof(int64_t));
+
+#pragma omp parallel for num_threads(nthrds) private(i, j)
+    for (i = 0; i < nru; ++i) {
+        const hm_t * const ds = mat->rr[i] + OFFSET;
+        const len_t len = mat->rr[i][LENGTH];
+        for (j = 1; j < len; ++j) {
+            if (ds[j] < ncl) {
+                aof[i+1]++;
+            } else {
+                bof[((ds[j]-ncl)/tw)*(nru+1)+i+1]++;
+            }
+        }
+    }
+    for (i = 0; i < nru; ++i) {
+        aof[i+1]  +=  aof[i];
+    }
+    /* tiles are stored one after the other */
+    for (t = 0; t < ntl; ++t) {
+        int64_t *of = bof + t*(nru+1);
+        of[0] = t == 0 ? 0 : bof[t*(nru+1)-1];
+        for (i = 0; i < nru; ++i) {
+            of[i+1] +=  of[i];
+        }
+    }
+    hm_t *acol    = (hm_t *)malloc((unsigned long)aof[nru] * sizeof(hm_t));
+    cf32_t *acf   = (cf32_t *)malloc((unsigned long)aof[nru] * sizeof(cf32_t));
+    const int64_t nb  = ntl == 0 ? 0 : bof[ntl*(nru+1)-1];
+    hm_t *bcol    = (hm_t *)malloc((unsigned long)nb * sizeof(hm_t));
+    cf32_t *bcf   = (cf32_t *)malloc((unsigned long)nb * sizeof(cf32_t));
+
+#pragma omp parallel for num_threads(nthrds) private(i, j, t)
+    for (i = 0; i < nru; ++i) {
+        const hm_t * const ds   = mat->rr[i] + OFFSET;
+        const cf32_t * const cf = bs->cf_32[mat->rr[i][COEFFS]];
+        const len_t len = mat->rr[i][LENGTH];
+        int64_t ai  = aof[i];
+        for (j = 1; j < len; ++j) {
+            if (ds[j] < ncl) {
+                acol[ai]  = ds[j];
+                acf[ai++] = cf[j];
+            } else {
+                t = (ds[j]-ncl)/tw;
+                /* the tile offsets are moved forward while filling */
+                const int64_t bi  = bof[t*(nru+1)+i]++;
+                bcol[bi]  = ds[j]-ncl-t*tw;
+                bcf[bi]   = cf[j];
+            }
+        }
+        free(mat->rr[i]);
+        mat->rr[i] = NULL;
+    }
+    /* reset the tile offsets */
+    for (t = ntl; t > 0; --t) {
+        int64_t *of = bof + (t-1)*(nru+1);
+        for (i = nru; i > 0; --i) {
+            of[i] = of[i-1];
+        }
+        of[0] = t == 1 ? 0 : bof[(t-1)*(nru+1)-1];
+    }
+
+    /* multipliers of the pivots for each row of C */
+    len_t **mpi   = (len_t **)calloc((unsigned long)nrl, sizeof(len_t *));
+    cf32_t **mcf  = (cf32_t **)calloc((unsigned long)nrl, sizeof(cf32_t *));
+    len_t *nmul   = (len_t *)calloc((unsigned long)nrl, sizeof(len_t));
+    /* entries of D sorted by column, packed as (column << 32 | coefficient) */
+    uint64_t **de = (uint64_t **)calloc((unsigned long)nrl, sizeof(uint64_t *));
+    len_t *nde    = (len_t *)calloc((unsigned long)nrl, sizeof(len_t));
+    len_t *cde    = (len_t *)calloc((unsigned long)nrl, sizeof(len_t));
+
+    const len_t drw = ncl > tw ? ncl : tw;
+    int64_t *dr     = (int64_t *)malloc(
+            (unsigned long)nthrds * drw * sizeof(int64_t));
+    len_t *tmpi     = (len_t *)malloc(
+            (unsigned long)nthrds * (ncl + 1) * sizeof(len_t));
+    cf32_t *tmpc    = (cf32_t *)malloc(
+            (unsigned long)nthrds * (ncl + 1) * sizeof(cf32_t));
+
+    /* triangular solve C := C A^-1, only on the left columns */
+#pragma omp parallel for num_threads(nthrds) \
+    private(i, j, k) schedule(dynamic)
+    for (i = 0; i < nrl; ++i) {
+        const int tn      = omp_get_thread_num();
+        int64_t *drl      = dr + tn * drw;
+        len_t *mil        = tmpi + tn * (ncl + 1);
+        cf32_t *mcl       = tmpc + tn * (ncl + 1);
+        const hm_t * const ds   = mat->tr[i] + OFFSET;
+        const cf32_t * const cf = tbr->cf_32[mat->tr[i][COEFFS]];
+        const len_t len   = mat->tr[i][LENGTH];
+        len_t sc          = ncl;
+        len_t nr          = 0;
+        memset(drl, 0, (unsigned long)ncl * sizeof(int64_t));
+        for (j = 0; j < len; ++j) {
+            if (ds[j] < ncl) {
+                drl[ds[j]]  = (int64_t)cf[j];
+                sc  = ds[j] < sc ? ds[j] : sc;
+            } else {
+                nr++;
+            }
+        }
+        if (nr > 0) {
+            de[i] = (uint64_t *)malloc((unsigned long)nr * sizeof(uint64_t));
+            for (j = 0, k = 0; j < len; ++j) {
+                if (ds[j] >= ncl) {
+                    de[i][k++] = ((uint64_t)(ds[j]-ncl) << 32) | cf[j];
+                }
+            }
+            qsort(de[i], (size_t)nr, sizeof(uint64_t), fl_cmp_entries);
+        }
+        nde[i]  = nr;
+        k = 0;
+        for (j = sc; j < ncl; ++j) {
+            if (drl[j] == 0) {
+                continue;
+            }
+            drl[j] = drl[j] % mod;
+            if (drl[j] == 0) {
+                continue;
+            }
+            const int64_t mul = drl[j];
+            /* upper row with lead term in column j */
+            const len_t p     = pr[j];
+            mil[k]    = p;
+            mcl[k++]  = (cf32_t)mul;
+            for (int64_t l = aof[p]; l < aof[p+1]; ++l) {
+                drl[acol[l]]  -=  mul * acf[l];
+                drl[acol[l]]  +=  (drl[acol[l]] >> 63) & mod2;
+            }
+            drl[j] = 0;
+        }
+        if (k > 0) {
+            mpi[i]  = (len_t *)malloc((unsigned long)k * sizeof(len_t));
+            mcf[i]  = (cf32_t *)malloc((unsigned long)k * sizeof(cf32_t));
+            memcpy(mpi[i], mil, (unsigned long)k * sizeof(len_t));
+            memcpy(mcf[i], mcl, (unsigned long)k * sizeof(cf32_t));
+        }
+        nmul[i] = k;
+    }
+    free(tmpi);
+    free(tmpc);
+    free(aof);
+    free(acol);
+    free(acf);
+
+    /* sparse rows of the updated D part */
+    hm_t **dcol = (hm_t **)calloc((unsigned long)nrl, sizeof(hm_t *));
+    len_t *nd   = (len_t *)calloc((unsigned long)nrl, sizeof(len_t));
+    len_t *sd   = (len_t *)calloc((unsigned long)nrl, sizeof(len_t));
+
+    /* D := D - C B, tile by tile */
+    for (t = 0; t < ntl; ++t) {
+        const len_t cw  = (t+1)*tw < ncr ? tw : ncr - t*tw;
+        const int64_t * const of = bof + t*(nru+1);
+#pragma omp parallel for num_threads(nthrds) \
+        private(i, j, k) schedule(dynamic)
+        for (i = 0; i < nrl; ++i) {
+            const uint64_t lim = (uint64_t)(t*tw+cw) << 32;
+            if (nmul[i] == 0 && (cde[i] == nde[i] || de[i][cde[i]] >= lim)) {
+                continue;
+            }
+            int64_t *acc  = dr + omp_get_thread_num() * drw;
+            memset(acc, 0, (unsigned long)cw * sizeof(int64_t));
+            while (cde[i] < nde[i] && de[i][cde[i]] < lim) {
+                acc[(de[i][cde[i]] >> 32) - t*tw] = (int64_t)(de[i][cde[i]] & 0xFFFFFFFF);
+                cde[i]++;
+            }
+            for (j = 0; j < nmul[i]; ++j) {
+                const int64_t mul = (int64_t)mcf[i][j];
+                const len_t p     = mpi[i][j];
+                for (int64_t l = of[p]; l < of[p+1]; ++l) {
+                    acc[bcol[l]]  -=  mul * bcf[l];
+                    acc[bcol[l]]  +=  (acc[bcol[l]] >> 63) & mod2;
+                }
+            }
+            for (k = 0; k < cw; ++k) {
+                if (acc[k] != 0) {
+                    acc[k]  = acc[k] % mod;
+                    if (acc[k] != 0) {
+                        if (nd[i] == sd[i]) {
+                            sd[i] = 2 * sd[i] + 16;
+                            dcol[i] = realloc(dcol[i],
+                                    (unsigned long)sd[i] * sizeof(hm_t));
+                            dcf[i]  = realloc(dcf[i],
+                                    (unsigned long)sd[i] * sizeof(cf32_t));
+                        }
+                        dcol[i][nd[i]]  = ncl + t*tw + k;
+                        dcf[i][nd[i]++] = (cf32_t)acc[k];
+                    }
+                }
+            }
+        }
+    }
+
+    /* the reduced rows only have entries in D, zero rows are removed */
+    len_t nrd = 0;
+    for (i = 0; i < nrl; ++i) {
+        hm_t *row   = mat->tr[i];
+        cf32_t *cf  = dcf[i];
+        dcf[i]      = NULL;
+        if (nd[i] > 0) {
+            hm_t *nrow    = (hm_t *)malloc(
+                    (unsigned long)(nd[i]+OFFSET) * sizeof(hm_t));
+            nrow[DEG]     = row[DEG];
+            nrow[BINDEX]  = row[BINDEX];
+            nrow[MULT]    = row[MULT];
+            nrow[COEFFS]  = nrd;
+            nrow[PRELOOP] = nd[i] % UNROLL;
+            nrow[LENGTH]  = nd[i];
+            memcpy(nrow+OFFSET, dcol[i], (unsigned long)nd[i] * sizeof(hm_t));
+            dcf[nrd]      = cf;
+            mat->tr[nrd++] = nrow;
+        } else {
+            free(cf);
+        }
+        free(row);
+        free(dcol[i]);
+        free(mpi[i]);
+        free(mcf[i]);
+        free(de[i]);
+    }
+    mat->nru  = 0;
+    mat->nrl  = nrd;
+
+    free(dcol);
+    free(nd);
+    free(sd);
+    free(mpi);
+    free(mcf);
+    free(nmul);
+    free(de);
+    free(nde);
+    free(cde);
+    free(dr);
+    free(bof);
+    free(bcol);
+    free(bcf);
+}
+
+static void exact_sparse_block_linear_algebra_ff_32(
+        mat_t *mat,
+        const bs_t * const tbr,
+        const bs_t * const bs,
+        md_t *st
+        )
+{
+    /* tracing and normal forms need the generic row by row reduction */
+    if (st->trace_level != NO_TRACER || st->nf > 0
+            || st->in_final_reduction_step == 1) {
+        exact_sparse_linear_algebra_ff_32(mat, tbr, bs, st);
+        return;
+    }
+    /* the triangular solve needs a pivot for each left column */
+    len_t *pr = fl_map_columns_to_pivots(mat);
+    if (pr == NULL) {
+        exact_sparse_linear_algebra_ff_32(mat, tbr, bs, st);
+        return;
+    }
+    /* timings */
+    double ct0, ct1, rt0, rt1;
+    ct0 = cputime();
+    rt0 = realtime();
+
+    const len_t nrl = mat->nrl;
+
+    mat->cf_32  = realloc(mat->cf_32,
+            (unsigned long)mat->nr * sizeof(cf32_t *));
+
+    /* coefficients of the rows of the updated D part */
+    cf32_t **dcf  = (cf32_t **)calloc((unsigned long)nrl, sizeof(cf32_t *));
+    fl_reduce_lower_by_upper_rows_ff_32(mat, tbr, bs, pr, dcf, st);
+    free(pr);
+
+    /* echelonize D, its rows are reduced by new pivots only */
+    bs_t *dbs   = (bs_t *)calloc(1, sizeof(bs_t));
+    dbs->cf_32  = dcf;
+    exact_sparse_reduced_echelon_form_ff_32(mat, dbs, bs, st);
+    for (len_t i = 0; i < nrl; ++i) {
+        free(dcf[i]);
+    }
+    free(dcf);
+    free(dbs);
+
+    /* timings */
+    ct1 = cputime();
+    rt1 = realtime();
+    st->la_ctime  +=  ct1 - ct0;
+    st->la_rtime  +=  rt1 - rt0;
+
+    st->num_zerored += (nrl - mat->np);
+    if (st->info_level > 1) {
+        printf("%9d new %7d zero", mat->np, nrl - mat->np);
+        fflush(stdout);
+    }
+}
+
 static void copy_kernel_to_matrix(
         mat_t *mat,
         bs_t *kernel,
@@ -4123,7 +4594,7 @@ static void exact_sparse_dense_linear_algebra_ff_32(
     dm  = sparse_AB_CD_linear_algebra_ff_32(mat, bs, st);
     if (mat->np > 0) {
         dm  = exact_dense_linear_algebra_ff_32(dm, mat, st);
-        dm  = interreduce_dense_matrix_ff_32(dm, ncr, st->fc);
+        dm  = interreduce_dense_matrix_ff_32(dm, ncr, st);
     }
 
     /* convert dense matrix back to sparse matrix representation,
@@ -4173,7 +4644,7 @@ static void probabilistic_sparse_dense_linear_algebra_ff_32_2(
     dm  = sparse_AB_CD_linear_algebra_ff_32(mat, bs, st);
     if (mat->np > 0) {
         dm  = probabilistic_dense_linear_algebra_ff_32(dm, mat, st);
-        dm  = interreduce_dense_matrix_ff_32(dm, mat->ncr, st->fc);
+        dm  = interreduce_dense_matrix_ff_32(dm, mat->ncr, st);
     }
 
     /* convert dense matrix back to sparse matrix representation,
@@ -4222,7 +4693,7 @@ static void probabilistic_sparse_dense_linear_algebra_ff_32(
     cf32_t **dm = NULL;
     mat->np = 0;
     dm      = probabilistic_sparse_dense_echelon_form_ff_32(mat, bs, st);
-    dm      = interreduce_dense_matrix_ff_32(dm, mat->ncr, st->fc);
+    dm      = interreduce_dense_matrix_ff_32(dm, mat->ncr, st);
 
     /* convert dense matrix back to sparse matrix representation,
      * use tmpcf for storing the coefficient arrays */
@@ -4309,7 +4780,7 @@ static void interreduce_matrix_rows_ff_32(
             free(pivs[l]);
             pivs[l] = NULL;
             pivs[l] = mat->tr[k--] =
-                reduce_dense_row_by_known_pivots_sparse_ff_32(
+                st->fp.reduce_dense_row_by_known_pivots_sparse_ff_32(
                         dr, mat, bs, pivs, sc, l, mh, bi, 0,  st);
         }
     }
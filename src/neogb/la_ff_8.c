@@ -21,7 +21,7 @@
 #include "data.h"
 
 /* That's also enough if AVX512 is avaialable on the system */
-#if defined HAVE_AVX2
+#if defined HAVE_AVX2 || defined SIMD_DISPATCH
 #include <immintrin.h>
 #elif defined __aarch64__
 #include <arm_neon.h>
@@ -93,6 +93,481 @@ static inline cf8_t *normalize_sparse_matrix_row_ff_8(
     return row;
 }
 
+static inline void add_multiple_of_row_ff_8_scalar(
+        int64_t *dr,
+        const hm_t * const dts,
+        const cf8_t * const cfs,
+        const uint32_t mul
+        )
+{
+    len_t j;
+    const len_t os  = dts[PRELOOP];
+    const len_t len = dts[LENGTH];
+    const hm_t * const ds  = dts + OFFSET;
+    for (j = 0; j < os; ++j) {
+        dr[ds[j]] +=  mul * cfs[j];
+    }
+    for (; j < len; j += UNROLL) {
+        dr[ds[j]]   +=  mul * cfs[j];
+        dr[ds[j+1]] +=  mul * cfs[j+1];
+        dr[ds[j+2]] +=  mul * cfs[j+2];
+        dr[ds[j+3]] +=  mul * cfs[j+3];
+    }
+}
+
+/* dense version: dr[j] += mul * red[j] for 0 <= j < len */
+static inline void add_multiple_of_dense_row_ff_8_scalar(
+        int64_t *dr,
+        const cf8_t * const red,
+        const len_t len,
+        const uint32_t mul
+        )
+{
+    len_t j;
+    const len_t os  = len % UNROLL;
+    for (j = 0; j < os; ++j) {
+        dr[j] +=  mul * red[j];
+    }
+    for (; j < len; j += UNROLL) {
+        dr[j]   +=  mul * red[j];
+        dr[j+1] +=  mul * red[j+1];
+        dr[j+2] +=  mul * red[j+2];
+        dr[j+3] +=  mul * red[j+3];
+    }
+}
+
+#if defined SIMD_DISPATCH
+TARGET_AVX2 static void add_multiple_of_row_ff_8_avx2(
+        int64_t *dr,
+        const hm_t * const dts,
+        const cf8_t * const cfs,
+        const uint32_t mul
+        )
+{
+    len_t j;
+    __m256i mask1 = _mm256_set1_epi64x(0x000000000000FFFF);
+    __m256i mask2 = _mm256_set1_epi64x(0x00000000FFFF0000);
+    __m256i mask3 = _mm256_set1_epi64x(0x0000FFFF00000000);
+    __m256i mask4 = _mm256_set1_epi64x(0xFFFF000000000000);
+    __m256i mask8 = _mm256_set1_epi16(0x00FF);
+    int64_t res[4] __attribute__((aligned(32)));
+    __m256i redv, mulv, prod, drv, resv;
+    const uint16_t mul8 = (uint16_t)mul;
+    mulv  = _mm256_set1_epi16(mul8);
+    const len_t len = dts[LENGTH];
+    const len_t os  = len % 32;
+    const hm_t * const ds  = dts + OFFSET;
+    for (j = 0; j < os; ++j) {
+        dr[ds[j]]  +=  mul * cfs[j];
+    }
+    for (; j < len; j += 32) {
+        redv  = _mm256_loadu_si256((__m256i*)(cfs+j));
+        /* first 16 mult-adds -- lower */
+        prod = _mm256_mullo_epi16(mulv,_mm256_and_si256(redv, mask8));
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j]],
+            dr[ds[j+8]],
+            dr[ds[j+16]],
+            dr[ds[j+24]]);
+        resv  = _mm256_add_epi64(drv, _mm256_and_si256(prod, mask1));
+        _mm256_store_si256((__m256i*)(res),resv);
+        dr[ds[j]]    = res[0];
+        dr[ds[j+8]]  = res[1];
+        dr[ds[j+16]] = res[2];
+        dr[ds[j+24]] = res[3];
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j+2]],
+            dr[ds[j+10]],
+            dr[ds[j+18]],
+            dr[ds[j+26]]);
+        resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask2), 16));
+        _mm256_store_si256((__m256i*)(res),resv);
+        dr[ds[j+2]]  = res[0];
+        dr[ds[j+10]] = res[1];
+        dr[ds[j+18]] = res[2];
+        dr[ds[j+26]] = res[3];
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j+4]],
+            dr[ds[j+12]],
+            dr[ds[j+20]],
+            dr[ds[j+28]]);
+        resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask3), 32));
+        _mm256_store_si256((__m256i*)(res),resv);
+        dr[ds[j+4]]  = res[0];
+        dr[ds[j+12]] = res[1];
+        dr[ds[j+20]] = res[2];
+        dr[ds[j+28]] = res[3];
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j+6]],
+            dr[ds[j+14]],
+            dr[ds[j+22]],
+            dr[ds[j+30]]);
+        resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask4), 48));
+        _mm256_store_si256((__m256i*)(res),resv);
+        dr[ds[j+6]]  = res[0];
+        dr[ds[j+14]] = res[1];
+        dr[ds[j+22]] = res[2];
+        dr[ds[j+30]] = res[3];
+        /* second 16 mult-adds -- higher */
+        prod = _mm256_mullo_epi16(mulv, _mm256_srli_epi16(redv, 8));
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j+1]],
+            dr[ds[j+9]],
+            dr[ds[j+17]],
+            dr[ds[j+25]]);
+        resv  = _mm256_add_epi64(drv, _mm256_and_si256(prod, mask1));
+        _mm256_store_si256((__m256i*)(res),resv);
+        dr[ds[j+1]]  = res[0];
+        dr[ds[j+9]]  = res[1];
+        dr[ds[j+17]] = res[2];
+        dr[ds[j+25]] = res[3];
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j+3]],
+            dr[ds[j+11]],
+            dr[ds[j+19]],
+            dr[ds[j+27]]);
+        resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask2), 16));
+        _mm256_store_si256((__m256i*)(res),resv);
+        dr[ds[j+3]]  = res[0];
+        dr[ds[j+11]] = res[1];
+        dr[ds[j+19]] = res[2];
+        dr[ds[j+27]] = res[3];
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j+5]],
+            dr[ds[j+13]],
+            dr[ds[j+21]],
+            dr[ds[j+29]]);
+        resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask3), 32));
+        _mm256_store_si256((__m256i*)(res),resv);
+        dr[ds[j+5]]  = res[0];
+        dr[ds[j+13]] = res[1];
+        dr[ds[j+21]] = res[2];
+        dr[ds[j+29]] = res[3];
+        drv   = _mm256_setr_epi64x(
+            dr[ds[j+7]],
+            dr[ds[j+15]],
+            dr[ds[j+23]],
+            dr[ds[j+31]]);
+        resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask4), 48));
+        _mm256_store_si256((__m256i*)(res),resv);
+        dr[ds[j+7]]  = res[0];
+        dr[ds[j+15]] = res[1];
+        dr[ds[j+23]] = res[2];
+        dr[ds[j+31]] = res[3];
+    }
+}
+
+TARGET_AVX512 static void add_multiple_of_row_ff_8_avx512(
+        int64_t *dr,
+        const hm_t * const dts,
+        const cf8_t * const cfs,
+        const uint32_t mul
+        )
+{
+    len_t j;
+    __m512i mask1 = _mm512_set1_epi64(0x000000000000FFFF);
+    __m512i mask2 = _mm512_set1_epi64(0x00000000FFFF0000);
+    __m512i mask3 = _mm512_set1_epi64(0x0000FFFF00000000);
+    __m512i mask4 = _mm512_set1_epi64(0xFFFF000000000000);
+    __m512i mask8 = _mm512_set1_epi16(0x00FF);
+    int64_t res[8] __attribute__((aligned(64)));
+    __m512i redv, mulv, prod, drv, resv;
+    const uint16_t mul8 = (uint16_t)mul;
+    mulv  = _mm512_set1_epi16(mul8);
+    const len_t len = dts[LENGTH];
+    const len_t os  = len % 64;
+    const hm_t * const ds  = dts + OFFSET;
+    for (j = 0; j < os; ++j) {
+        dr[ds[j]]  +=  mul * cfs[j];
+    }
+    for (; j < len; j += 64) {
+        redv  = _mm512_loadu_si512((__m512i*)(cfs+j));
+        /* first 16 mult-adds -- lower */
+        prod = _mm512_mullo_epi16(mulv,_mm512_and_si512(redv, mask8));
+        drv   = _mm512_setr_epi64(
+            dr[ds[j]],
+            dr[ds[j+8]],
+            dr[ds[j+16]],
+            dr[ds[j+24]],
+            dr[ds[j+32]],
+            dr[ds[j+40]],
+            dr[ds[j+48]],
+            dr[ds[j+56]]);
+        resv  = _mm512_add_epi64(drv, _mm512_and_si512(prod, mask1));
+        _mm512_store_si512((__m512i*)(res),resv);
+        dr[ds[j]]    = res[0];
+        dr[ds[j+8]]  = res[1];
+        dr[ds[j+16]] = res[2];
+        dr[ds[j+24]] = res[3];
+        dr[ds[j+32]] = res[4];
+        dr[ds[j+40]] = res[5];
+        dr[ds[j+48]] = res[6];
+        dr[ds[j+56]] = res[7];
+        drv   = _mm512_setr_epi64(
+            dr[ds[j+2]],
+            dr[ds[j+10]],
+            dr[ds[j+18]],
+            dr[ds[j+26]],
+            dr[ds[j+34]],
+            dr[ds[j+42]],
+            dr[ds[j+50]],
+            dr[ds[j+58]]);
+        resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask2), 16));
+        _mm512_store_si512((__m512i*)(res),resv);
+        dr[ds[j+2]]  = res[0];
+        dr[ds[j+10]] = res[1];
+        dr[ds[j+18]] = res[2];
+        dr[ds[j+26]] = res[3];
+        dr[ds[j+34]] = res[4];
+        dr[ds[j+42]] = res[5];
+        dr[ds[j+50]] = res[6];
+        dr[ds[j+58]] = res[7];
+        drv   = _mm512_setr_epi64(
+            dr[ds[j+4]],
+            dr[ds[j+12]],
+            dr[ds[j+20]],
+            dr[ds[j+28]],
+            dr[ds[j+36]],
+            dr[ds[j+44]],
+            dr[ds[j+52]],
+            dr[ds[j+60]]);
+        resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask3), 32));
+        _mm512_store_si512((__m512i*)(res),resv);
+        dr[ds[j+4]]  = res[0];
+        dr[ds[j+12]] = res[1];
+        dr[ds[j+20]] = res[2];
+        dr[ds[j+28]] = res[3];
+        dr[ds[j+36]] = res[4];
+        dr[ds[j+44]] = res[5];
+        dr[ds[j+52]] = res[6];
+        dr[ds[j+60]] = res[7];
+        drv   = _mm512_setr_epi64(
+            dr[ds[j+6]],
+            dr[ds[j+14]],
+            dr[ds[j+22]],
+            dr[ds[j+30]],
+            dr[ds[j+38]],
+            dr[ds[j+46]],
+            dr[ds[j+54]],
+            dr[ds[j+62]]);
+        resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask4), 48));
+        _mm512_store_si512((__m512i*)(res),resv);
+        dr[ds[j+6]]  = res[0];
+        dr[ds[j+14]] = res[1];
+        dr[ds[j+22]] = res[2];
+        dr[ds[j+30]] = res[3];
+        dr[ds[j+38]] = res[4];
+        dr[ds[j+46]] = res[5];
+        dr[ds[j+54]] = res[6];
+        dr[ds[j+62]] = res[7];
+        /* second 16 mult-adds -- higher */
+        prod = _mm512_mullo_epi16(mulv, _mm512_srli_epi16(redv, 8));
+        drv   = _mm512_setr_epi64(
+            dr[ds[j+1]],
+            dr[ds[j+9]],
+            dr[ds[j+17]],
+            dr[ds[j+25]],
+            dr[ds[j+33]],
+            dr[ds[j+41]],
+            dr[ds[j+49]],
+            dr[ds[j+57]]);
+        resv  = _mm512_add_epi64(drv, _mm512_and_si512(prod, mask1));
+        _mm512_store_si512((__m512i*)(res),resv);
+        dr[ds[j+1]]  = res[0];
+        dr[ds[j+9]]  = res[1];
+        dr[ds[j+17]] = res[2];
+        dr[ds[j+25]] = res[3];
+        dr[ds[j+33]] = res[4];
+        dr[ds[j+41]] = res[5];
+        dr[ds[j+49]] = res[6];
+        dr[ds[j+57]] = res[7];
+        drv   = _mm512_setr_epi64(
+            dr[ds[j+3]],
+            dr[ds[j+11]],
+            dr[ds[j+19]],
+            dr[ds[j+27]],
+            dr[ds[j+35]],
+            dr[ds[j+43]],
+            dr[ds[j+51]],
+            dr[ds[j+59]]);
+        resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask2), 16));
+        _mm512_store_si512((__m512i*)(res),resv);
+        dr[ds[j+3]]  = res[0];
+        dr[ds[j+11]] = res[1];
+        dr[ds[j+19]] = res[2];
+        dr[ds[j+27]] = res[3];
+        dr[ds[j+35]] = res[4];
+        dr[ds[j+43]] = res[5];
+        dr[ds[j+51]] = res[6];
+        dr[ds[j+59]] = res[7];
+        drv   = _mm512_setr_epi64(
+            dr[ds[j+5]],
+            dr[ds[j+13]],
+            dr[ds[j+21]],
+            dr[ds[j+29]],
+            dr[ds[j+37]],
+            dr[ds[j+45]],
+            dr[ds[j+53]],
+            dr[ds[j+61]]);
+        resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask3), 32));
+        _mm512_store_si512((__m512i*)(res),resv);
+        dr[ds[j+5]]  = res[0];
+        dr[ds[j+13]] = res[1];
+        dr[ds[j+21]] = res[2];
+        dr[ds[j+29]] = res[3];
+        dr[ds[j+37]] = res[4];
+        dr[ds[j+45]] = res[5];
+        dr[ds[j+53]] = res[6];
+        dr[ds[j+61]] = res[7];
+        drv   = _mm512_setr_epi64(
+            dr[ds[j+7]],
+            dr[ds[j+15]],
+            dr[ds[j+23]],
+            dr[ds[j+31]],
+            dr[ds[j+39]],
+            dr[ds[j+47]],
+            dr[ds[j+55]],
+            dr[ds[j+63]]);
+        resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask4), 48));
+        _mm512_store_si512((__m512i*)(res),resv);
+        dr[ds[j+7]]  = res[0];
+        dr[ds[j+15]] = res[1];
+        dr[ds[j+23]] = res[2];
+        dr[ds[j+31]] = res[3];
+        dr[ds[j+39]] = res[4];
+        dr[ds[j+47]] = res[5];
+        dr[ds[j+55]] = res[6];
+        dr[ds[j+63]] = res[7];
+    }
+}
+
+/* the products of 8 bit coefficients by an 8 bit multiplier fit into 16 bit
+ * lanes, they are only widened for the 64 bit additions */
+TARGET_AVX2 static void add_multiple_of_dense_row_ff_8_avx2(
+        int64_t *dr,
+        const cf8_t * const red,
+        const len_t len,
+        const uint32_t mul
+        )
+{
+    len_t j;
+    __m128i prodl, prodh;
+    __m256i prod, drv;
+    const __m256i mulv  = _mm256_set1_epi16((uint16_t)mul);
+    const len_t os      = len % 16;
+    for (j = 0; j < os; ++j) {
+        dr[j] +=  mul * red[j];
+    }
+    for (; j < len; j += 16) {
+        prod  = _mm256_mullo_epi16(mulv,
+                _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(red+j))));
+        prodl = _mm256_castsi256_si128(prod);
+        prodh = _mm256_extracti128_si256(prod, 1);
+        drv   = _mm256_loadu_si256((__m256i*)(dr+j));
+        drv   = _mm256_add_epi64(drv, _mm256_cvtepu16_epi64(prodl));
+        _mm256_storeu_si256((__m256i*)(dr+j), drv);
+        drv   = _mm256_loadu_si256((__m256i*)(dr+j+4));
+        drv   = _mm256_add_epi64(drv,
+                _mm256_cvtepu16_epi64(_mm_srli_si128(prodl, 8)));
+        _mm256_storeu_si256((__m256i*)(dr+j+4), drv);
+        drv   = _mm256_loadu_si256((__m256i*)(dr+j+8));
+        drv   = _mm256_add_epi64(drv, _mm256_cvtepu16_epi64(prodh));
+        _mm256_storeu_si256((__m256i*)(dr+j+8), drv);
+        drv   = _mm256_loadu_si256((__m256i*)(dr+j+12));
+        drv   = _mm256_add_epi64(drv,
+                _mm256_cvtepu16_epi64(_mm_srli_si128(prodh, 8)));
+        _mm256_storeu_si256((__m256i*)(dr+j+12), drv);
+    }
+}
+
+TARGET_AVX512 static void add_multiple_of_dense_row_ff_8_avx512(
+        int64_t *dr,
+        const cf8_t * const red,
+        const len_t len,
+        const uint32_t mul
+        )
+{
+    len_t j;
+    __m512i prod, drv;
+    const __m512i mulv  = _mm512_set1_epi16((uint16_t)mul);
+    const len_t os      = len % 32;
+    for (j = 0; j < os; ++j) {
+        dr[j] +=  mul * red[j];
+    }
+    for (; j < len; j += 32) {
+        prod  = _mm512_mullo_epi16(mulv,
+                _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(red+j))));
+        drv   = _mm512_loadu_si512((__m512i*)(dr+j));
+        drv   = _mm512_add_epi64(drv,
+                _mm512_cvtepu16_epi64(_mm512_extracti32x4_epi32(prod, 0)));
+        _mm512_storeu_si512((__m512i*)(dr+j), drv);
+        drv   = _mm512_loadu_si512((__m512i*)(dr+j+8));
+        drv   = _mm512_add_epi64(drv,
+                _mm512_cvtepu16_epi64(_mm512_extracti32x4_epi32(prod, 1)));
+        _mm512_storeu_si512((__m512i*)(dr+j+8), drv);
+        drv   = _mm512_loadu_si512((__m512i*)(dr+j+16));
+        drv   = _mm512_add_epi64(drv,
+                _mm512_cvtepu16_epi64(_mm512_extracti32x4_epi32(prod, 2)));
+        _mm512_storeu_si512((__m512i*)(dr+j+16), drv);
+        drv   = _mm512_loadu_si512((__m512i*)(dr+j+24));
+        drv   = _mm512_add_epi64(drv,
+                _mm512_cvtepu16_epi64(_mm512_extracti32x4_epi32(prod, 3)));
+        _mm512_storeu_si512((__m512i*)(dr+j+24), drv);
+    }
+}
+#endif
+
+/* dr += mul * row, for the sparse row dts with coefficients cfs, using the
+ * kernels of the SIMD extension simd (see simd_level()) */
+static inline void add_multiple_of_row_ff_8(
+        int64_t *dr,
+        const hm_t * const dts,
+        const cf8_t * const cfs,
+        const uint32_t mul,
+        const int simd
+        )
+{
+#if defined SIMD_DISPATCH
+    switch (simd) {
+        case SIMD_AVX512:
+            add_multiple_of_row_ff_8_avx512(dr, dts, cfs, mul);
+            break;
+        case SIMD_AVX2:
+            add_multiple_of_row_ff_8_avx2(dr, dts, cfs, mul);
+            break;
+        default:
+            add_multiple_of_row_ff_8_scalar(dr, dts, cfs, mul);
+    }
+#else
+    add_multiple_of_row_ff_8_scalar(dr, dts, cfs, mul);
+#endif
+}
+
+/* dr[j] += mul * red[j] for 0 <= j < len, dense version of the above */
+static inline void add_multiple_of_dense_row_ff_8(
+        int64_t *dr,
+        const cf8_t * const red,
+        const len_t len,
+        const uint32_t mul,
+        const int simd
+        )
+{
+#if defined SIMD_DISPATCH
+    switch (simd) {
+        case SIMD_AVX512:
+            add_multiple_of_dense_row_ff_8_avx512(dr, red, len, mul);
+            break;
+        case SIMD_AVX2:
+            add_multiple_of_dense_row_ff_8_avx2(dr, red, len, mul);
+            break;
+        default:
+            add_multiple_of_dense_row_ff_8_scalar(dr, red, len, mul);
+    }
+#else
+    add_multiple_of_dense_row_ff_8_scalar(dr, red, len, mul);
+#endif
+}
+
 static hm_t *reduce_dense_row_by_known_pivots_sparse_ff_8(
         int64_t *dr,
         mat_t *mat,
@@ -121,28 +596,14 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_ff_8(
     } else {
         rba = NULL;
     }
-#if defined HAVE_AVX512_F
-    __m512i mask1 = _mm512_set1_epi64(0x000000000000FFFF);
-    __m512i mask2 = _mm512_set1_epi64(0x00000000FFFF0000);
-    __m512i mask3 = _mm512_set1_epi64(0x0000FFFF00000000);
-    __m512i mask4 = _mm512_set1_epi64(0xFFFF000000000000);
-    __m512i mask8 = _mm512_set1_epi16(0x00FF);
-    int64_t res[8] __attribute__((aligned(64)));
-    __m512i redv, mulv, prod, drv, resv;
-#elif defined HAVE_AVX2
-    __m256i mask1 = _mm256_set1_epi64x(0x000000000000FFFF);
-    __m256i mask2 = _mm256_set1_epi64x(0x00000000FFFF0000);
-    __m256i mask3 = _mm256_set1_epi64x(0x0000FFFF00000000);
-    __m256i mask4 = _mm256_set1_epi64x(0xFFFF000000000000);
-    __m256i mask8 = _mm256_set1_epi16(0x00FF);
-    int64_t res[4] __attribute__((aligned(32)));
-    __m256i redv, mulv, prod, drv, resv;
-#elif defined __aarch64__
+#if defined __aarch64__
     uint64_t tmp[2] __attribute__((aligned(32)));
     uint16x8_t prodv;
     uint32x4_t prodvl, prodvh;
     uint8x16_t redv;
     uint64x2_t drv, resv;
+#else
+    const int simd = simd_level();
 #endif
 
     k = 0;
@@ -170,279 +631,7 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_ff_8(
             }
         }
         cfs   = mcf[dts[COEFFS]];
-#if defined HAVE_AVX512_F
-        const uint16_t mul8 = (uint16_t)(fc - dr[i]);
-        mulv  = _mm512_set1_epi16(mul8);
-        const len_t len = dts[LENGTH];
-        const len_t os  = len % 64;
-        const hm_t * const ds  = dts + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]]  +=  mul * cfs[j];
-        }
-        for (; j < len; j += 64) {
-            redv  = _mm512_loadu_si512((__m512i*)(cfs+j));
-            /* first 16 mult-adds -- lower */
-            prod = _mm512_mullo_epi16(mulv,_mm512_and_si512(redv, mask8));
-            drv   = _mm512_setr_epi64(
-                dr[ds[j]],
-                dr[ds[j+8]],
-                dr[ds[j+16]],
-                dr[ds[j+24]],
-                dr[ds[j+32]],
-                dr[ds[j+40]],
-                dr[ds[j+48]],
-                dr[ds[j+56]]);
-            resv  = _mm512_add_epi64(drv, _mm512_and_si512(prod, mask1));
-            _mm512_store_si512((__m512i*)(res),resv);
-            dr[ds[j]]    = res[0];
-            dr[ds[j+8]]  = res[1];
-            dr[ds[j+16]] = res[2];
-            dr[ds[j+24]] = res[3];
-            dr[ds[j+32]] = res[4];
-            dr[ds[j+40]] = res[5];
-            dr[ds[j+48]] = res[6];
-            dr[ds[j+56]] = res[7];
-            drv   = _mm512_setr_epi64(
-                dr[ds[j+2]],
-                dr[ds[j+10]],
-                dr[ds[j+18]],
-                dr[ds[j+26]],
-                dr[ds[j+34]],
-                dr[ds[j+42]],
-                dr[ds[j+50]],
-                dr[ds[j+58]]);
-            resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask2), 16));
-            _mm512_store_si512((__m512i*)(res),resv);
-            dr[ds[j+2]]  = res[0];
-            dr[ds[j+10]] = res[1];
-            dr[ds[j+18]] = res[2];
-            dr[ds[j+26]] = res[3];
-            dr[ds[j+34]] = res[4];
-            dr[ds[j+42]] = res[5];
-            dr[ds[j+50]] = res[6];
-            dr[ds[j+58]] = res[7];
-            drv   = _mm512_setr_epi64(
-                dr[ds[j+4]],
-                dr[ds[j+12]],
-                dr[ds[j+20]],
-                dr[ds[j+28]],
-                dr[ds[j+36]],
-                dr[ds[j+44]],
-                dr[ds[j+52]],
-                dr[ds[j+60]]);
-            resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask3), 32));
-            _mm512_store_si512((__m512i*)(res),resv);
-            dr[ds[j+4]]  = res[0];
-            dr[ds[j+12]] = res[1];
-            dr[ds[j+20]] = res[2];
-            dr[ds[j+28]] = res[3];
-            dr[ds[j+36]] = res[4];
-            dr[ds[j+44]] = res[5];
-            dr[ds[j+52]] = res[6];
-            dr[ds[j+60]] = res[7];
-            drv   = _mm512_setr_epi64(
-                dr[ds[j+6]],
-                dr[ds[j+14]],
-                dr[ds[j+22]],
-                dr[ds[j+30]],
-                dr[ds[j+38]],
-                dr[ds[j+46]],
-                dr[ds[j+54]],
-                dr[ds[j+62]]);
-            resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask4), 48));
-            _mm512_store_si512((__m512i*)(res),resv);
-            dr[ds[j+6]]  = res[0];
-            dr[ds[j+14]] = res[1];
-            dr[ds[j+22]] = res[2];
-            dr[ds[j+30]] = res[3];
-            dr[ds[j+38]] = res[4];
-            dr[ds[j+46]] = res[5];
-            dr[ds[j+54]] = res[6];
-            dr[ds[j+62]] = res[7];
-            /* second 16 mult-adds -- higher */
-            prod = _mm512_mullo_epi16(mulv, _mm512_srli_epi16(redv, 8));
-            drv   = _mm512_setr_epi64(
-                dr[ds[j+1]],
-                dr[ds[j+9]],
-                dr[ds[j+17]],
-                dr[ds[j+25]],
-                dr[ds[j+33]],
-                dr[ds[j+41]],
-                dr[ds[j+49]],
-                dr[ds[j+57]]);
-            resv  = _mm512_add_epi64(drv, _mm512_and_si512(prod, mask1));
-            _mm512_store_si512((__m512i*)(res),resv);
-            dr[ds[j+1]]  = res[0];
-            dr[ds[j+9]]  = res[1];
-            dr[ds[j+17]] = res[2];
-            dr[ds[j+25]] = res[3];
-            dr[ds[j+33]] = res[4];
-            dr[ds[j+41]] = res[5];
-            dr[ds[j+49]] = res[6];
-            dr[ds[j+57]] = res[7];
-            drv   = _mm512_setr_epi64(
-                dr[ds[j+3]],
-                dr[ds[j+11]],
-                dr[ds[j+19]],
-                dr[ds[j+27]],
-                dr[ds[j+35]],
-                dr[ds[j+43]],
-                dr[ds[j+51]],
-                dr[ds[j+59]]);
-            resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask2), 16));
-            _mm512_store_si512((__m512i*)(res),resv);
-            dr[ds[j+3]]  = res[0];
-            dr[ds[j+11]] = res[1];
-            dr[ds[j+19]] = res[2];
-            dr[ds[j+27]] = res[3];
-            dr[ds[j+35]] = res[4];
-            dr[ds[j+43]] = res[5];
-            dr[ds[j+51]] = res[6];
-            dr[ds[j+59]] = res[7];
-            drv   = _mm512_setr_epi64(
-                dr[ds[j+5]],
-                dr[ds[j+13]],
-                dr[ds[j+21]],
-                dr[ds[j+29]],
-                dr[ds[j+37]],
-                dr[ds[j+45]],
-                dr[ds[j+53]],
-                dr[ds[j+61]]);
-            resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask3), 32));
-            _mm512_store_si512((__m512i*)(res),resv);
-            dr[ds[j+5]]  = res[0];
-            dr[ds[j+13]] = res[1];
-            dr[ds[j+21]] = res[2];
-            dr[ds[j+29]] = res[3];
-            dr[ds[j+37]] = res[4];
-            dr[ds[j+45]] = res[5];
-            dr[ds[j+53]] = res[6];
-            dr[ds[j+61]] = res[7];
-            drv   = _mm512_setr_epi64(
-                dr[ds[j+7]],
-                dr[ds[j+15]],
-                dr[ds[j+23]],
-                dr[ds[j+31]],
-                dr[ds[j+39]],
-                dr[ds[j+47]],
-                dr[ds[j+55]],
-                dr[ds[j+63]]);
-            resv  = _mm512_add_epi64(drv, _mm512_srli_epi64(_mm512_and_si512(prod, mask4), 48));
-            _mm512_store_si512((__m512i*)(res),resv);
-            dr[ds[j+7]]  = res[0];
-            dr[ds[j+15]] = res[1];
-            dr[ds[j+23]] = res[2];
-            dr[ds[j+31]] = res[3];
-            dr[ds[j+39]] = res[4];
-            dr[ds[j+47]] = res[5];
-            dr[ds[j+55]] = res[6];
-            dr[ds[j+63]] = res[7];
-        }
-#elif defined HAVE_AVX2
-        const uint16_t mul8 = (uint16_t)(fc - dr[i]);
-        mulv  = _mm256_set1_epi16(mul8);
-        const len_t len = dts[LENGTH];
-        const len_t os  = len % 32;
-        const hm_t * const ds  = dts + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]]  +=  mul * cfs[j];
-        }
-        for (; j < len; j += 32) {
-            redv  = _mm256_loadu_si256((__m256i*)(cfs+j));
-            /* first 16 mult-adds -- lower */
-            prod = _mm256_mullo_epi16(mulv,_mm256_and_si256(redv, mask8));
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j]],
-                dr[ds[j+8]],
-                dr[ds[j+16]],
-                dr[ds[j+24]]);
-            resv  = _mm256_add_epi64(drv, _mm256_and_si256(prod, mask1));
-            _mm256_store_si256((__m256i*)(res),resv);
-            dr[ds[j]]    = res[0];
-            dr[ds[j+8]]  = res[1];
-            dr[ds[j+16]] = res[2];
-            dr[ds[j+24]] = res[3];
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+2]],
-                dr[ds[j+10]],
-                dr[ds[j+18]],
-                dr[ds[j+26]]);
-            resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask2), 16));
-            _mm256_store_si256((__m256i*)(res),resv);
-            dr[ds[j+2]]  = res[0];
-            dr[ds[j+10]] = res[1];
-            dr[ds[j+18]] = res[2];
-            dr[ds[j+26]] = res[3];
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+4]],
-                dr[ds[j+12]],
-                dr[ds[j+20]],
-                dr[ds[j+28]]);
-            resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask3), 32));
-            _mm256_store_si256((__m256i*)(res),resv);
-            dr[ds[j+4]]  = res[0];
-            dr[ds[j+12]] = res[1];
-            dr[ds[j+20]] = res[2];
-            dr[ds[j+28]] = res[3];
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+6]],
-                dr[ds[j+14]],
-                dr[ds[j+22]],
-                dr[ds[j+30]]);
-            resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask4), 48));
-            _mm256_store_si256((__m256i*)(res),resv);
-            dr[ds[j+6]]  = res[0];
-            dr[ds[j+14]] = res[1];
-            dr[ds[j+22]] = res[2];
-            dr[ds[j+30]] = res[3];
-            /* second 16 mult-adds -- higher */
-            prod = _mm256_mullo_epi16(mulv, _mm256_srli_epi16(redv, 8));
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+1]],
-                dr[ds[j+9]],
-                dr[ds[j+17]],
-                dr[ds[j+25]]);
-            resv  = _mm256_add_epi64(drv, _mm256_and_si256(prod, mask1));
-            _mm256_store_si256((__m256i*)(res),resv);
-            dr[ds[j+1]]  = res[0];
-            dr[ds[j+9]]  = res[1];
-            dr[ds[j+17]] = res[2];
-            dr[ds[j+25]] = res[3];
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+3]],
-                dr[ds[j+11]],
-                dr[ds[j+19]],
-                dr[ds[j+27]]);
-            resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask2), 16));
-            _mm256_store_si256((__m256i*)(res),resv);
-            dr[ds[j+3]]  = res[0];
-            dr[ds[j+11]] = res[1];
-            dr[ds[j+19]] = res[2];
-            dr[ds[j+27]] = res[3];
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+5]],
-                dr[ds[j+13]],
-                dr[ds[j+21]],
-                dr[ds[j+29]]);
-            resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask3), 32));
-            _mm256_store_si256((__m256i*)(res),resv);
-            dr[ds[j+5]]  = res[0];
-            dr[ds[j+13]] = res[1];
-            dr[ds[j+21]] = res[2];
-            dr[ds[j+29]] = res[3];
-            drv   = _mm256_setr_epi64x(
-                dr[ds[j+7]],
-                dr[ds[j+15]],
-                dr[ds[j+23]],
-                dr[ds[j+31]]);
-            resv  = _mm256_add_epi64(drv, _mm256_srli_epi64(_mm256_and_si256(prod, mask4), 48));
-            _mm256_store_si256((__m256i*)(res),resv);
-            dr[ds[j+7]]  = res[0];
-            dr[ds[j+15]] = res[1];
-            dr[ds[j+23]] = res[2];
-            dr[ds[j+31]] = res[3];
-        }
-#elif defined __aarch64__
+#if defined __aarch64__
         const len_t len       = dts[LENGTH];
         const len_t os        = len % 16;
         const hm_t * const ds = dts + OFFSET;
@@ -519,18 +708,7 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_ff_8(
             dr[ds[j+15]] = (int64_t)tmp[1];
         }
 #else
-        const len_t os  = dts[PRELOOP];
-        const len_t len = dts[LENGTH];
-        const hm_t * const ds  = dts + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] +=  mul * cfs[j];
-        }
-        for (; j < len; j += UNROLL) {
-            dr[ds[j]]   +=  mul * cfs[j];
-            dr[ds[j+1]] +=  mul * cfs[j+1];
-            dr[ds[j+2]] +=  mul * cfs[j+2];
-            dr[ds[j+3]] +=  mul * cfs[j+3];
-        }
+        add_multiple_of_row_ff_8(dr, dts, cfs, mul, simd);
 #endif
         dr[i] = 0;
     }
@@ -559,6 +737,108 @@ static hm_t *reduce_dense_row_by_known_pivots_sparse_ff_8(
     return row;
 }
 
+/* Reduces the given row by the known pivots using a sparse accumulator:
+ * dr is zero on input and on output, only the columns stored in the heap
+ * hp are visited. Columns of the reduced row are collected at the end of
+ * hp, they are different from the ones still in the heap. */
+static hm_t *reduce_sparse_row_by_known_pivots_ff_8(
+        int64_t *dr,
+        hm_t *hp,
+        uint64_t *bm,
+        const hm_t * const row, /* row to be reduced */
+        const cf8_t * const rcf,
+        mat_t *mat,
+        hm_t * const * const pivs,
+        const hm_t tmp_pos, /* position of new coeffs array in tmpcf */
+        const len_t mh,     /* multiplier hash for tracing */
+        const len_t bi,     /* basis index of generating element */
+        const len_t tr,     /* trace data? */
+        const uint32_t fc
+        )
+{
+    hi_t i;
+    len_t j, k = 0, nh = 0;
+    hm_t *dts;
+    cf8_t *cfs;
+    const int64_t mod           = (int64_t)fc;
+    const len_t ncols           = mat->nc;
+    const len_t ncl             = mat->ncl;
+    cf8_t * const * const mcf  = mat->cf_8;
+    hm_t * const rc             = hp + ncols - 1;
+
+    rba_t *rba;
+    if (tr > 0) {
+        rba = mat->rba[tmp_pos];
+    } else {
+        rba = NULL;
+    }
+
+    const len_t rlen  = row[LENGTH];
+    const hm_t * const rds  = row + OFFSET;
+    for (j = 0; j < rlen; ++j) {
+        dr[rds[j]]  = (int64_t)rcf[j];
+        spa_insert(hp, &nh, bm, rds[j]);
+    }
+
+    while (nh > 0) {
+        i = spa_extract_min(hp, &nh, bm);
+        if (dr[i] != 0) {
+            dr[i] = dr[i] % mod;
+        }
+        if (dr[i] == 0) {
+            continue;
+        }
+        if (pivs[i] == NULL) {
+            *(rc-k) = i;
+            k++;
+            continue;
+        }
+        /* found reducer row, get multiplier */
+        const uint32_t mul = (uint32_t)(fc - dr[i]);
+        dts   = pivs[i];
+        if (i < ncl) {
+            /* set corresponding bit of reducer in reducer bit array */
+            if (tr > 0) {
+                rba[i/32] |= 1U << (i % 32);
+            }
+        }
+        cfs   = mcf[dts[COEFFS]];
+        const len_t len = dts[LENGTH];
+        const hm_t * const ds  = dts + OFFSET;
+        /* the first entry is the pivot itself */
+        for (j = 1; j < len; ++j) {
+            spa_insert(hp, &nh, bm, ds[j]);
+            dr[ds[j]] +=  mul * cfs[j];
+        }
+        dr[i] = 0;
+    }
+    if (k == 0) {
+        return NULL;
+    }
+
+    hm_t *nrow  = (hm_t *)malloc((unsigned long)(k+OFFSET) * sizeof(hm_t));
+    cf8_t *cf  = (cf8_t *)malloc((unsigned long)(k) * sizeof(cf8_t));
+    hm_t *rs    = nrow + OFFSET;
+    len_t l     = 0;
+    for (j = 0; j < k; ++j) {
+        i = *(rc-j);
+        if (i >= ncl) {
+            rs[l] = (hm_t)i;
+            cf[l] = (cf8_t)dr[i];
+            l++;
+        }
+        dr[i] = 0;
+    }
+    nrow[BINDEX]  = bi;
+    nrow[MULT]    = mh;
+    nrow[COEFFS]  = tmp_pos;
+    nrow[PRELOOP] = l % UNROLL;
+    nrow[LENGTH]  = l;
+    mat->cf_8[tmp_pos]  = cf;
+
+    return nrow;
+}
+
 static hm_t *trace_reduce_dense_row_by_known_pivots_sparse_ff_8(
         rba_t *rba,
         int64_t *dr,
@@ -655,7 +935,8 @@ static cf8_t *reduce_dense_row_by_all_pivots_ff_8(
         const uint32_t fc
         )
 {
-    hi_t i, j, k, l;
+    hi_t i, k;
+    const int simd    = simd_level();
     const int64_t mod = (int64_t)fc;
     len_t np  = -1;
     cf8_t *red;
@@ -678,18 +959,7 @@ static cf8_t *reduce_dense_row_by_all_pivots_ff_8(
         /* found reducer row, get multiplier */
         const uint32_t mul= (uint32_t)(fc - dr[i]);
         const cf8_t *cfs = bs->cf_8[pivs[i][COEFFS]];
-        const len_t os    = pivs[i][PRELOOP];
-        const len_t len   = pivs[i][LENGTH];
-        const hm_t * const ds  = pivs[i] + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] +=  mul * cfs[j];
-        }
-        for (; j < len; j += UNROLL) {
-            dr[ds[j]]   +=  mul * cfs[j];
-            dr[ds[j+1]] +=  mul * cfs[j+1];
-            dr[ds[j+2]] +=  mul * cfs[j+2];
-            dr[ds[j+3]] +=  mul * cfs[j+3];
-        }
+        add_multiple_of_row_ff_8(dr, pivs[i], cfs, mul, simd);
         dr[i] = 0;
     }
     k = 0;
@@ -711,16 +981,7 @@ static cf8_t *reduce_dense_row_by_all_pivots_ff_8(
 
         red = dpivs[i-ncl];
         const uint32_t mul= (uint32_t)(fc - dr[i]);
-        const len_t os    = (ncols - i) % UNROLL;
-        for (l = 0, j = i; l < os; ++l, ++j) {
-            dr[j] +=  mul * red[l];
-        }
-        for (; j < ncols; l += UNROLL, j += UNROLL) {
-            dr[j]   +=  mul * red[l];
-            dr[j+1] +=  mul * red[l+1];
-            dr[j+2] +=  mul * red[l+2];
-            dr[j+3] +=  mul * red[l+3];
-        }
+        add_multiple_of_dense_row_ff_8(dr+i, red, ncols-i, mul, simd);
     }
     if (k == 0) {
         *pc = -1;
@@ -752,6 +1013,7 @@ static cf8_t *reduce_dense_row_by_old_pivots_ff_8(
         )
 {
     hi_t i, j;
+    const int simd    = simd_level();
     const int64_t mod = (int64_t)fc;
     const len_t ncols = mat->nc;
     const len_t ncl   = mat->ncl;
@@ -771,18 +1033,7 @@ static cf8_t *reduce_dense_row_by_old_pivots_ff_8(
         /* found reducer row, get multiplier */
         const uint32_t mul= (uint32_t)(fc - dr[i]);
         const cf8_t *cfs  = bs->cf_8[pivs[i][COEFFS]];
-        const len_t os    = pivs[i][PRELOOP];
-        const len_t len   = pivs[i][LENGTH];
-        const hm_t * const ds = pivs[i] + OFFSET;
-        for (j = 0; j < os; ++j) {
-            dr[ds[j]] +=  mul * cfs[j];
-        }
-        for (; j < len; j += UNROLL) {
-            dr[ds[j]]   +=  mul * cfs[j];
-            dr[ds[j+1]] +=  mul * cfs[j+1];
-            dr[ds[j+2]] +=  mul * cfs[j+2];
-            dr[ds[j+3]] +=  mul * cfs[j+3];
-        }
+        add_multiple_of_row_ff_8(dr, pivs[i], cfs, mul, simd);
         dr[i] = 0;
     }
 
@@ -814,8 +1065,9 @@ static cf8_t *reduce_dense_row_by_dense_new_pivots_ff_8(
         const uint32_t fc
         )
 {
-    hi_t i, j, k, l;
+    hi_t i, k;
     len_t np  = -1;
+    const int simd    = simd_level();
     const int64_t mod = (int64_t)fc;
 
     for (k = 0, i = *pc; i < ncr; ++i) {
@@ -834,16 +1086,7 @@ static cf8_t *reduce_dense_row_by_dense_new_pivots_ff_8(
         }
 
         const uint32_t mul= (uint32_t)(fc - dr[i]);
-        const len_t os    = (ncr - i) % UNROLL;
-        for (l = 0, j = i; l < os; ++l, ++j) {
-            dr[j] +=  mul * pivs[i][l];
-        }
-        for (; j < ncr; l += UNROLL, j += UNROLL) {
-            dr[j]   +=  mul * pivs[i][l];
-            dr[j+1] +=  mul * pivs[i][l+1];
-            dr[j+2] +=  mul * pivs[i][l+2];
-            dr[j+3] +=  mul * pivs[i][l+3];
-        }
+        add_multiple_of_dense_row_ff_8(dr+i, pivs[i], ncr-i, mul, simd);
     }
     if (k == 0) {
         *pc = -1;
@@ -926,7 +1169,7 @@ static void probabilistic_sparse_reduced_echelon_form_ff_8(
 
                 /* fill random value array */
                 for (j = 0; j < nrbl; ++j) {
-                    mull[j] = (int64_t)rand() % fc;
+                    mull[j] = (int64_t)random_number() % fc;
                 }
                 /* generate one dense row as random linear combination
                  * of the rows of the block */
@@ -1353,8 +1596,21 @@ static void exact_sparse_reduced_echelon_form_ff_8(
     /* unkown pivot rows we have to reduce with the known pivots first */
     hm_t **upivs  = mat->tr;
 
-    int64_t *dr  = (int64_t *)malloc(
-            (unsigned long)(nthrds * ncols) * sizeof(int64_t));
+    /* very sparse matrices are reduced via sparse accumulators */
+    const int spa = use_sparse_accumulator(mat, st);
+
+    int64_t *dr  = NULL;
+    hm_t *hp     = NULL;
+    uint64_t *bm = NULL;
+    const len_t nbm = ncols / 64 + 1;
+    if (spa == 1) {
+        dr  = (int64_t *)calloc((unsigned long)nthrds * ncols, sizeof(int64_t));
+        hp  = (hm_t *)malloc((unsigned long)nthrds * ncols * sizeof(hm_t));
+        bm  = (uint64_t *)calloc((unsigned long)nthrds * nbm, sizeof(uint64_t));
+    } else {
+        dr  = (int64_t *)malloc(
+                (unsigned long)(nthrds * ncols) * sizeof(int64_t));
+    }
     /* mo need to have any sharing dependencies on parallel computation,
      * no data to be synchronized at this step of the linear algebra */
 #pragma omp parallel for num_threads(nthrds) \
@@ -1370,26 +1626,43 @@ static void exact_sparse_reduced_echelon_form_ff_8(
             const len_t bi  = npiv[BINDEX];
             const len_t mh  = npiv[MULT];
             const hm_t * const ds = npiv + OFFSET;
+            /* coefficients of the previous reduction result */
+            cf8_t *pcf    = NULL;
             k = 0;
-            memset(drl, 0, (unsigned long)ncols * sizeof(int64_t));
-            for (j = 0; j < os; ++j) {
-                drl[ds[j]]  = (int64_t)cfs[j];
-            }
-            for (; j < len; j += UNROLL) {
-                drl[ds[j]]    = (int64_t)cfs[j];
-                drl[ds[j+1]]  = (int64_t)cfs[j+1];
-                drl[ds[j+2]]  = (int64_t)cfs[j+2];
-                drl[ds[j+3]]  = (int64_t)cfs[j+3];
+            if (spa == 0) {
+                memset(drl, 0, (unsigned long)ncols * sizeof(int64_t));
+                for (j = 0; j < os; ++j) {
+                    drl[ds[j]]  = (int64_t)cfs[j];
+                }
+                for (; j < len; j += UNROLL) {
+                    drl[ds[j]]    = (int64_t)cfs[j];
+                    drl[ds[j+1]]  = (int64_t)cfs[j+1];
+                    drl[ds[j+2]]  = (int64_t)cfs[j+2];
+                    drl[ds[j+3]]  = (int64_t)cfs[j+3];
+                }
+                cfs = NULL;
             }
-            cfs = NULL;
             do {
-                /* If we do normal form computations the first monomial in the polynomial might not
-                be a known pivot, thus setting it to npiv[OFFSET] can lead to wrong results. */
-                sc  = st->nf == 0 ? npiv[OFFSET] : 0;
-                free(npiv);
-                free(cfs);
-                npiv  = mat->tr[i] = reduce_dense_row_by_known_pivots_sparse_ff_8(
-                        drl, mat, bs, pivs, sc, i, mh, bi, st->trace_level == LEARN_TRACER, st->fc);
+                if (spa == 1) {
+                    /* the accumulator is empty after each reduction, so
+                     * the row is loaded again for each try */
+                    hm_t *row = reduce_sparse_row_by_known_pivots_ff_8(
+                            drl, hp + (omp_get_thread_num() * ncols),
+                            bm + (omp_get_thread_num() * nbm), npiv, cfs,
+                            mat, pivs, i, mh, bi,
+                            st->trace_level == LEARN_TRACER, st->fc);
+                    free(npiv);
+                    free(pcf);
+                    npiv  = mat->tr[i] = row;
+                } else {
+                    /* If we do normal form computations the first monomial in the polynomial might not
+                    be a known pivot, thus setting it to npiv[OFFSET] can lead to wrong results. */
+                    sc  = st->nf == 0 ? npiv[OFFSET] : 0;
+                    free(npiv);
+                    free(cfs);
+                    npiv  = mat->tr[i] = reduce_dense_row_by_known_pivots_sparse_ff_8(
+                            drl, mat, bs, pivs, sc, i, mh, bi, st->trace_level == LEARN_TRACER, st->fc);
+                }
                 if (st->nf > 0) {
                     if (!npiv) {
                         mat->tr[i]  = NULL;
@@ -1414,7 +1687,7 @@ static void exact_sparse_reduced_echelon_form_ff_8(
                                 mat->cf_8[npiv[COEFFS]], npiv[PRELOOP], npiv[LENGTH], st->fc);
                     }
                     k   = __sync_bool_compare_and_swap(&pivs[npiv[OFFSET]], NULL, npiv);
-                    cfs = mat->cf_8[npiv[COEFFS]];
+                    cfs = pcf = mat->cf_8[npiv[COEFFS]];
                 }
             } while (!k);
         }
@@ -1425,6 +1698,8 @@ static void exact_sparse_reduced_echelon_form_ff_8(
             free(pivs[i]);
             pivs[i] = NULL;
         }
+        free(hp);
+        free(bm);
         mat->np = 0;
         if (st->info_level > 0) {
             fprintf(stderr, "Zero reduction while applying tracer, bad prime.\n");
@@ -1454,7 +1729,17 @@ static void exact_sparse_reduced_echelon_form_ff_8(
         hm_t cf_array_pos;
         for (i = 0; i < ncr; ++i) {
             k = ncols-1-i;
-            if (pivs[k]) {
+            if (pivs[k] && spa == 1) {
+                hm_t *row = pivs[k];
+                cfs       = mat->cf_8[row[COEFFS]];
+                pivs[k]   = NULL;
+                pivs[k]   = mat->tr[npivs++] =
+                    reduce_sparse_row_by_known_pivots_ff_8(
+                            dr, hp, bm, row, cfs, mat, pivs, row[COEFFS],
+                            row[MULT], row[BINDEX], 0, st->fc);
+                free(row);
+                free(cfs);
+            } else if (pivs[k]) {
                 memset(dr, 0, (unsigned long)ncols * sizeof(int64_t));
                 cfs = mat->cf_8[pivs[k][COEFFS]];
                 cf_array_pos    = pivs[k][COEFFS];
@@ -1490,6 +1775,8 @@ static void exact_sparse_reduced_echelon_form_ff_8(
     pivs  = NULL;
     free(dr);
     dr  = NULL;
+    free(hp);
+    free(bm);
 }
 
 static cf8_t **sparse_AB_CD_linear_algebra_ff_8(
@@ -1803,7 +2090,7 @@ static cf8_t **probabilistic_dense_linear_algebra_ff_8(
 
                 /* fill random value array */
                 for (j = 0; j < nrbl; ++j) {
-                    mull[j] = (int64_t)rand() % fc;
+                    mull[j] = (int64_t)random_number() % fc;
                 }
                 /* generate one dense row as random linear combination
                  * of the rows of the block */
@@ -1935,7 +2222,7 @@ static cf8_t **probabilistic_sparse_dense_echelon_form_ff_8(
 
                 /* fill random value array */
                 for (j = 0; j < nrbl; ++j) {
-                    mull[j] = (int64_t)rand() % fc;
+                    mull[j] = (int64_t)random_number() % fc;
                 }
                 /* generate one dense row as random linear combination
                  * of the rows of the block */
@@ -33,17 +33,6 @@ md_t *copy_meta_data(
     md->application_nr_add  = 0;
     md->application_nr_red  = 0;
 
-    if (md->fc < (int32_t)(1) << 8) {
-        md->ff_bits = 8;
-    } else {
-        if (md->fc < (int32_t)(1) << 16) {
-            md->ff_bits = 16;
-        } else {
-            if (md->fc < (int32_t)(1) << 31) {
-                md->ff_bits = 32;
-            }
-        }
-    }
     set_ff_bits(md, md->fc);
     return md;
 }
@@ -126,7 +115,7 @@ void print_initial_statistics(
             fprintf(file, "monomial order           DONT KNOW\n");
         }
         if (st->reset_ht == 2147483647) {
-            fprintf(file, "basis hash table resetting     OFF\n");
+            fprintf(file, "basis hash table resetting    AUTO\n");
         } else {
             fprintf(file, "basis hash table resetting  %6d\n", st->reset_ht);
         }
@@ -138,8 +127,21 @@ void print_initial_statistics(
         } else {
             fprintf(file, "max pair selection     %11d\n", st->mnsel);
         }
+        if (st->mem_budget <= 0) {
+            fprintf(file, "matrix memory budget           OFF\n");
+        } else {
+            fprintf(file, "matrix memory budget %10.2f MB\n",
+                    (double)st->mem_budget / 1048576.0);
+        }
+        if (st->ooc_dir == NULL) {
+            fprintf(file, "out-of-core storage            OFF\n");
+        } else {
+            fprintf(file, "out-of-core storage %15s\n", st->ooc_dir);
+        }
         fprintf(file, "reduce gb              %11d\n", st->reduce_gb);
         fprintf(file, "#threads               %11d\n", st->nthrds);
+        fprintf(file, "SIMD kernels           %11s\n",
+                simd_level_name(simd_level()));
         fprintf(file, "info level             %11d\n", st->info_level);
         fprintf(file, "generate pbm files     %11d\n", st->gen_pbm_file);
         fprintf(file, "------------------------------------------\n");
@@ -317,7 +319,7 @@ void get_and_print_final_statistics(
                     (double)100*(double)st->reduce_gb_rtime
                     / (double)(st->f4_rtime));
         }
-        if (st->reset_ht != 2147483647) {
+        if (st->num_rht > 0) {
             fprintf(file, "rht          %15.2f sec %5.1f%%\n",
                     st->rht_rtime,
                     (double)100*(double)st->rht_rtime
@@ -338,6 +340,9 @@ void get_and_print_final_statistics(
                 (int32_t)(ceil(log((double)st->max_sht_size)/log(2))));
         fprintf(file, "max. basis hash table size     2^%d\n",
                 (int32_t)(ceil(log((double)st->max_bht_size)/log(2))));
+        fprintf(file, "#memory budget splits    %10lu\n", (unsigned long)st->num_mem_splits);
+        fprintf(file, "peak memory        %13.2f MB\n",
+                (double)st->peak_mem / 1048576.0);
         fprintf(file, "-----------------------------------------\n\n");
     }
 }
@@ -58,6 +58,14 @@ trace_t *initialize_trace(
     tr->rsz = 8;
     tr->rld = 0;
     tr->rd  = calloc((unsigned long)tr->rsz, sizeof(len_t));
+    /* out-of-core storage of f4 rounds */
+    if (md->ooc_dir != NULL) {
+        tr->oc  = initialize_out_of_core_storage(md->ooc_dir);
+        if (tr->oc == NULL && md->info_level > 0) {
+            fprintf(stderr, "Cannot create trace file in %s, ", md->ooc_dir);
+            fprintf(stderr, "keeping the trace in memory.\n");
+        }
+    }
 
     return tr;
 }
@@ -76,14 +84,22 @@ void free_trace(
             /* free(tr->ts[i].lmh); */
         }
         for (i = 0; i < tr->ltd; ++i) {
-            free(tr->td[i].tri);
-            free(tr->td[i].rri);
-            for (j = 0; j < tr->td[i].tld/2; ++j) {
-                free(tr->td[i].rba[j]);
+            /* spilled rounds only own the rba pointers,
+             * the data itself lives in tr->map */
+            if (tr->td[i].len == 0) {
+                free(tr->td[i].tri);
+                free(tr->td[i].rri);
+                for (j = 0; j < tr->td[i].tld/2; ++j) {
+                    free(tr->td[i].rba[j]);
+                }
             }
             free(tr->td[i].rba);
             free(tr->td[i].nlms);
         }
+        if (tr->map != NULL) {
+            munmap(tr->map, (size_t)tr->msz);
+        }
+        free_out_of_core_storage(&(tr->oc));
         free(tr->lm);
         free(tr->lmh);
         free(tr->lmps);
@@ -155,7 +171,7 @@ void reduce_basis_no_hash_table_switching(
     /* sort rows */
     sort_matrix_rows_decreasing(mat->rr, mat->nru);
     /* do the linear algebra reduction and free basis data */
-    interreduce_matrix_rows(mat, bs, st, 1);
+    st->fp.interreduce_matrix_rows(mat, bs, st, 1);
     /* remap rows to basis elements (keeping their position in bs) */
     convert_sparse_matrix_rows_to_basis_elements(
         1, mat, bs, bht, sht, st);
@@ -219,20 +235,21 @@ bs_t *f4_trace_application_phase(
      * in each call when generating matrices for linear algebra */
     hi_t *hcm = (hi_t *)malloc(sizeof(hi_t));
 
-    /* set routines corresponding to prime size */
-    reset_trace_function_pointers(fc);
-
     /* matrix holding sparse information generated
      * during symbolic preprocessing */
     mat_t *mat  = (mat_t *)calloc(1, sizeof(mat_t));
 
     /* copy global data as input */
     md_t *st  = copy_meta_data(gst, fc);
+
+    /* set routines corresponding to prime size */
+    reset_trace_function_pointers(st, fc);
+
     bs_t *bs    = copy_basis_mod_p(ggb, st);
     ht_t *bht   = lbht;
 
     /* normalize the copied basis */
-    normalize_initial_basis(bs, fc);
+    st->fp.normalize_initial_basis(bs, fc);
 
     /* initialize specialized hash table */
     ht_t *sht = initialize_secondary_hash_table(bht, st);
@@ -270,7 +287,7 @@ bs_t *f4_trace_application_phase(
         }
       convert_hashes_to_columns(mat, st, sht);
       /* linear algebra, depending on choice, see set_function_pointers() */
-      ret = application_linear_algebra(mat, bs, st);
+      ret = st->fp.application_linear_algebra(mat, bs, st);
       if (ret != 0) {
           goto stop;
       }
@@ -404,15 +421,16 @@ bs_t *f4sat_trace_application_test_phase(
     /* hashes-to-columns maps for multipliers in saturation step */
     hi_t *hcmm  = (hi_t *)malloc(sizeof(hi_t));
 
-    /* set routines corresponding to prime size */
-    reset_trace_function_pointers(fc);
-
     /* matrix holding sparse information generated
      * during symbolic preprocessing */
     mat_t *mat  = (mat_t *)calloc(1, sizeof(mat_t));
 
     /* copy global data as input */
     md_t *st  = copy_meta_data(gst, fc);
+
+    /* set routines corresponding to prime size */
+    reset_trace_function_pointers(st, fc);
+
     bs_t *bs    = copy_basis_mod_p(ggb, st);
     bs_t *sat   = copy_basis_mod_p(gsat, st);
     ht_t *bht   = lbht;
@@ -425,7 +443,7 @@ bs_t *f4sat_trace_application_test_phase(
     len_t sat_deg = 0;
 
     /* normalize the copied basis */
-    normalize_initial_basis(bs, fc);
+    st->fp.normalize_initial_basis(bs, fc);
 
     /* initialize specialized hash table */
     ht_t *sht = initialize_secondary_hash_table(bht, st);
@@ -706,7 +724,7 @@ bs_t *f4sat_trace_application_phase(
     st->trace_level = APPLY_TRACER;
 
     /* set routines corresponding to prime size */
-    reset_function_pointers(fc, st->laopt);
+    reset_function_pointers(st, fc, st->laopt);
 
     /* initialize multiplier of first element in sat to be the hash of
      * the all-zeroes exponent vector. */
@@ -717,7 +735,7 @@ bs_t *f4sat_trace_application_phase(
     len_t sat_deg = 0;
 
     /* normalize the copied basis */
-    normalize_initial_basis(bs, fc);
+    st->fp.normalize_initial_basis(bs, fc);
 
     /* initialize specialized hash table */
     ht_t *sht = initialize_secondary_hash_table(bht, st);
@@ -756,7 +774,7 @@ bs_t *f4sat_trace_application_phase(
         } */
         convert_hashes_to_columns(mat, st, sht);
         /* linear algebra, depending on choice, see set_function_pointers() */
-        linear_algebra(mat, bs, bs, st);
+        st->fp.linear_algebra(mat, bs, bs, st);
         if (ret != 0) {
             goto stop;
         }
@@ -936,7 +954,7 @@ bs_t *f4sat_trace_application_phase(
 stop:
     /* free and clean up */
     free(hcmm);
-    free_basis_without_hash_table(&sat);
+    free_basis_and_only_local_hash_table_data(&sat);
     free_basis(&kernel);
     /* note that all rows kept from mat during the overall computation are
      * basis elements and thus we do not need to free the rows itself, but
@@ -945,10 +963,11 @@ stop:
     gst->application_nr_add   = st->application_nr_add;
     gst->application_nr_mult  = st->application_nr_mult;
     gst->application_nr_red   = st->application_nr_red;
-    free(st);
+    free(qb);
+    free_meta_data(&st);
 
     if (ret != 0) {
-        free_basis_without_hash_table(&bs);
+        free_basis_and_only_local_hash_table_data(&bs);
     }
 
     return bs;
@@ -985,17 +1004,18 @@ bs_t *f4_trace_learning_phase(
      * during symbolic preprocessing */
     mat_t *mat  = (mat_t *)calloc(1, sizeof(mat_t));
 
-    /* set routines corresponding to prime size */
-    reset_trace_function_pointers(fc);
-
     ps_t * ps   = initialize_pairset();
     /* copy global data as input */
     md_t *st  = copy_meta_data(gst, fc);
+
+    /* set routines corresponding to prime size */
+    reset_trace_function_pointers(st, fc);
+
     bs_t *bs    = copy_basis_mod_p(ggb, st);
     ht_t *bht   = gbht;
 
     /* normalize the copied basis */
-    normalize_initial_basis(bs, fc);
+    st->fp.normalize_initial_basis(bs, fc);
 
     /* initialize specialized hash tables */
     ht_t *sht = initialize_secondary_hash_table(bht, st);
@@ -1030,7 +1050,7 @@ bs_t *f4_trace_learning_phase(
       sort_matrix_rows_decreasing(mat->rr, mat->nru);
       sort_matrix_rows_increasing(mat->tr, mat->nrl);
       /* linear algebra, depending on choice, see set_function_pointers() */
-      trace_linear_algebra(trace, mat, bs, st);
+      st->fp.trace_linear_algebra(trace, mat, bs, st);
       /* columns indices are mapped back to exponent hashes */
       if (mat->np > 0) {
         convert_sparse_matrix_rows_to_basis_elements(
@@ -1042,6 +1062,7 @@ bs_t *f4_trace_learning_phase(
       if (mat->np > 0) {
           add_lms_to_trace(trace, bs, mat->np);
           trace->ltd++;
+          spill_trace_round(trace, trace->ltd-1);
       }
       /* all rows in mat are now polynomials in the basis,
        * so we do not need the rows anymore */
@@ -1177,12 +1198,13 @@ bs_t *f4sat_trace_learning_phase_1(
      * during symbolic preprocessing */
     mat_t *mat  = (mat_t *)calloc(1, sizeof(mat_t));
 
-    /* set routines corresponding to prime size */
-    reset_trace_function_pointers(fc);
-
     ps_t * ps   = initialize_pairset();
     /* copy global data as input */
     md_t *st    = copy_meta_data(gst, fc);
+
+    /* set routines corresponding to prime size */
+    reset_trace_function_pointers(st, fc);
+
     bs_t *bs    = copy_basis_mod_p(ggb, st);
     bs_t *sat   = copy_basis_mod_p(gsat, st);
     ht_t *bht   = bs->ht;
@@ -1201,7 +1223,7 @@ bs_t *f4sat_trace_learning_phase_1(
     next_deg  = 2*bht->ev[sat->hm[0][OFFSET]][DEG];
 
     /* normalize the copied basis */
-    normalize_initial_basis(bs, fc);
+    st->fp.normalize_initial_basis(bs, fc);
 
     /* initialize specialized hash tables */
     ht_t *sht = initialize_secondary_hash_table(bht, st);
@@ -1510,8 +1532,10 @@ bs_t *f4sat_trace_learning_phase_2(
 
     st->trace_level = LEARN_TRACER;
 
-    /* set routines corresponding to prime size */
-    reset_function_pointers(fc, st->laopt);
+    /* set routines corresponding to prime size, the trace is only
+     * recorded by exact linear algebra, so probabilistic choices
+     * of st->laopt are not used when learning */
+    reset_function_pointers(st, fc, 2);
 
     int ts_ctr  = 0;
     /* hashes-to-columns map, initialized with length 1, is reallocated
@@ -1529,7 +1553,7 @@ bs_t *f4sat_trace_learning_phase_2(
     next_deg  = 2*bht->ev[sat->hm[0][OFFSET]][DEG];
 
     /* normalize the copied basis */
-    normalize_initial_basis(bs, fc);
+    st->fp.normalize_initial_basis(bs, fc);
 
     /* initialize specialized hash tables */
     ht_t *sht = initialize_secondary_hash_table(bht, st);
@@ -1572,7 +1596,7 @@ bs_t *f4sat_trace_learning_phase_2(
         sort_matrix_rows_decreasing(mat->rr, mat->nru);
         sort_matrix_rows_increasing(mat->tr, mat->nrl);
         /* linear algebra, depending on choice, see set_function_pointers() */
-        linear_algebra(mat, bs, bs, st);
+        st->fp.linear_algebra(mat, bs, bs, st);
         /* columns indices are mapped back to exponent hashes */
         if (mat->np > 0) {
             convert_sparse_matrix_rows_to_basis_elements(
@@ -1584,6 +1608,7 @@ bs_t *f4sat_trace_learning_phase_2(
         if (mat->np > 0) {
             add_lms_to_trace(trace, bs, mat->np);
             trace->ltd++;
+            spill_trace_round(trace, trace->ltd-1);
         }
         /* all rows in mat are now polynomials in the basis,
          * so we do not need the rows anymore */
@@ -1881,7 +1906,7 @@ int64_t f4_trace_julia(
 
     /* sort initial elements, smallest lead term first */
     sort_r(bs_qq->hm, (unsigned long)bs_qq->ld, sizeof(hm_t *),
-            initial_input_cmp, bht);
+            st->fp.initial_input_cmp, bht);
     remove_content_of_initial_basis(bs_qq);
 
     /* generate lucky prime numbers */
@@ -1942,9 +1967,6 @@ bs_t *modular_f4(
      * in each call when generating matrices for linear algebra */
     hi_t *hcm = (hi_t *)malloc(sizeof(hi_t));
 
-    /* set routines corresponding to prime size */
-    reset_function_pointers(fc, gst->laopt);
-
     /* matrix holding sparse information generated
      * during symbolic preprocessing */
     mat_t *mat  = (mat_t *)calloc(1, sizeof(mat_t));
@@ -1953,11 +1975,15 @@ bs_t *modular_f4(
 
     /* copy global data as input */
     md_t *st  = copy_meta_data(gst, fc);
+
+    /* set routines corresponding to prime size */
+    reset_function_pointers(st, fc, st->laopt);
+
     bs_t *bs    = copy_basis_mod_p(ggb, st);
     ht_t *bht   = gbht;
 
     /* normalize the copied basis */
-    normalize_initial_basis(bs, fc);
+    st->fp.normalize_initial_basis(bs, fc);
 
     /* initialize specialized hash table */
     ht_t *sht = initialize_secondary_hash_table(bht, st);
@@ -1995,7 +2021,7 @@ bs_t *modular_f4(
         write_pbm_file(mat, st);
       }
       /* linear algebra, depending on choice, see set_function_pointers() */
-      linear_algebra(mat, bs, bs, st);
+      st->fp.linear_algebra(mat, bs, bs, st);
       /* columns indices are mapped back to exponent hashes */
       if (mat->np > 0) {
         convert_sparse_matrix_rows_to_basis_elements(
@@ -79,12 +79,26 @@ bs_t *core_nf(
     md->nf = 1;
     select_tbr(tbr, mul, 0, mat, md, md->ht, bht, NULL);
 
-    symbolic_preprocessing(mat, bs, md);
+    /* the reducers may be known from a learning run, see md->nfr */
+    if (md->nf_trace_level != APPLY_TRACER
+            || generate_nf_reducer_rows_from_trace(mat, bs, md) == 0) {
+        /* find_multiplied_reducer() keeps the tracing information
+         * only when learning a trace, the linear algebra is not traced */
+        const tl_t tl = md->trace_level;
+        if (md->nf_trace_level == LEARN_TRACER) {
+            md->trace_level = LEARN_TRACER;
+        }
+        symbolic_preprocessing(mat, bs, md);
+        md->trace_level = tl;
+        if (md->nf_trace_level == LEARN_TRACER) {
+            record_nf_reducers(mat, bs, md);
+        }
+    }
     convert_hashes_to_columns(mat, md, md->ht);
     sort_matrix_rows_decreasing(mat->rr, mat->nru);
 
     /* linear algebra, depending on choice, see set_function_pointers() */
-    linear_algebra(mat, tbr, bs, md);
+    md->fp.linear_algebra(mat, tbr, bs, md);
     /* columns indices are mapped back to exponent hashes */
     return_normal_forms_to_basis(
             mat, tbr, bht, md->ht, md->hcm, md);
@@ -154,7 +168,9 @@ int64_t export_nf(
             bs_lens, bs_exps, bs_cfs, field_char, mon_order, elim_block_len,
             nr_vars, nr_bs_gens, 0, 17,
             nr_threads, 0, 0, 44, 0,
-            1, 0, info_level);
+            1, 0, info_level, 0 /* default memory budget */,
+            -1 /* default sparse accumulator threshold */,
+            NULL /* in core */);
 
     /* all input generators are invalid */
     if (success == -1) {
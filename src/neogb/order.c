@@ -346,7 +346,7 @@ static int spair_cmp_deglex(
     if (ht->ev[la][DEG] != ht->ev[lb][DEG]) {
         return (ht->ev[la][DEG] < ht->ev[lb][DEG]) ? -1 : 1;
     } else {
-        return (int)monomial_cmp(la, lb, ht);
+        return (int)ht->monomial_cmp(la, lb, ht);
     }
 }
 
@@ -549,7 +549,7 @@ static int spair_cmp_update(
     const spair_t *sb   =   ((spair_t *)b);
     const ht_t *ht      =   (ht_t *)htp;
     if (sa->lcm != sb->lcm) {
-        return (int)monomial_cmp(sa->lcm, sb->lcm, ht);
+        return (int)ht->monomial_cmp(sa->lcm, sb->lcm, ht);
     } else {
         if (sa->deg != sb->deg) {
             return (sa->deg < sb->deg) ? -1 : 1;
@@ -573,7 +573,7 @@ static int spair_cmp_drl(
     const hi_t lb   = ((spair_t *)b)->lcm;
     const ht_t *ht  = (ht_t *)htp;
 
-    int mc = (int)monomial_cmp(la, lb, ht);
+    int mc = (int)ht->monomial_cmp(la, lb, ht);
     if (mc != 0) {
         if (mc < 0)
             return -1;
@@ -843,7 +843,7 @@ static int spair_cmp_be(
         const hi_t lb   = ((spair_t *)b)->lcm;
         const ht_t *ht  = (ht_t *)htp;
 
-        int mc = (int)monomial_cmp(la, lb, ht);
+        int mc = (int)ht->monomial_cmp(la, lb, ht);
         if (mc != 0) {
             if (mc < 0) {
                 return -1;
@@ -903,7 +903,7 @@ static int matrix_row_cmp_by_increasing_signature(
     sig_a   = ((hm_t **)a)[0][SM_SMON];
     sig_b   = ((hm_t **)b)[0][SM_SMON];
 
-    int diff = (int)monomial_cmp(sig_a, sig_b, ht);
+    int diff = (int)ht->monomial_cmp(sig_a, sig_b, ht);
     if (diff != 0) {
         return diff;
     } else {
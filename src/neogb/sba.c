@@ -181,6 +181,36 @@ next_element:
     return ne;
 }
 
+/* returns the maximal degree of the lcms of the lead monomials of all
+ * pairs of basis elements, once all input generators are handled and the
+ * current degree is bigger no new basis elements can come up any more */
+static deg_t max_degree_of_pair_lcms(
+        const bs_t * const bs,
+        const ht_t * const ht
+        )
+{
+    len_t i, j, k;
+    deg_t d, md = 0;
+
+    const len_t evl = ht->evl;
+    const len_t ebl = ht->ebl;
+
+    for (i = 0; i < bs->ld; ++i) {
+        const exp_t * const ei = ht->ev[bs->hm[i][OFFSET]];
+        for (j = i+1; j < bs->ld; ++j) {
+            const exp_t * const ej = ht->ev[bs->hm[j][OFFSET]];
+            d = 0;
+            for (k = 1; k < evl; ++k) {
+                if (k != ebl) {
+                    d += ei[k] < ej[k] ? ej[k] : ei[k];
+                }
+            }
+            md = md < d ? d : md;
+        }
+    }
+    return md;
+}
+
 static int is_signature_needed(
         const smat_t * const smat,
         const crit_t * const syz,
@@ -570,21 +600,15 @@ static void sba_final_reduction_step(
     ht_t *ht  = *htp;
     hi_t *hcm = *hcmp;
 
-    /* prepare basis data to apply final reduction process */
-    for (len_t i = 0; i < bs->ld; ++i) {
-        bs->lm[i]   = ht->hd[bs->hm[i][SM_OFFSET]].sdm;
-        bs->lmps[i] = i;
-    }
-    bs->lml = bs->ld;
-
-    ht_t *sht  = initialize_secondary_hash_table(ht, st);
+    /* reduce_basis() takes the basis hash table from bs and the
+     * symbolic one from st, the basis elements are stored in ht */
+    ht_t *oht  = bs->ht;
+    bs->ht     = ht;
+    st->ht     = initialize_secondary_hash_table(ht, st);
     mat_t *mat = (mat_t *)calloc(1, sizeof(mat_t));
-    /* note: bht will become sht, and sht will become NULL,
-     * thus we need pointers */
     reduce_basis(bs, mat, st);
-    if (sht != NULL) {
-        free_hash_table(&sht);
-    }
+    free_hash_table(&(st->ht));
+    bs->ht = oht;
     free(mat);
     mat = NULL;
 
@@ -657,7 +681,12 @@ int core_sba_schreyer(
     /* signature matrix and previous degree signature matrix */
     smat_t *smat = calloc(1, sizeof(smat_t));
     /* initial degree is the lowest degree of the input generators */
-    smat->cd = in->hm[in->ld-1][DEG];
+    smat->cd = in->hm[0][DEG];
+    for (len_t i = 1; i < in->ld; ++i) {
+        if (in->hm[i][DEG] < smat->cd) {
+            smat->cd = in->hm[i][DEG];
+        }
+    }
 
     /* initialize signature related information */
     initialize_signatures_schreyer(in);
@@ -706,7 +735,7 @@ int core_sba_schreyer(
         sba_convert_hashes_to_columns(&hcm, smat, st, ht);
 
         /* s-reduce matrix and add syzygies when rows s-reduce to zero */
-        sba_linear_algebra(smat, syz, st, ht);
+        st->fp.sba_linear_algebra(smat, syz, st, ht);
 
         /* maps columns to hashes */
         sba_convert_columns_to_hashes(smat, hcm);
@@ -725,10 +754,18 @@ int core_sba_schreyer(
             fflush(stdout);
         }
 
-        /* if we found a constant we are done, if we have added no new elements
-         * we assume we are done*/
-        if (bs->constant  == 1 || smat->nlm == 0) {
+        /* if we found a constant we are done. Otherwise, once all input
+         * generators are handled, we are done if no rows are left for the
+         * next degree or if all pairs of basis elements have lcms of
+         * lower degree. Note that we must not stop just because no new
+         * elements were found in this degree. */
+        if (bs->constant  == 1) {
             try_termination =   1;
+        } else {
+            if (in->ld == 0 && (smat->cld == 0
+                        || max_degree_of_pair_lcms(bs, ht) < smat->cd)) {
+                try_termination =   1;
+            }
         }
         rrt1 = realtime();
         if (st->info_level > 1) {
@@ -742,6 +779,14 @@ int core_sba_schreyer(
         printf("-------------------------------------------------\
 ----------------------------\n");
     }
+    /* prepare lead monomial data as core_f4() does, it is needed for the
+     * final reduction process as well as for exporting the basis */
+    for (len_t i = 0; i < bs->ld; ++i) {
+        bs->lm[i]   = ht->hd[bs->hm[i][OFFSET]].sdm;
+        bs->lmps[i] = i;
+    }
+    bs->lml = bs->ld;
+
     /* fully reduce elements in basis. */
     if (st->reduce_gb == 1) {
         sba_final_reduction_step(bs, &ht, &hcm, st);
@@ -758,9 +803,11 @@ int core_sba_schreyer(
     free_signature_criteria(&rew, st);
     free(hcm);
 
-    printf("size of basis     %7u\n", bs->ld);
-    printf("#syzygy criteria  %7ld\n", (long)st->num_syz_crit);
-    printf("#rewrite criteria %7ld\n", (long)st->num_rew_crit);
+    if (st->info_level > 1) {
+        printf("size of basis     %7u\n", bs->ld);
+        printf("#syzygy criteria  %7ld\n", (long)st->num_syz_crit);
+        printf("#rewrite criteria %7ld\n", (long)st->num_rew_crit);
+    }
 
     return 1;
 }
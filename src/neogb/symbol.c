@@ -58,7 +58,7 @@ static void select_all_spairs(
 
     /* select pairs of this degree respecting maximal selection size mnsel */
     npd  = psl->ld;
-    sort_r(ps, (unsigned long)npd, sizeof(spair_t), spair_cmp, bht);
+    sort_r(ps, (unsigned long)npd, sizeof(spair_t), st->fp.spair_cmp, bht);
     /* now do maximal selection if it applies */
 
     nps = psl->ld;
@@ -195,6 +195,52 @@ static void select_all_spairs(
 by minial degree of the spairs is supported
 
 NOTE: The pair list is already sorted! */
+/* Cuts the selection of pairs at an lcm such that the estimated memory
+ * of the resulting matrix fits into the budget. The remaining pairs of
+ * this degree stay in the pair set and are handled in the next round.
+ * The fill in due to symbolic preprocessing is taken from the last matrix,
+ * rows are counted twice for the input and the reduced rows. The pairs of
+ * the first lcm are always selected. */
+static len_t limit_selection_by_memory_budget(
+        const spair_t * const ps,
+        const len_t nps,
+        const bs_t * const bs,
+        md_t *md
+        )
+{
+    len_t i, j;
+
+    const int64_t budget  = md->mem_budget;
+    if (budget <= 0) {
+        return nps;
+    }
+    /* bytes per term: column index and coefficient */
+    const double tb   = (double)sizeof(hm_t) + (md->ff_bits > 0 ?
+            md->ff_bits / 8 : sizeof(mpz_t));
+    const double fill = md->mat_fill > 1.0 ? md->mat_fill : 1.0;
+
+    double mem  = 0.0;
+    i = 0;
+    while (i < nps) {
+        const hi_t lcm  = ps[i].lcm;
+        double nt = 0.0;
+        for (j = i; j < nps && ps[j].lcm == lcm; ++j) {
+            nt  +=  bs->hm[ps[j].gen1][LENGTH] + bs->hm[ps[j].gen2][LENGTH]
+                + 2 * OFFSET;
+        }
+        const double lmem = 2.0 * fill * nt * tb;
+        if (i > 0 && mem + lmem > (double)budget) {
+            break;
+        }
+        mem +=  lmem;
+        i   =   j;
+    }
+    if (i < nps) {
+        md->num_mem_splits++;
+    }
+    return i;
+}
+
 static int32_t select_spairs_by_minimal_degree(
         mat_t *mat,
         bs_t *bs,
@@ -221,7 +267,7 @@ static int32_t select_spairs_by_minimal_degree(
     const len_t evl = bht->evl;
 
     /* sort pair set */
-    sort_r(ps, (unsigned long)psl->ld, sizeof(spair_t), spair_cmp, bht);
+    sort_r(ps, (unsigned long)psl->ld, sizeof(spair_t), md->fp.spair_cmp, bht);
     /* get minimal degree */
     mdeg  = ps[0].deg;
 
@@ -272,6 +318,8 @@ static int32_t select_spairs_by_minimal_degree(
     } else {
         nps = npd;
     }
+    /* split the degree step if the matrix exceeds the memory budget */
+    nps = limit_selection_by_memory_budget(ps, nps, bs, md);
     if (md->info_level > 1) {
         printf("%3d  %6d %7d", mdeg, nps, psl->ld);
         fflush(stdout);
@@ -288,6 +336,7 @@ static int32_t select_spairs_by_minimal_degree(
     mat->sz = 2 * nps;
     mat->nc = mat->ncl = mat->ncr = 0;
     mat->nr = 0;
+    md->sel_nnz = 0;
 
     i = 0;
 
@@ -303,6 +352,8 @@ static int32_t select_spairs_by_minimal_degree(
             gens[load++] = ps[j].gen2;
             ++j;
         }
+        /* redundant generators may be stored out of core */
+        load_spilled_basis_elements(bs, gens, load, md);
         /* sort gens set */
         qsort(gens, (unsigned long)load, sizeof(len_t), gens_cmp);
 
@@ -323,6 +374,7 @@ static int32_t select_spairs_by_minimal_degree(
         /* note that we use index mat->nc and not mat->nr since for each new
          * lcm we add exactly one row to mat->rr */
         rrows[nrr]  = multiplied_poly_to_matrix_row(sht, bht, h, etmp, b);
+        md->sel_nnz +=  b[LENGTH];
         /* track trace information ? */
         if (md->trace_level == LEARN_TRACER) { 
            rrows[nrr][BINDEX]  = prev;
@@ -358,6 +410,7 @@ static int32_t select_spairs_by_minimal_degree(
             }
             const hi_t h  = bht->hd[lcm].val - bht->hd[b[OFFSET]].val;
             trows[ntr] = multiplied_poly_to_matrix_row(sht, bht, h, etmp, b);
+            md->sel_nnz +=  b[LENGTH];
             /* track trace information ? */
             if (md->trace_level == LEARN_TRACER) {
                 trows[ntr][BINDEX]  = prev;
@@ -647,6 +700,9 @@ static void generate_matrix_from_trace(
 
     const len_t idx = md->trace_rd;
 
+    /* trace rounds may be stored out of core */
+    prefetch_trace_round(md->tr, idx);
+
     td_t td   = md->tr->td[idx];
     ht_t *bht = bs->ht;
     ht_t *sht = md->ht;
@@ -702,6 +758,90 @@ static void generate_matrix_from_trace(
     print_current_trace_meta_data(md);
 }
 
+/* stores basis index, leading monomial and multiplier of the reducer rows
+ * of the normal form matrix in md->nfr, the rows have been generated by
+ * find_multiplied_reducer() with tracing information */
+static void record_nf_reducers(
+        const mat_t * const mat,
+        const bs_t * const bs,
+        md_t *md
+        )
+{
+    len_t i;
+
+    const len_t nru = mat->nru;
+
+    md->nfr   = (hi_t *)malloc((unsigned long)(3 * nru + 1) * sizeof(hi_t));
+    md->nfrl  = nru;
+    for (i = 0; i < nru; ++i) {
+        const hm_t * const row  = mat->rr[i];
+        md->nfr[3*i]    = row[BINDEX];
+        md->nfr[3*i+1]  = bs->hm[row[BINDEX]][OFFSET];
+        md->nfr[3*i+2]  = row[MULT];
+    }
+}
+
+/* generates the reducer rows of the normal form matrix from md->nfr instead
+ * of symbolic preprocessing, the rows to be reduced are already selected.
+ * returns 0 without generating any row if the recorded reducers do not fit
+ * to the basis bs, e.g. if its elements are stored in a different order */
+static int generate_nf_reducer_rows_from_trace(
+        mat_t *mat,
+        const bs_t * const bs,
+        md_t *md
+        )
+{
+    /* timings */
+    double ct, rt;
+    ct = cputime();
+    rt = realtime();
+
+    len_t i;
+
+    const hi_t * const nfr  = md->nfr;
+    const len_t nru         = md->nfrl;
+    ht_t *bht = bs->ht;
+    ht_t *sht = md->ht;
+
+    for (i = 0; i < nru; ++i) {
+        if (nfr[3*i] >= bs->ld || bs->hm[nfr[3*i]] == NULL
+                || bs->hm[nfr[3*i]][OFFSET] != nfr[3*i+1]
+                || nfr[3*i+2] >= bht->eld) {
+            return 0;
+        }
+    }
+    mat->rr = realloc(mat->rr, (unsigned long)(nru + 1) * sizeof(hm_t *));
+    for (i = 0; i < nru; ++i) {
+        const hi_t m  = nfr[3*i+2];
+        mat->rr[i]    = multiplied_poly_to_matrix_row(
+                sht, bht, bht->hd[m].val, bht->ev[m], bs->hm[nfr[3*i]]);
+        sht->hd[mat->rr[i][OFFSET]].idx = 2;
+    }
+    /* meta data for matrix, see symbolic_preprocessing() */
+    mat->nr   +=  nru;
+    mat->nrl  =   mat->nr - nru;
+    mat->nru  =   nru;
+    mat->sz   =   mat->nr;
+    mat->nc   =   sht->eld - 1;
+    mat->rbal =   mat->nrl;
+
+    mat->rba  = (rba_t **)malloc((unsigned long)mat->rbal * sizeof(rba_t *));
+    const unsigned long len = nru / 32 + ((nru % 32) != 0);
+    for (i = 0; i < mat->nrl; ++i) {
+        mat->rba[i] = (rba_t *)calloc(len, sizeof(rba_t));
+    }
+
+    /* statistics */
+    md->max_sht_size  = md->max_sht_size > sht->esz ?
+        md->max_sht_size : sht->esz;
+
+    /* timings */
+    md->tracer_ctime += cputime() - ct;
+    md->tracer_rtime += realtime() - rt;
+
+    return 1;
+}
+
 static void generate_saturation_reducer_rows_from_trace(
         mat_t *mat,
         const trace_t * const trace,
@@ -38,6 +38,324 @@ double realtime(void)
 	return (1. + (double)t.tv_usec + ((double)t.tv_sec*1000000.)) / 1000000.;
 }
 
+/* peak resident set size */
+int64_t peak_memory(void)
+{
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    /* macOS reports bytes */
+    return (int64_t)ru.ru_maxrss;
+#else
+    /* Linux and BSDs report kilobytes */
+    return (int64_t)ru.ru_maxrss * 1024;
+#endif
+}
+
+/* available physical memory */
+int64_t available_memory(void)
+{
+#if defined(_SC_AVPHYS_PAGES) && defined(_SC_PAGESIZE)
+    long np = sysconf(_SC_AVPHYS_PAGES);
+    long ps = sysconf(_SC_PAGESIZE);
+    if (np <= 0 || ps <= 0) {
+        return 0;
+    }
+    return (int64_t)np * (int64_t)ps;
+#else
+    return 0;
+#endif
+}
+
+int64_t memory_budget(
+        void
+        )
+{
+    return available_memory() / 4 * 3;
+}
+
+/* state of random_number() for each thread, threads which did not call
+ * set_random_seed() start with the same state */
+static uint32_t rnd_state = 2463534242;
+#pragma omp threadprivate(rnd_state)
+
+void set_random_seed(
+        const uint32_t seed
+        )
+{
+    /* xorshift does not leave the zero state */
+    rnd_state = seed != 0 ? seed : 2463534242;
+}
+
+int32_t random_number(
+        void
+        )
+{
+    uint32_t rseed  = rnd_state;
+    rseed ^=  (rseed << 13);
+    rseed ^=  (rseed >> 17);
+    rseed ^=  (rseed << 5);
+    rnd_state = rseed;
+    return (int32_t)(rseed >> 1);
+}
+
+/* memory held by the basis elements of bs */
+int64_t basis_memory(
+        const bs_t * const bs
+        )
+{
+    len_t i;
+    int64_t mem = 0;
+    size_t cfs  = 0;
+
+    if (bs->cf_8 != NULL) {
+        cfs = sizeof(cf8_t);
+    } else if (bs->cf_16 != NULL) {
+        cfs = sizeof(cf16_t);
+    } else if (bs->cf_32 != NULL) {
+        cfs = sizeof(cf32_t);
+    }
+    for (i = 0; i < bs->ld; ++i) {
+        if (bs->hm[i] != NULL) {
+            mem +=  (int64_t)(bs->hm[i][LENGTH] + OFFSET) * sizeof(hm_t)
+                +   (int64_t)bs->hm[i][LENGTH] * cfs;
+        }
+    }
+    mem +=  (int64_t)bs->sz * (sizeof(hm_t *) + sizeof(void *)
+            + sizeof(int8_t) + sizeof(bl_t) + sizeof(sdm_t));
+
+    return mem;
+}
+
+/* memory held by ht, exponent vectors shared with another hash table
+ * are not counted */
+int64_t hash_table_memory(
+        const ht_t * const ht
+        )
+{
+    return (int64_t)(ht->esz - ht->sld) * ht->evl * sizeof(exp_t)
+        +  (int64_t)ht->esz * (sizeof(hd_t) + sizeof(exp_t *))
+        +  (int64_t)ht->hsz * sizeof(hi_t);
+}
+
+/* memory held in core by the reducer and to be reduced rows information
+ * of all rounds of trace */
+int64_t trace_memory(
+        const trace_t * const trace
+        )
+{
+    len_t i;
+    int64_t mem = (int64_t)trace->std * sizeof(td_t);
+
+    for (i = 0; i < trace->ltd; ++i) {
+        const td_t *td  = trace->td + i;
+        if (td->len > 0) {
+            continue;
+        }
+        mem +=  (int64_t)(td->rld + td->tld + td->nlm) * sizeof(len_t)
+            +   (int64_t)(td->tld / 2) * (td->rld / 2 / 32 + 1) * sizeof(rba_t);
+    }
+    return mem;
+}
+
+/* memory of the largest matrix of the run described by st, see
+ * convert_hashes_to_columns() */
+int64_t matrix_memory(
+        const md_t * const st
+        )
+{
+    const double nnz  = (double)st->mat_max_nrows * st->mat_max_ncols
+        * st->mat_max_density / 100.0;
+
+    return (int64_t)(nnz * (sizeof(hm_t) + sizeof(cf32_t)))
+        +  (int64_t)st->mat_max_nrows * (OFFSET * sizeof(hm_t) + sizeof(hm_t *))
+        +  (int64_t)st->nthrds * st->mat_max_ncols * sizeof(int64_t);
+}
+
+/* SIMD extension used by the vector kernels, -1 = not yet detected */
+static int simd_lvl = -1;
+
+static int simd_support(
+        void
+        )
+{
+#if defined SIMD_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")
+            && __builtin_cpu_supports("avx512bw")) {
+        return SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SIMD_AVX2;
+    }
+#elif defined HAVE_AVX512_F
+    return SIMD_AVX512;
+#elif defined HAVE_AVX2
+    return SIMD_AVX2;
+#endif
+    return SIMD_NONE;
+}
+
+int simd_level(
+        void
+        )
+{
+    int lvl;
+#pragma omp atomic read
+    lvl = simd_lvl;
+
+    if (lvl < 0) {
+        lvl = simd_support();
+#pragma omp atomic write
+        simd_lvl = lvl;
+    }
+    return lvl;
+}
+
+int set_simd_level(
+        const int level
+        )
+{
+    const int sup = simd_support();
+    int lvl       = level;
+
+    if (lvl <= SIMD_AUTO || lvl > sup) {
+        lvl = sup;
+    }
+#pragma omp atomic write
+    simd_lvl = lvl;
+
+    return lvl;
+}
+
+const char *simd_level_name(
+        const int level
+        )
+{
+    switch (level) {
+        case SIMD_AVX2:
+            return "AVX2";
+        case SIMD_AVX512:
+            return "AVX-512";
+        default:
+#if defined __aarch64__
+            return "NEON";
+#else
+            return "NONE";
+#endif
+    }
+}
+
+oc_t *initialize_out_of_core_storage(
+        const char *dir
+        )
+{
+    char *fn  = (char *)malloc((strlen(dir) + 32) * sizeof(char));
+    sprintf(fn, "%s/msolve-ooc-XXXXXX", dir);
+    int fd  = mkstemp(fn);
+    if (fd == -1) {
+        free(fn);
+        return NULL;
+    }
+    /* the data is only accessed via fd, so the file is removed
+     * from disk as soon as fd is closed */
+    unlink(fn);
+    free(fn);
+
+    oc_t *oc  = (oc_t *)calloc(1, sizeof(oc_t));
+    oc->fd    = fd;
+    oc->ld    = 0;
+
+    return oc;
+}
+
+void free_out_of_core_storage(
+        oc_t **ocp
+        )
+{
+    oc_t *oc  = *ocp;
+    if (oc != NULL) {
+        close(oc->fd);
+        free(oc);
+        oc    = NULL;
+        *ocp  = oc;
+    }
+}
+
+int64_t write_out_of_core(
+        oc_t *oc,
+        const void *data,
+        const int64_t len
+        )
+{
+    const int64_t off = oc->ld;
+    const char *p     = (const char *)data;
+    int64_t done      = 0;
+
+    while (done < len) {
+        const ssize_t w = pwrite(oc->fd, p + done,
+                (size_t)(len - done), (off_t)(off + done));
+        if (w <= 0) {
+            /* partially written data is overwritten by the next call */
+            return -1;
+        }
+        done  +=  w;
+    }
+    oc->ld  +=  len;
+
+    return off;
+}
+
+int read_out_of_core(
+        const oc_t * const oc,
+        void *data,
+        const int64_t len,
+        const int64_t off
+        )
+{
+    char *p       = (char *)data;
+    int64_t done  = 0;
+
+    while (done < len) {
+        const ssize_t r = pread(oc->fd, p + done,
+                (size_t)(len - done), (off_t)(off + done));
+        if (r <= 0) {
+            return -1;
+        }
+        done  +=  r;
+    }
+
+    return 0;
+}
+
+/* decides if the rows to be reduced are handled by sparse accumulators
+ * instead of dense rows of length ncols, see SPA_MIN_NCOLS */
+static int use_sparse_accumulator(
+        const mat_t * const mat,
+        const md_t * const st
+        )
+{
+    len_t i;
+    int64_t nterms  = 0;
+
+    if (st->spa_min_ncols == 0) {
+        return 1;
+    }
+    if (mat->nc < st->spa_min_ncols) {
+        return 0;
+    }
+    for (i = 0; i < mat->nru; ++i) {
+        nterms  +=  mat->rr[i][LENGTH];
+    }
+    for (i = 0; i < mat->nrl; ++i) {
+        nterms  +=  mat->tr[i][LENGTH];
+    }
+    return nterms * SPA_DENSITY_RATIO <
+        (int64_t)(mat->nru + mat->nrl) * mat->nc;
+}
+
 static void construct_trace(
         trace_t *trace,
         mat_t *mat
@@ -199,6 +517,199 @@ static void add_lms_to_trace(
     trace->td[ld].nlm = np;
 }
 
+/* number of rba_t words per to be reduced row of trace round td */
+static inline int64_t trace_rba_length(
+        const td_t * const td
+        )
+{
+    return td->rld / 2 / 32 + (((td->rld / 2) % 32) != 0);
+}
+
+/* moves the reducer and to be reduced rows information of trace round
+ * idx to the trace file, the round is read back when the trace is
+ * applied, see prefetch_trace_round() */
+static void spill_trace_round(
+        trace_t *trace,
+        const len_t idx
+        )
+{
+    len_t i;
+    td_t *td  = trace->td + idx;
+
+    if (trace->oc == NULL || td->len > 0) {
+        return;
+    }
+
+    const len_t ntr     = td->tld / 2;
+    const int64_t lrba  = trace_rba_length(td);
+    const int64_t off   = write_out_of_core(trace->oc, td->rri,
+            (int64_t)td->rld * sizeof(len_t));
+    if (off == -1) {
+        return;
+    }
+    if (write_out_of_core(trace->oc, td->tri,
+                (int64_t)td->tld * sizeof(len_t)) == -1) {
+        trace->oc->ld = off;
+        return;
+    }
+    for (i = 0; i < ntr; ++i) {
+        if (write_out_of_core(trace->oc, td->rba[i],
+                    lrba * sizeof(rba_t)) == -1) {
+            trace->oc->ld = off;
+            return;
+        }
+    }
+    td->off = off;
+    td->len = trace->oc->ld - off;
+
+    free(td->rri);
+    td->rri = NULL;
+    free(td->tri);
+    td->tri = NULL;
+    for (i = 0; i < ntr; ++i) {
+        free(td->rba[i]);
+    }
+    free(td->rba);
+    td->rba = NULL;
+}
+
+/* the trace file is mapped read-only, so rounds already applied can
+ * be dropped by the kernel under memory pressure. if mapping is not
+ * possible all rounds are read back into memory. */
+static void map_trace(
+        trace_t *trace
+        )
+{
+    len_t i, j;
+    td_t *td;
+    char *p;
+
+    int64_t nsp = 0;
+    for (i = 0; i < trace->ltd; ++i) {
+        nsp +=  trace->td[i].len;
+    }
+    if (nsp == 0) {
+        return;
+    }
+
+    void *map = mmap(NULL, (size_t)trace->oc->ld, PROT_READ,
+            MAP_SHARED, trace->oc->fd, 0);
+    if (map != MAP_FAILED) {
+        madvise(map, (size_t)trace->oc->ld, MADV_SEQUENTIAL);
+        trace->map  = (char *)map;
+        trace->msz  = trace->oc->ld;
+    }
+    for (i = 0; i < trace->ltd; ++i) {
+        td  = trace->td + i;
+        if (td->len == 0) {
+            continue;
+        }
+        const len_t ntr     = td->tld / 2;
+        const int64_t lrba  = trace_rba_length(td);
+        td->rba = (rba_t **)malloc((unsigned long)ntr * sizeof(rba_t *));
+        if (trace->map != NULL) {
+            p = trace->map + td->off;
+            td->rri = (len_t *)p;
+            p += (int64_t)td->rld * sizeof(len_t);
+            td->tri = (len_t *)p;
+            p += (int64_t)td->tld * sizeof(len_t);
+            for (j = 0; j < ntr; ++j) {
+                td->rba[j] = (rba_t *)p;
+                p += lrba * sizeof(rba_t);
+            }
+        } else {
+            int64_t off = td->off;
+            td->rri = (len_t *)malloc((unsigned long)td->rld * sizeof(len_t));
+            td->tri = (len_t *)malloc((unsigned long)td->tld * sizeof(len_t));
+            if (read_out_of_core(trace->oc, td->rri,
+                        (int64_t)td->rld * sizeof(len_t), off) == -1) {
+                fprintf(stderr, "Cannot read trace data from disk.\n");
+                exit(1);
+            }
+            off += (int64_t)td->rld * sizeof(len_t);
+            if (read_out_of_core(trace->oc, td->tri,
+                        (int64_t)td->tld * sizeof(len_t), off) == -1) {
+                fprintf(stderr, "Cannot read trace data from disk.\n");
+                exit(1);
+            }
+            off += (int64_t)td->tld * sizeof(len_t);
+            for (j = 0; j < ntr; ++j) {
+                td->rba[j] = (rba_t *)malloc(
+                        (unsigned long)lrba * sizeof(rba_t));
+                if (read_out_of_core(trace->oc, td->rba[j],
+                            lrba * sizeof(rba_t), off) == -1) {
+                    fprintf(stderr, "Cannot read trace data from disk.\n");
+                    exit(1);
+                }
+                off += lrba * sizeof(rba_t);
+            }
+            /* round is in core again */
+            td->len = 0;
+        }
+    }
+}
+
+static void advise_trace_round(
+        const trace_t * const trace,
+        const len_t idx,
+        const int advice
+        )
+{
+    const td_t *td  = trace->td + idx;
+    if (td->len == 0) {
+        return;
+    }
+    const int64_t ps  = (int64_t)sysconf(_SC_PAGESIZE);
+    const int64_t b   = td->off / ps * ps;
+    madvise(trace->map + b, (size_t)(td->off + td->len - b), advice);
+}
+
+/* called before round idx of the trace is applied: maps the trace file
+ * on first use, prefetches the next round while the current one is
+ * reduced and releases the pages of the previous round. Pages are only
+ * released if no other prime applies the trace at the same time, those
+ * would have to read them from disk again. */
+static void prefetch_trace_round(
+        trace_t *trace,
+        const len_t idx
+        )
+{
+    int mapped, nap;
+
+    if (trace->oc == NULL) {
+        return;
+    }
+    if (idx == 0) {
+#pragma omp atomic capture
+        nap = ++trace->nap;
+    } else {
+#pragma omp atomic read
+        nap = trace->nap;
+    }
+    if (idx + 1 == trace->ltd) {
+#pragma omp atomic
+        trace->nap--;
+    }
+    /* application runs for different primes share the trace */
+#pragma omp critical (trace_map)
+    {
+        if (trace->map == NULL) {
+            map_trace(trace);
+        }
+        mapped  = trace->map != NULL;
+    }
+    if (mapped == 0) {
+        return;
+    }
+    advise_trace_round(trace, idx, MADV_WILLNEED);
+    if (idx + 1 < trace->ltd) {
+        advise_trace_round(trace, idx + 1, MADV_WILLNEED);
+    }
+    if (idx > 0 && nap == 1) {
+        advise_trace_round(trace, idx - 1, MADV_DONTNEED);
+    }
+}
+
 #if 0
 static void add_minimal_lmh_to_trace(
         trace_t *trace,
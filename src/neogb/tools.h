@@ -23,6 +23,9 @@
 
 #include <time.h>
 #include <sys/time.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include "data.h"
 
 /* cpu time */
@@ -35,6 +38,99 @@ double realtime(
     void
     );
 
+/* peak resident set size of the process in bytes */
+int64_t peak_memory(
+    void
+    );
+
+/* physical memory currently available in bytes,
+ * returns 0 if this information is not accessible */
+int64_t available_memory(
+    void
+    );
+
+/* memory in bytes held by the basis elements of bs */
+int64_t basis_memory(
+    const bs_t * const bs
+    );
+
+/* memory in bytes held by the hash table ht without the exponent vectors
+ * it shares with another hash table */
+int64_t hash_table_memory(
+    const ht_t * const ht
+    );
+
+/* memory in bytes of the trace data kept in core */
+int64_t trace_memory(
+    const trace_t * const trace
+    );
+
+/* memory in bytes of the largest matrix of a run, estimated from the
+ * matrix statistics in st */
+int64_t matrix_memory(
+    const md_t * const st
+    );
+
+/* default memory budget in bytes for one matrix: three quarters of the
+ * currently available physical memory */
+int64_t memory_budget(
+    void
+    );
+
+/* seeds the pseudo random number generator of the calling thread */
+void set_random_seed(
+    const uint32_t seed
+    );
+
+/* pseudo random number in [0, 2^31), drawn from the state of the calling
+ * thread: unlike rand() it is thread-safe and systems solved in parallel
+ * do not change each other's random choices */
+int32_t random_number(
+    void
+    );
+
+/* SIMD extension used by the vector kernels, on first call the best one
+ * supported by the cpu is detected */
+int simd_level(
+    void
+    );
+
+/* overrides the SIMD extension, e.g. for benchmarking. SIMD_AUTO resets
+ * to the detected one, extensions the cpu does not support are lowered
+ * to the best supported one. returns the level set. */
+int set_simd_level(
+    const int level
+    );
+
+const char *simd_level_name(
+    const int level
+    );
+
+/* out-of-core storage in an unlinked temporary file in directory dir,
+ * returns NULL if the file cannot be created */
+oc_t *initialize_out_of_core_storage(
+    const char *dir
+    );
+
+void free_out_of_core_storage(
+    oc_t **ocp
+    );
+
+/* appends len bytes to oc, returns their offset or -1 on failure */
+int64_t write_out_of_core(
+    oc_t *oc,
+    const void *data,
+    const int64_t len
+    );
+
+/* reads len bytes at offset off, returns 0 on success and -1 on failure */
+int read_out_of_core(
+    const oc_t * const oc,
+    void *data,
+    const int64_t len,
+    const int64_t off
+    );
+
 static inline uint8_t mod_p_inverse_8(
         const int16_t val,
         const int16_t p
@@ -121,4 +217,57 @@ static inline uint32_t mod_p_inverse_32(
 
     return d;
 }
+
+/* sparse accumulators: hp is a binary min heap of the columns touched
+ * while reducing a row, bm marks the columns currently stored in hp */
+static inline void spa_insert(
+        hm_t *hp,
+        len_t *nh,
+        uint64_t *bm,
+        const hm_t c
+        )
+{
+    const uint64_t b  = (uint64_t)1 << (c % 64);
+    if (bm[c/64] & b) {
+        return;
+    }
+    bm[c/64] |= b;
+
+    len_t i = (*nh)++;
+    while (i > 0) {
+        const len_t p = (i-1)/2;
+        if (hp[p] <= c) {
+            break;
+        }
+        hp[i] = hp[p];
+        i     = p;
+    }
+    hp[i] = c;
+}
+
+static inline hm_t spa_extract_min(
+        hm_t *hp,
+        len_t *nh,
+        uint64_t *bm
+        )
+{
+    const hm_t m  = hp[0];
+    bm[m/64] &= ~((uint64_t)1 << (m % 64));
+
+    const hm_t c  = hp[--(*nh)];
+    len_t i = 0, j;
+    while ((j = 2*i+1) < *nh) {
+        if (j+1 < *nh && hp[j+1] < hp[j]) {
+            j++;
+        }
+        if (c <= hp[j]) {
+            break;
+        }
+        hp[i] = hp[j];
+        i     = j;
+    }
+    hp[i] = c;
+
+    return m;
+}
 #endif
@@ -19,6 +19,9 @@
  * Mohab Safey El Din */
 
 
+/* number of floating-point levels of the filtered sign evaluations */
+#define USOLVE_FILTER_LEVELS 3
+
 typedef struct{
   int search;/*when >0 (resp. <0, =0) computes positive (resp. negative, all) roots */
   long int bound_pos; /*log2(M) where M dominates the largest positive root*/
@@ -33,6 +36,9 @@ typedef struct{
   unsigned long int transl;
   unsigned long int node_looked;
   unsigned long int half_done;
+  /* sign evaluations decided at each filter level, the last entry counts */
+  /* exact evaluations */
+  unsigned long int nfilter[USOLVE_FILTER_LEVELS + 1];
 
   unsigned long int cur_deg;
   unsigned long int pwx;
@@ -511,3 +511,91 @@ static inline int sgn_mpz_poly_eval_at_point_2exp_naive(mpz_t *upol,
 
 
 
+
+/* precisions of the floating-point levels of the filtered sign evaluations */
+static const mpfr_prec_t usolve_filter_prec[USOLVE_FILTER_LEVELS] = {64, 256, 1024};
+
+/*
+  Evaluates upol at c/2^k with a Horner scheme in precision prec, together
+  with a bound on the error (Higham's bound for Horner, inflated to cover
+  the rounding of the coefficients and of the point):
+
+  |computed - upol(c/2^k)| <= (4 deg + 4) 2^(-prec) sum |upol[i]| |c/2^k|^i
+
+  returns the sign of upol(c/2^k) when the computed value is larger than
+  the error bound, 2 otherwise */
+static int sgn_mpfr_poly_eval_2exp(mpz_t *upol, const unsigned long int deg,
+                                   mpz_t *c, const long k,
+                                   const mpfr_prec_t prec){
+  mpfr_t x, ax, val, bnd, t;
+  mpfr_init2(x, prec);
+  mpfr_init2(ax, prec);
+  mpfr_init2(val, prec);
+  mpfr_init2(bnd, prec);
+  mpfr_init2(t, prec);
+
+  mpfr_set_z_2exp(x, *c, -k, MPFR_RNDN);
+  /* |c/2^k| rounded up */
+  mpfr_set_z_2exp(ax, *c, -k, MPFR_RNDA);
+  mpfr_abs(ax, ax, MPFR_RNDN);
+
+  mpfr_set_z(val, upol[deg], MPFR_RNDN);
+  mpfr_set_z(bnd, upol[deg], MPFR_RNDA);
+  mpfr_abs(bnd, bnd, MPFR_RNDN);
+  for(long i = deg - 1; i >= 0; i--){
+    mpfr_mul(val, val, x, MPFR_RNDN);
+    mpfr_set_z(t, upol[i], MPFR_RNDN);
+    mpfr_add(val, val, t, MPFR_RNDN);
+
+    mpfr_mul(bnd, bnd, ax, MPFR_RNDU);
+    mpfr_set_z(t, upol[i], MPFR_RNDA);
+    mpfr_abs(t, t, MPFR_RNDN);
+    mpfr_add(bnd, bnd, t, MPFR_RNDU);
+  }
+  mpfr_mul_ui(bnd, bnd, 4 * deg + 4, MPFR_RNDU);
+  mpfr_mul_2si(bnd, bnd, -prec, MPFR_RNDU);
+
+  int s = 2;
+  if(mpfr_cmpabs(val, bnd) > 0){
+    s = mpfr_sgn(val);
+  }
+
+  mpfr_clear(x);
+  mpfr_clear(ax);
+  mpfr_clear(val);
+  mpfr_clear(bnd);
+  mpfr_clear(t);
+  return s;
+}
+
+/*
+  Filtered sign of upol(c/2^k), k >= 0: floating-point evaluations with
+  error bounds at increasing precisions, the exact evaluation is the
+  fallback (e.g. when c/2^k is a root).
+  nfilter[l] counts the decisions taken at level l, nfilter[USOLVE_FILTER_LEVELS]
+  those of the exact evaluation; nfilter may be NULL.
+*/
+static int sgn_mpz_poly_eval_2exp_filtered(mpz_t *upol,
+                                           const unsigned long int deg,
+                                           mpz_t *c, const long k,
+                                           unsigned long int *nfilter){
+  int s;
+  if(deg == 0){
+    return mpz_sgn(upol[0]);
+  }
+  for(int l = 0; l < USOLVE_FILTER_LEVELS; l++){
+    s = sgn_mpfr_poly_eval_2exp(upol, deg, c, k, usolve_filter_prec[l]);
+    if(s != 2){
+      if(nfilter != NULL){
+#pragma omp atomic
+        nfilter[l]++;
+      }
+      return s;
+    }
+  }
+  if(nfilter != NULL){
+#pragma omp atomic
+    nfilter[USOLVE_FILTER_LEVELS]++;
+  }
+  return sgn_mpz_poly_eval_at_point_2exp_naive(upol, deg, c, k);
+}
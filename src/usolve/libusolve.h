@@ -26,6 +26,13 @@ interval *real_roots(mpz_t *, unsigned long,
                      int,
                      int);
 
+void refine_real_roots(mpz_t *, unsigned long,
+                       interval *, unsigned long int,
+                       const long *, long,
+                       const int32_t,
+                       int,
+                       int);
+
 void display_roots_system(FILE *, interval *, unsigned long int);
 
 void display_root(FILE *, interval *);
@@ -665,7 +665,8 @@ void get_values_at_bounds(mpz_t *upol, unsigned long int deg,
 }
 
 static void refine_root_naive(mpz_t *upol, unsigned long int deg,
-                              interval *rt, mpz_t *middle, int calgo){
+                              interval *rt, mpz_t *middle, int calgo,
+                              unsigned long int *nfilter){
   if(rt->isexact == 1){
     return;
   }
@@ -678,7 +679,8 @@ static void refine_root_naive(mpz_t *upol, unsigned long int deg,
     mpz_add_ui(*middle, *middle, 1);
     newk = rt->k + 1;
 
-    sgn_middle = sgn_mpz_poly_eval_at_point_2exp_naive(upol, deg, middle, newk);
+    sgn_middle = sgn_mpz_poly_eval_2exp_filtered(upol, deg, middle, newk,
+                                                 nfilter);
   }
   else{
     mpz_set_ui(*middle, 1);
@@ -686,7 +688,8 @@ static void refine_root_naive(mpz_t *upol, unsigned long int deg,
     mpz_add(*middle, *middle, rt->numer);
     newk = ( (rt->k) + 1 );
 
-    sgn_middle = sgn_mpz_poly_eval_at_point_naive(upol, deg, middle, calgo);
+    sgn_middle = sgn_mpz_poly_eval_2exp_filtered(upol, deg, middle, 0,
+                                                 nfilter);
   }
   int sign_left = rt->sign_left;
 
@@ -720,158 +723,273 @@ static void remove_exact_roots_by_division(mpz_t *upol, unsigned long int *deg,
 }
 
 
-/* Refinement using Newton-Interval like technique (but replacing Newton with */
-/* linear interpolation) */
-/* it takes as input a pointer to deg because it may change after performing */
-/* divisions when there are exact roots */
-void refine_QIR_roots(mpz_t *upol, unsigned long int *deg, interval *roots,
-                      int nbneg, int nbpos,
-                      int prec, int verbose, double step, int nthreads){
-  unsigned long int i;
-  /* table for intermediate values */
-  mpz_t *tab = (mpz_t *)(malloc(sizeof(mpz_t) * 8));
-  for(i=0;i<8;i++){
-    mpz_init(tab[i]);
+/* scratch data of a thread refining roots */
+typedef struct{
+  mpz_t *upol; /* private copy of the polynomial, NULL when single-threaded */
+  unsigned long int deg;
+  mpz_t *tab; /* table for intermediate values */
+  interval pos_rt;
+  mpz_t newc;
+} refine_data_t;
+
+static refine_data_t *allocate_refine_data(const int nthreads,
+                                           const unsigned long int deg){
+  refine_data_t *rdata = malloc(sizeof(refine_data_t) * nthreads);
+  for(int t = 0; t < nthreads; t++){
+    refine_data_t *rd = rdata + t;
+    rd->tab = (mpz_t *)(malloc(sizeof(mpz_t) * 8));
+    for(int i = 0; i < 8; i++){
+      mpz_init(rd->tab[i]);
+    }
+    mpz_init(rd->pos_rt.numer);
+    mpz_init(rd->newc);
+    rd->deg = deg;
+    rd->upol = NULL;
+    if(nthreads > 1){
+      rd->upol = (mpz_t *)(malloc(sizeof(mpz_t) * (deg + 1)));
+      for(unsigned long int i = 0; i <= deg; i++){
+        mpz_init(rd->upol[i]);
+      }
+    }
   }
+  return rdata;
+}
 
-  double e_time = 0, refine_time = realtime();
-  int nb = nbneg + nbpos;
-
-  remove_exact_roots_by_division(upol, deg, roots, nb, nthreads);
+static void free_refine_data(refine_data_t *rdata, const int nthreads,
+                             const unsigned long int deg){
+  for(int t = 0; t < nthreads; t++){
+    refine_data_t *rd = rdata + t;
+    for(int i = 0; i < 8; i++){
+      mpz_clear(rd->tab[i]);
+    }
+    free(rd->tab);
+    mpz_clear(rd->pos_rt.numer);
+    mpz_clear(rd->newc);
+    if(rd->upol != NULL){
+      for(unsigned long int i = 0; i <= deg; i++){
+        mpz_clear(rd->upol[i]);
+      }
+      free(rd->upol);
+    }
+  }
+  free(rdata);
+}
 
+/* refines the negative root rt as the positive root pos_rt of upol(-x), */
+/* upol has its odd coefficients negated on input */
+static void refine_QIR_negative_root_of(mpz_t *upol, unsigned long int *deg,
+                                        interval *rt, refine_data_t *rd,
+                                        int prec, int adaptative, int verbose){
+  interval *pos_rt = &rd->pos_rt;
+  mpz_t *tab = rd->tab;
 
-  interval *pos_rt = (interval *)(malloc(sizeof(interval)));
-  mpz_init(pos_rt->numer);
-  mpz_t newc;
-  mpz_init(newc);
+  /* display_root(stderr, rt); */
 
-  for(i = 0; i <= *deg; i++){
-    if(i%2 == 1){
-      mpz_neg(upol[i], upol[i]);
+  if(rt->k > 0){
+    if(rt->isexact!=1){
+      mpz_add_ui(pos_rt->numer, rt->numer, 1);
+      mpz_neg(pos_rt->numer, pos_rt->numer);
+    }
+    pos_rt->k = rt->k;
+    pos_rt->sign_left = - (rt->sign_left);
+    pos_rt->isexact = rt->isexact;
+  }
+  else {
+    if(rt->isexact!=1){
+      mpz_set_ui(rd->newc, 1);
+      mpz_mul_2exp(rd->newc, rd->newc, -rt->k);
+      mpz_add(pos_rt->numer, rt->numer, rd->newc);
+      mpz_neg(pos_rt->numer, pos_rt->numer);
     }
+    pos_rt->k = rt->k;
+    pos_rt->sign_left = - (rt->sign_left);
+    pos_rt->isexact = rt->isexact;
   }
 
-  for(i = 0; i < nbneg; i++){
+  if(pos_rt->isexact==0){
+    get_values_at_bounds(upol, *deg, pos_rt, tab);
+    if(mpz_sgn(tab[0])==0 || mpz_sgn(tab[1])==0){
+      fprintf(stderr, "Error in refinement (neg. roots): these values should not be zero\n");
+      exit(1);
+    }
+    int rprec = prec;
+    if(adaptative){
+      long d = 1 + ilog2_mpz(pos_rt->numer) - rt->k;
 
-    interval *rt = roots + i;
+      /* fprintf(stderr, "[%d, %ld]", prec, */
+      /*         prec + ((*deg) * MAX(0, d)) / 32); */
+      rprec = prec + (((*deg)-1) * MAX(0, d)) / 32;
+    }
+    refine_QIR_positive_root(upol, deg, pos_rt, tab, rprec, verbose);
 
-    /* display_root(stderr, rt); */
+    if(mpz_sgn(tab[0])==mpz_sgn(tab[1])){
+      fprintf(stderr, "BUG in refinement (sgn tab[0]==sgn tab[1]) for neg. roots");
+      exit(1);
+    }
+  }
 
-    if(rt->k > 0){
-      if(rt->isexact!=1){
-        mpz_add_ui(pos_rt->numer, rt->numer, 1);
-        mpz_neg(pos_rt->numer, pos_rt->numer);
-      }
-      pos_rt->k = rt->k;
-      pos_rt->sign_left = - (rt->sign_left);
-      pos_rt->isexact = rt->isexact;
+  if(pos_rt->isexact==1){
+    if(pos_rt->k < 0){
+      pos_rt->k = 0;
     }
-    else {
-      if(rt->isexact!=1){
-        mpz_set_ui(newc, 1);
-        mpz_mul_2exp(newc, newc, -rt->k);
-        mpz_add(pos_rt->numer, rt->numer, newc);
-        mpz_neg(pos_rt->numer, pos_rt->numer);
-      }
-      pos_rt->k = rt->k;
-      pos_rt->sign_left = - (rt->sign_left);
-      pos_rt->isexact = rt->isexact;
+  }
+  //We assume precision >=0
+  if(pos_rt->isexact!=1){
+    rt->k = pos_rt->k;
+    rt->isexact = pos_rt->isexact;
+    mpz_add_ui(rt->numer, pos_rt->numer, 1);
+    mpz_neg(rt->numer, rt->numer);
+  }
+  else{
+    rt->k = pos_rt->k;
+    if(rt->isexact!=1){
+      rt->isexact = pos_rt->isexact;
+      mpz_set(rt->numer, pos_rt->numer);
+      mpz_neg(rt->numer, rt->numer);
     }
+  }
+}
 
-    if(pos_rt->isexact==0){
-      get_values_at_bounds(upol, *deg, pos_rt, tab);
-      if(mpz_sgn(tab[0])==0 || mpz_sgn(tab[1])==0){
-        fprintf(stderr, "Error in refinement (neg. roots): these values should not be zero\n");
-        exit(1);
-      }
-      refine_QIR_positive_root(upol, deg, pos_rt, tab, prec, verbose);
+static void refine_QIR_positive_root_of(mpz_t *upol, unsigned long int *deg,
+                                        interval *rt, refine_data_t *rd,
+                                        int prec, int adaptative, int verbose){
+  mpz_t *tab = rd->tab;
 
-      if(mpz_sgn(tab[0])==mpz_sgn(tab[1])){
-        fprintf(stderr, "BUG in refinement (sgn tab[0]==sgn tab[1]) for neg. roots");
-        exit(1);
-      }
+  if(rt->isexact==0){
+    get_values_at_bounds(upol, *deg, rt, tab);
+    if(mpz_sgn(tab[1])==0 || mpz_sgn(tab[0])==0){
+      fprintf(stderr, "Error in refinement (pos. roots): these values should not be zero\n");
+      exit(1);
     }
+    int rprec = prec;
+    if(adaptative){
+      long d = 1 + ilog2_mpz(rt->numer) - rt->k;
 
-    if(pos_rt->isexact==1){
-      if(pos_rt->k < 0){
-        pos_rt->k = 0;
-      }
+      /* fprintf(stderr, "[%d, %ld]", prec, prec + ((*deg) * MAX(0, 1 + d)) / 32); */
+      rprec = prec + (((*deg) - 1) * MAX(0, 1 + d)) / 32;
     }
-    //We assume precision >=0
-    if(pos_rt->isexact!=1){
-      rt->k = pos_rt->k;
-      rt->isexact = pos_rt->isexact;
-      mpz_add_ui(rt->numer, pos_rt->numer, 1);
-      mpz_neg(rt->numer, rt->numer);
+    refine_QIR_positive_root(upol, deg, rt, tab, rprec, verbose);
+    if(mpz_sgn(tab[0])==mpz_sgn(tab[1])){
+      fprintf(stderr,"BUG in refinement (sgn tab[0]=sgn tab[1] for pos. roots)");
+      exit(1);
     }
-    else{
-      rt->k = pos_rt->k;
-      if(rt->isexact!=1){
-        rt->isexact = pos_rt->isexact;
-        mpz_set(rt->numer, pos_rt->numer);
-        mpz_neg(rt->numer, rt->numer);
+    if(rt->isexact==1){
+      if(rt->k < 0){
+        rt->k = 0;
       }
     }
+  }
+}
 
-    e_time += realtime() - refine_time;
-    if(e_time>=step){
-      refine_time = realtime();
-      e_time = 0;
-      if(verbose>=1){
-        fprintf(stderr, "{%.2f%s}", ((double)i / nb) * 100, "%");
+/* refines roots[first], ..., roots[last-1] (roots[idx[first]], ..., */
+/* roots[idx[last-1]] when idx is not NULL) which are all negative or all */
+/* positive; roots are independent, hence refined in parallel, each thread */
+/* working on its own copy of upol since exact roots found on the way */
+/* divide the polynomial */
+static void refine_QIR_roots_range(mpz_t *upol, unsigned long int *deg,
+                                   interval *roots, const long *idx,
+                                   int first, int last,
+                                   int negative, refine_data_t *rdata,
+                                   int prec, int adaptative, int verbose,
+                                   double step, int nb, int nthreads,
+                                   double *e_time, double *refine_time){
+  int i;
+#pragma omp parallel num_threads(nthreads) private(i)
+  {
+    const int tid = omp_get_thread_num();
+    refine_data_t *rd = rdata + tid;
+    mpz_t *pol = upol;
+    unsigned long int *dg = deg;
+    if(nthreads > 1){
+      rd->deg = *deg;
+      for(unsigned long int j = 0; j <= *deg; j++){
+        mpz_set(rd->upol[j], upol[j]);
+      }
+      pol = rd->upol;
+      dg = &rd->deg;
+    }
+#pragma omp for schedule(dynamic)
+    for(i = first; i < last; i++){
+      interval *rt = roots + (idx != NULL ? idx[i] : i);
+      if(negative){
+        refine_QIR_negative_root_of(pol, dg, rt, rd,
+                                    prec, adaptative, verbose);
+      }
+      else{
+        refine_QIR_positive_root_of(pol, dg, rt, rd,
+                                    prec, adaptative, verbose);
+      }
+
+      if(tid == 0){
+        *e_time += realtime() - *refine_time;
+        if(*e_time>=step){
+          *refine_time = realtime();
+          *e_time = 0;
+          if(verbose>=1){
+            fprintf(stderr, "{%.2f%s}", ((double)i / nb) * 100, "%");
+          }
+        }
       }
     }
   }
+}
 
-  mpz_clear(newc);
-  mpz_clear(pos_rt->numer);
-  free(pos_rt);
+static void refine_QIR_roots_all(mpz_t *upol, unsigned long int *deg,
+                                 interval *roots, int nbneg, int nbpos,
+                                 int prec, int verbose, double step,
+                                 int nthreads, int adaptative){
+  unsigned long int i;
+
+  double e_time = 0, refine_time = realtime();
+  int nb = nbneg + nbpos;
+
+  remove_exact_roots_by_division(upol, deg, roots, nb, nthreads);
+
+  if(nthreads > nb){
+    nthreads = nb;
+  }
+  if(nthreads < 1){
+    nthreads = 1;
+  }
+  const unsigned long int deg_alloc = *deg;
+  refine_data_t *rdata = allocate_refine_data(nthreads, deg_alloc);
 
-  /* now we refine positive roots */
   for(i = 0; i <= *deg; i++){
     if(i%2 == 1){
       mpz_neg(upol[i], upol[i]);
     }
   }
 
-  for(i=nbneg; i < nb; i++){
-    interval *rt = roots + i;
+  refine_QIR_roots_range(upol, deg, roots, NULL, 0, nbneg, 1, rdata,
+                         prec, adaptative, verbose, step, nb, nthreads,
+                         &e_time, &refine_time);
 
-    if(rt->isexact==0){
-      get_values_at_bounds(upol, *deg, rt, tab);
-      if(mpz_sgn(tab[1])==0 || mpz_sgn(tab[0])==0){
-        fprintf(stderr, "Error in refinement (pos. roots): these values should not be zero\n");
-        exit(1);
-      }
-      refine_QIR_positive_root(upol, deg, rt, tab, prec, verbose);
-      if(mpz_sgn(tab[0])==mpz_sgn(tab[1])){
-        fprintf(stderr,"BUG in refinement (sgn tab[0]=sgn tab[1] for pos. roots)");
-        exit(1);
-      }
-      if(rt->isexact==1){
-        if(rt->k < 0){
-          rt->k = 0;
-        }
-      }
+  /* now we refine positive roots */
+  for(i = 0; i <= *deg; i++){
+    if(i%2 == 1){
+      mpz_neg(upol[i], upol[i]);
     }
+  }
 
-    e_time += realtime() - refine_time;
-    if(e_time>=step){
-      refine_time = realtime();
-      e_time = 0;
-      if(verbose>=1){
-        fprintf(stderr, "{%.2f%s}", ((double)(i) / nb) * 100, "%");
-      }
-    }
+  refine_QIR_roots_range(upol, deg, roots, NULL, nbneg, nb, 0, rdata,
+                         prec, adaptative, verbose, step, nb, nthreads,
+                         &e_time, &refine_time);
 
-  }
   if(verbose>=1){
     fprintf(stderr, "\n");
   }
-  for(i = 0; i < 8; i++){
-    mpz_clear(tab[i]);
-  }
-  free(tab);
+  free_refine_data(rdata, nthreads, deg_alloc);
+}
+
+/* Refinement using Newton-Interval like technique (but replacing Newton with */
+/* linear interpolation) */
+/* it takes as input a pointer to deg because it may change after performing */
+/* divisions when there are exact roots */
+void refine_QIR_roots(mpz_t *upol, unsigned long int *deg, interval *roots,
+                      int nbneg, int nbpos,
+                      int prec, int verbose, double step, int nthreads){
+  refine_QIR_roots_all(upol, deg, roots, nbneg, nbpos,
+                       prec, verbose, step, nthreads, 0);
 }
 
 /* Refinement using Newton-Interval like technique (but replacing Newton with */
@@ -882,172 +1000,93 @@ void refine_QIR_roots(mpz_t *upol, unsigned long int *deg, interval *roots,
 void refine_QIR_roots_adaptative(mpz_t *upol, unsigned long int *deg, interval *roots,
                                  int nbneg, int nbpos,
                                  int prec, int verbose, double step, int nthreads){
-  unsigned long int i;
-  /* table for intermediate values */
-  mpz_t *tab = (mpz_t *)(malloc(sizeof(mpz_t) * 8));
-  for(i=0;i<8;i++){
-    mpz_init(tab[i]);
-  }
+  refine_QIR_roots_all(upol, deg, roots, nbneg, nbpos,
+                       prec, verbose, step, nthreads, 1);
+}
 
+
+/* Refines up to prec only the roots roots[idx[0]], ..., roots[idx[nidx-1]] */
+/* among the nb isolating intervals roots of upol (as returned by */
+/* real_roots), the other intervals are left untouched. */
+/* Refinement restarts from the given intervals, which may thus come from a */
+/* previous (coarser) refinement. */
+void refine_QIR_roots_selected(mpz_t *upol, unsigned long int *deg,
+                               interval *roots, long nb,
+                               const long *idx, long nidx,
+                               int prec, int verbose, int nthreads){
   double e_time = 0, refine_time = realtime();
-  int nb = nbneg + nbpos;
 
   remove_exact_roots_by_division(upol, deg, roots, nb, nthreads);
 
-
-  interval *pos_rt = (interval *)(malloc(sizeof(interval)));
-  mpz_init(pos_rt->numer);
-  mpz_t newc;
-  mpz_init(newc);
-
-  for(i = 0; i <= *deg; i++){
-    if(i%2 == 1){
-      mpz_neg(upol[i], upol[i]);
+  /* negative roots first, duplicates and exact roots are removed */
+  char *sel = calloc(nb, sizeof(char));
+  for(long i = 0; i < nidx; i++){
+    if(idx[i] >= 0 && idx[i] < nb && roots[idx[i]].isexact != 1){
+      sel[idx[i]] = 1;
     }
   }
-
-  for(i = 0; i < nbneg; i++){
-
-    interval *rt = roots + i;
-
-    /* display_root(stderr, rt); */
-
-    if(rt->k > 0){
-      if(rt->isexact!=1){
-        mpz_add_ui(pos_rt->numer, rt->numer, 1);
-        mpz_neg(pos_rt->numer, pos_rt->numer);
-      }
-      pos_rt->k = rt->k;
-      pos_rt->sign_left = - (rt->sign_left);
-      pos_rt->isexact = rt->isexact;
-    }
-    else {
-      if(rt->isexact!=1){
-        mpz_set_ui(newc, 1);
-        mpz_mul_2exp(newc, newc, -rt->k);
-        mpz_add(pos_rt->numer, rt->numer, newc);
-        mpz_neg(pos_rt->numer, pos_rt->numer);
-      }
-      pos_rt->k = rt->k;
-      pos_rt->sign_left = - (rt->sign_left);
-      pos_rt->isexact = rt->isexact;
-    }
-
-    if(pos_rt->isexact==0){
-      get_values_at_bounds(upol, *deg, pos_rt, tab);
-      if(mpz_sgn(tab[0])==0 || mpz_sgn(tab[1])==0){
-        fprintf(stderr, "Error in refinement (neg. roots): these values should not be zero\n");
-        exit(1);
-      }
-      long d = 1 + ilog2_mpz(pos_rt->numer) - rt->k;
-
-      /* fprintf(stderr, "[%d, %ld]", prec, */
-      /*         prec + ((*deg) * MAX(0, d)) / 32); */
-      refine_QIR_positive_root(upol, deg, pos_rt, tab,
-                               prec + (((*deg)-1) * MAX(0, d)) / 32, verbose);
-
-      if(mpz_sgn(tab[0])==mpz_sgn(tab[1])){
-        fprintf(stderr, "BUG in refinement (sgn tab[0]==sgn tab[1]) for neg. roots");
-        exit(1);
-      }
-    }
-
-    if(pos_rt->isexact==1){
-      if(pos_rt->k < 0){
-        pos_rt->k = 0;
-      }
+  long *order = malloc(sizeof(long) * (nb + 1));
+  long nbsel = 0, nbneg = 0;
+  for(long i = 0; i < nb; i++){
+    if(sel[i] && mpz_sgn(roots[i].numer) < 0){
+      order[nbsel++] = i;
     }
-    //We assume precision >=0
-    if(pos_rt->isexact!=1){
-      rt->k = pos_rt->k;
-      rt->isexact = pos_rt->isexact;
-      mpz_add_ui(rt->numer, pos_rt->numer, 1);
-      mpz_neg(rt->numer, rt->numer);
-    }
-    else{
-      rt->k = pos_rt->k;
-      if(rt->isexact!=1){
-        rt->isexact = pos_rt->isexact;
-        mpz_set(rt->numer, pos_rt->numer);
-        mpz_neg(rt->numer, rt->numer);
-      }
-    }
-
-    e_time += realtime() - refine_time;
-    if(e_time>=step){
-      refine_time = realtime();
-      e_time = 0;
-      if(verbose>=1){
-        fprintf(stderr, "{%.2f%s}", ((double)i / nb) * 100, "%");
-      }
+  }
+  nbneg = nbsel;
+  for(long i = 0; i < nb; i++){
+    if(sel[i] && mpz_sgn(roots[i].numer) >= 0){
+      order[nbsel++] = i;
     }
   }
+  free(sel);
 
-  mpz_clear(newc);
-  mpz_clear(pos_rt->numer);
-  free(pos_rt);
+  if(nthreads > nbsel){
+    nthreads = nbsel;
+  }
+  if(nthreads < 1){
+    nthreads = 1;
+  }
+  const unsigned long int deg_alloc = *deg;
+  refine_data_t *rdata = allocate_refine_data(nthreads, deg_alloc);
 
-  /* now we refine positive roots */
+  unsigned long int i;
   for(i = 0; i <= *deg; i++){
     if(i%2 == 1){
       mpz_neg(upol[i], upol[i]);
     }
   }
 
-  for(i=nbneg; i < nb; i++){
-    interval *rt = roots + i;
-
-    if(rt->isexact==0){
-      get_values_at_bounds(upol, *deg, rt, tab);
-      if(mpz_sgn(tab[1])==0 || mpz_sgn(tab[0])==0){
-        fprintf(stderr, "Error in refinement (pos. roots): these values should not be zero\n");
-        exit(1);
-      }
-      long d = 1 + ilog2_mpz(rt->numer) - rt->k;
+  refine_QIR_roots_range(upol, deg, roots, order, 0, nbneg, 1, rdata,
+                         prec, 1, verbose, 0, nbsel, nthreads,
+                         &e_time, &refine_time);
 
-      /* fprintf(stderr, "[%d, %ld]", prec, prec + ((*deg) * MAX(0, 1 + d)) / 32); */
-      refine_QIR_positive_root(upol, deg, rt, tab,
-                               prec + (((*deg) - 1) * MAX(0, 1 + d)) / 32, verbose);
-      if(mpz_sgn(tab[0])==mpz_sgn(tab[1])){
-        fprintf(stderr,"BUG in refinement (sgn tab[0]=sgn tab[1] for pos. roots)");
-        exit(1);
-      }
-      if(rt->isexact==1){
-        if(rt->k < 0){
-          rt->k = 0;
-        }
-      }
+  for(i = 0; i <= *deg; i++){
+    if(i%2 == 1){
+      mpz_neg(upol[i], upol[i]);
     }
+  }
 
-    e_time += realtime() - refine_time;
-    if(e_time>=step){
-      refine_time = realtime();
-      e_time = 0;
-      if(verbose>=1){
-        fprintf(stderr, "{%.2f%s}", ((double)(i) / nb) * 100, "%");
-      }
-    }
+  refine_QIR_roots_range(upol, deg, roots, order, nbneg, nbsel, 0, rdata,
+                         prec, 1, verbose, 0, nbsel, nthreads,
+                         &e_time, &refine_time);
 
-  }
   if(verbose>=1){
     fprintf(stderr, "\n");
   }
-  for(i = 0; i < 8; i++){
-    mpz_clear(tab[i]);
-  }
-  free(tab);
+  free_refine_data(rdata, nthreads, deg_alloc);
+  free(order);
 }
 
-
 void refine_all_roots_naive(mpz_t *upol, unsigned long int deg,
                             interval *roots, unsigned long int nb,
-                            unsigned int prec, int calgo, int debug){
+                            unsigned int prec, int calgo, int debug,
+                            unsigned long int *nfilter){
   mpz_t *middle=malloc(sizeof(mpz_t));
   mpz_init(middle[0]);
 
   for(unsigned long int j = 0; j < nb; j++){
     while((roots+j)->k < prec && (roots+j)->isexact == 0){
-      refine_root_naive(upol, deg, roots+j, middle, calgo);
+      refine_root_naive(upol, deg, roots+j, middle, calgo, nfilter);
     }
   }
   mpz_clear(middle[0]);
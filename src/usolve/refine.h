@@ -23,7 +23,7 @@
 #define USOLVE
 #endif
 
-void USOLVErefine_all_roots_naive(mpz_t *, unsigned long int, interval *, unsigned long int, unsigned int, int, int);
+void USOLVErefine_all_roots_naive(mpz_t *, unsigned long int, interval *, unsigned long int, unsigned int, int, int, unsigned long int *);
 
 void USOLVErefine_QIR_roots(mpz_t *, unsigned long int *, interval *,
                       int, int, int, int, double, int);
@@ -25,6 +25,7 @@
 #include<stdio.h>
 #include<stdlib.h>
 #include<gmp.h>
+#include<mpfr.h>
 #ifdef _OPENMP
 #include<omp.h>
 #endif
@@ -349,17 +350,9 @@ static void is_zero_root(mpz_t *upol, mpz_t c, long k,
 static int sgn_mpz_upoly_eval_onehalf(mpz_t *upol,
                                       unsigned long int deg,
                                       usolve_flags *flags){
-  long i;
-
-  mpz_set(flags->Values[0], upol[deg]);
-
-  for (i = deg - 1; i >= 0; i--){
-      mpz_mul_2exp(flags->Values[1], upol[i], deg - i);
-      mpz_add(flags->Values[0], flags->Values[0], flags->Values[1]);
-  }
-
-  i = mpz_sgn(flags->Values[0]);
-  return i;
+  mpz_set_ui(flags->Values[0], 1);
+  return sgn_mpz_poly_eval_2exp_filtered(upol, deg, flags->Values, 1,
+                                         flags->nfilter);
 }
 
 
@@ -939,6 +932,9 @@ static void initialize_flags(usolve_flags *flags){
   flags->transl = 0;
   flags->node_looked = 0;
   flags->half_done = 0;
+  for(int i = 0; i <= USOLVE_FILTER_LEVELS; i++){
+    flags->nfilter[i] = 0;
+  }
 
   flags->cur_deg = 0;
   flags->pwx = 0;
@@ -1075,6 +1071,11 @@ static void display_stats(usolve_flags *flags){
   fprintf(stderr,"Number of half splits : %lu\n", flags->half_done);
   fprintf(stderr,"Time in Descartes (elapsed): %.2f sec\n", flags->time_desc);
   fprintf(stderr,"Time in Taylor shifts (elapsed): %.2f sec\n", flags->time_shift);
+  fprintf(stderr,"Sign evaluations (filter levels / exact) :");
+  for(int i = 0; i <= USOLVE_FILTER_LEVELS; i++){
+    fprintf(stderr," %lu", flags->nfilter[i]);
+  }
+  fprintf(stderr,"\n");
   fprintf(stderr,"\n");
 
 }
@@ -1327,7 +1328,8 @@ interval *real_roots(mpz_t *upoly, unsigned long deg,
   if(nbroots > 0 && flags->prec_isole >= 0){
     if(flags->classical_algo > 0){
       refine_all_roots_naive(upoly,deg, roots, nbroots,
-                             flags->prec_isole, flags->classical_algo, flags->debug);
+                             flags->prec_isole, flags->classical_algo, flags->debug,
+                             flags->nfilter);
     }
     else{
       refine_QIR_roots_adaptative(upoly, &deg, roots, *nb_neg_roots, *nb_pos_roots,
@@ -1356,3 +1358,34 @@ interval *real_roots(mpz_t *upoly, unsigned long deg,
   free(flags);
   return roots;
 }
+
+/* refines up to precision the isolating intervals roots[idx[i]] of the real */
+/* roots of upoly computed by real_roots (nbroots is the total number of */
+/* roots), without isolating again the roots of upoly; upoly may be modified */
+void refine_real_roots(mpz_t *upoly, unsigned long deg,
+                       interval *roots, unsigned long int nbroots,
+                       const long *idx, long nidx,
+                       const int32_t precision,
+                       int nthrds,
+                       int info_level){
+  if(info_level){
+    fprintf(stderr, "Refinement of %ld real roots at precision %d\n",
+            nidx, precision);
+  }
+  double refine_time = realtime();
+
+  refine_QIR_roots_selected(upoly, &deg, roots, nbroots, idx, nidx,
+                            precision, MAX(info_level - 1, 0), nthrds);
+
+  for(unsigned long int i = 0; i < nbroots; i++){
+    if(roots[i].isexact){
+      if(roots[i].k < 0){
+        roots[i].k = 0;
+      }
+    }
+  }
+  if(info_level > 1){
+    fprintf(stderr,"Time for refinement (elapsed): %.2f sec\n",
+            realtime() - refine_time);
+  }
+}
@@ -0,0 +1,64 @@
+#!/bin/bash
+
+# reduced Groebner basis of the saturation of the ideal generated by the
+# first three polynomials by the last one, z; F4SAT-elim-qq eliminates t
+# from the same ideal plus t*z-1 and has to give the same basis
+
+file=F4SAT-qq
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -S -g 2 -l 2 -t 1
+if [ $? -gt 0 ]; then
+    exit 1
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 2
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -S -g 2 -l 2 -t 2
+if [ $? -gt 0 ]; then
+    exit 21
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 22
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -S -g 2 -l 44 -t 1
+if [ $? -gt 0 ]; then
+    exit 41
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 42
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -S -g 2 -l 44 -t 2
+if [ $? -gt 0 ]; then
+    exit 61
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 62
+fi
+
+$(pwd)/msolve -f input_files/F4SAT-elim-qq.ms -o test/diff/$file.res \
+      -e 1 -g 2 -l 2 -t 1
+if [ $? -gt 0 ]; then
+    exit 81
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 82
+fi
+
+rm test/diff/$file.res
@@ -0,0 +1,60 @@
+#!/bin/bash
+
+files="one-16 one-31 one-qq xy-qq radical_shape-31 radical_shape-qq multy-16"
+
+rm -f test/diff/batch.ms test/diff/batch.expected
+for file in $files; do
+    cat input_files/$file.ms >> test/diff/batch.ms
+    echo "" >> test/diff/batch.ms
+    cat output_files/$file.res >> test/diff/batch.expected
+done
+
+$(pwd)/msolve -b test/diff/batch.ms -o test/diff/batch.res \
+      -P 2 -d 0 -l 2 -t 1
+if [ $? -gt 0 ]; then
+    exit 1
+fi
+
+diff test/diff/batch.res test/diff/batch.expected
+if [ $? -gt 0 ]; then
+    exit 2
+fi
+
+$(pwd)/msolve -b test/diff/batch.ms -o test/diff/batch.res \
+      -P 2 -d 0 -l 2 -t 3
+if [ $? -gt 0 ]; then
+    exit 21
+fi
+
+diff test/diff/batch.res test/diff/batch.expected
+if [ $? -gt 0 ]; then
+    exit 22
+fi
+
+rm test/diff/batch.ms test/diff/batch.expected test/diff/batch.res
+
+# systems not in shape position get a random linear form, which must not
+# depend on the number of threads or on the other systems
+rm -f test/diff/batch.ms
+for i in 1 2 3 4 5 6; do
+    printf 'x,y\n65521\nx^2-1,\ny^2-1\n\n' >> test/diff/batch.ms
+done
+
+$(pwd)/msolve -b test/diff/batch.ms -o test/diff/batch.expected -P 1 -t 1
+if [ $? -gt 0 ]; then
+    exit 41
+fi
+
+# nor on the time of the run
+sleep 1
+$(pwd)/msolve -b test/diff/batch.ms -o test/diff/batch.res -P 1 -t 3
+if [ $? -gt 0 ]; then
+    exit 42
+fi
+
+diff test/diff/batch.res test/diff/batch.expected
+if [ $? -gt 0 ]; then
+    exit 43
+fi
+
+rm test/diff/batch.ms test/diff/batch.expected test/diff/batch.res
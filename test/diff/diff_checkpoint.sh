@@ -0,0 +1,94 @@
+#!/bin/bash
+
+# a run checkpointing after each prime (-k) is killed once its first
+# checkpoint is written, the resumed run has to give the same result as an
+# uninterrupted one; runs are FILE:OPTIONS[:EXPECTED], the uninterrupted
+# run being checked against output_files/EXPECTED when it is given
+
+ctr=0
+for run in "kat8-qq-truncate:-P 0" "kat8-qq-truncate:-g 2" \
+        "kat7-qq:-P 2 -d 0 -l 2:kat7-qq.res"; do
+    file=${run%%:*}
+    opt=${run#*:}
+    exp=
+    if [ "${opt#*:}" != "$opt" ]; then
+        exp=${opt#*:}
+        opt=${opt%%:*}
+    fi
+    ckpt=test/diff/$file.ckpt
+
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.ref.res \
+          $opt -t 1
+    if [ $? -gt 0 ]; then
+        exit $((ctr+1))
+    fi
+
+    if [ -n "$exp" ]; then
+        diff test/diff/$file.ref.res output_files/$exp
+        if [ $? -gt 0 ]; then
+            exit $((ctr+10))
+        fi
+    fi
+
+    rm -f $ckpt
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          $opt -k $ckpt -K 0 -t 1 &
+    pid=$!
+    while [ ! -f $ckpt ] && kill -0 $pid 2>/dev/null; do
+        sleep 0.01
+    done
+    kill -9 $pid 2>/dev/null
+    wait $pid 2>/dev/null
+    if [ ! -f $ckpt ]; then
+        exit $((ctr+2))
+    fi
+
+    # the same checkpoint claiming the other byte order
+    bo=$(head -n 1 $ckpt | awk '{print $4}')
+    [ "$bo" = "le" ] && bo=be || bo=le
+    (head -n 1 $ckpt | awk -v bo=$bo '{print $1, $2, $3, bo}'; \
+     tail -n +2 $ckpt) > $ckpt.bo
+
+    rm -f test/diff/$file.res
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          $opt -k $ckpt -K 0 -t 2 -v 1 > /dev/null 2> test/diff/$file.log
+    if [ $? -gt 0 ]; then
+        exit $((ctr+3))
+    fi
+
+    grep -q "Resumes from checkpoint" test/diff/$file.log
+    if [ $? -gt 0 ]; then
+        exit $((ctr+4))
+    fi
+
+    diff test/diff/$file.res test/diff/$file.ref.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+5))
+    fi
+
+    # the checkpoint is removed once the computation is over
+    if [ -f $ckpt ]; then
+        exit $((ctr+6))
+    fi
+
+    rm -f test/diff/$file.res
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          $opt -k $ckpt.bo -t 1 2> test/diff/$file.log
+    if [ $? -gt 0 ]; then
+        exit $((ctr+7))
+    fi
+
+    grep -q "another byte order" test/diff/$file.log
+    if [ $? -gt 0 ]; then
+        exit $((ctr+8))
+    fi
+
+    diff test/diff/$file.res test/diff/$file.ref.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+9))
+    fi
+
+    rm -f $ckpt.bo
+    rm test/diff/$file.res test/diff/$file.ref.res test/diff/$file.log
+    ctr=$((ctr+20))
+done
@@ -46,4 +46,26 @@ if [ $? -gt 0 ]; then
     exit 62
 fi
 
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -d 4 -P 2 -l 3 -t 1
+if [ $? -gt 0 ]; then
+    exit 81
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 82
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -d 4 -P 2 -l 3 -t 2
+if [ $? -gt 0 ]; then
+    exit 101
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 102
+fi
+
 rm test/diff/$file.res
@@ -0,0 +1,44 @@
+#!/bin/bash
+
+# the basis hash table is compacted after each F4 round, when solving
+# and with -g, over a prime field and over the rationals, i.e. also
+# while a trace is learned
+
+ctr=0
+for file in eco10-31 kat7-qq; do
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -P 2 -d 0 -l 2 -u 1 -t 2
+    if [ $? -gt 0 ]; then
+        exit $((ctr+1))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+2))
+    fi
+
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -g 2 -t 2
+    if [ $? -gt 0 ]; then
+        exit $((ctr+3))
+    fi
+
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.u.res \
+          -g 2 -u 1 -t 2 -v 2 > test/diff/$file.log
+    if [ $? -gt 0 ]; then
+        exit $((ctr+4))
+    fi
+
+    grep -q "^rht" test/diff/$file.log
+    if [ $? -gt 0 ]; then
+        exit $((ctr+5))
+    fi
+
+    diff test/diff/$file.u.res test/diff/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+6))
+    fi
+
+    rm test/diff/$file.res test/diff/$file.u.res test/diff/$file.log
+    ctr=$((ctr+20))
+done
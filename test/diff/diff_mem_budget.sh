@@ -0,0 +1,52 @@
+#!/bin/bash
+
+# a memory budget of 4 MB per matrix splits some of the pair selections,
+# the primes computed in parallel share a budget of 1 MB, invalid budgets
+# are rejected
+
+file=eco10-31
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -P 2 -d 0 -l 2 -B 4 -t 1
+if [ $? -gt 0 ]; then
+    exit 1
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 2
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -P 2 -d 0 -l 2 -B 4 -t 2
+if [ $? -gt 0 ]; then
+    exit 21
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 22
+fi
+
+rm test/diff/$file.res
+
+$(pwd)/msolve -f input_files/kat7-qq.ms -o test/diff/kat7-qq.res \
+      -P 2 -d 0 -l 2 -B 1 -t 4
+if [ $? -gt 0 ]; then
+    exit 41
+fi
+
+diff test/diff/kat7-qq.res output_files/kat7-qq.res
+if [ $? -gt 0 ]; then
+    exit 42
+fi
+
+rm test/diff/kat7-qq.res
+
+for bgt in 0 -2 4x; do
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -B $bgt 2> /dev/null
+    if [ $? -eq 0 ]; then
+        exit 61
+    fi
+done
@@ -0,0 +1,41 @@
+#!/bin/bash
+
+# same input as nf-31 over the rationals: the expected normal forms reduce
+# modulo 1073741827 to the ones of output_files/nf-31.res
+
+file=nf-qq
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -n2 -t 1
+if [ $? -gt 0 ]; then
+    exit 1
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 2
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -n2 -t 2
+if [ $? -gt 0 ]; then
+    exit 21
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 22
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -n2 -l 44 -t 2
+if [ $? -gt 0 ]; then
+    exit 41
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 42
+fi
+
+rm test/diff/$file.res
@@ -0,0 +1,32 @@
+#!/bin/bash
+
+# -u compacts the basis hash table after a fixed number of F4 rounds,
+# normal forms are computed w.r.t. the compacted table
+
+ctr=0
+for file in nf-8 nf-16 nf-31; do
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -n2 -u 1 -t 1
+    if [ $? -gt 0 ]; then
+        exit $((ctr+1))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+2))
+    fi
+
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -n2 -u 2 -t 2
+    if [ $? -gt 0 ]; then
+        exit $((ctr+3))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+4))
+    fi
+
+    rm test/diff/$file.res
+    ctr=$((ctr+20))
+done
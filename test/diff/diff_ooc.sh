@@ -0,0 +1,34 @@
+#!/bin/bash
+
+# the trace and redundant basis elements are stored out of core, the
+# trace is applied from its file mapping, also by parallel primes
+
+dir=$(pwd)/test/diff
+
+ctr=0
+for file in kat7-qq multy-qq; do
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -P 2 -d 0 -l 2 -t 1 -D $dir
+    if [ $? -gt 0 ]; then
+        exit $((ctr+1))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+2))
+    fi
+
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -P 2 -d 0 -l 2 -t 4 -D $dir
+    if [ $? -gt 0 ]; then
+        exit $((ctr+3))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+4))
+    fi
+
+    rm test/diff/$file.res
+    ctr=$((ctr+20))
+done
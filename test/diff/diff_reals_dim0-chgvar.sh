@@ -46,4 +46,39 @@ if [ $? -gt 0 ]; then
     exit 62
 fi
 
+# the real roots are evaluated at once by multipoint evaluation
+# if there are at least as many of them as given by -E
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -d 0 -l 2 -t 1 -E 0
+if [ $? -gt 0 ]; then
+    exit 81
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 82
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -d 0 -l 2 -t 2 -E 0
+if [ $? -gt 0 ]; then
+    exit 101
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 102
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -d 0 -p 256 -l 2 -t 2 -E 0
+if [ $? -gt 0 ]; then
+    exit 121
+fi
+
+diff test/diff/$file.res output_files/$file.p256.res
+if [ $? -gt 0 ]; then
+    exit 122
+fi
+
 rm test/diff/$file.res
@@ -0,0 +1,40 @@
+#!/bin/bash
+
+# real solutions written in binary format with -O are read back with -F
+
+ctr=0
+for file in reals_dim0 reals_dim0-swapvar reals_dim0-chgvar; do
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -O test/diff/$file.bin -d 0 -l 2 -t 1
+    if [ $? -gt 0 ]; then
+        exit $((ctr+1))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+2))
+    fi
+
+    $(pwd)/msolve -F test/diff/$file.bin -o test/diff/$file.res -t 1
+    if [ $? -gt 0 ]; then
+        exit $((ctr+3))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+4))
+    fi
+
+    $(pwd)/msolve -F test/diff/$file.bin -o test/diff/$file.res -t 2
+    if [ $? -gt 0 ]; then
+        exit $((ctr+5))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+6))
+    fi
+
+    rm test/diff/$file.res test/diff/$file.bin
+    ctr=$((ctr+20))
+done
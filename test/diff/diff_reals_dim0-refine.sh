@@ -0,0 +1,61 @@
+#!/bin/bash
+
+# real roots written in binary format with -O are refined with -F and -R up
+# to -p 256, the other ones are unchanged; reals_dim0-swapvar and -swaprefine
+# swap the last variable, reals_dim0-chgvar adds a linear form; coordinates
+# are computed root by root (-E), multipoint evaluation in ball arithmetic
+# would tie the expected outputs to the error bounds of a FLINT version
+
+ctr=0
+for run in reals_dim0:0,2 reals_dim0-swapvar:0,1 reals_dim0-swaprefine:0,2 \
+        reals_dim0-chgvar:0,2; do
+    file=${run%%:*}
+    list=${run#*:}
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -O test/diff/$file.bin -d 0 -l 2 -t 1 -E 1000
+    if [ $? -gt 0 ]; then
+        exit $((ctr+1))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+2))
+    fi
+
+    $(pwd)/msolve -F test/diff/$file.bin -o test/diff/$file.res \
+          -R $list -p 256 -t 1 -E 1000
+    if [ $? -gt 0 ]; then
+        exit $((ctr+3))
+    fi
+
+    diff test/diff/$file.res output_files/$file.refine.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+4))
+    fi
+
+    $(pwd)/msolve -F test/diff/$file.bin -o test/diff/$file.res \
+          -R $list -p 256 -t 2 -E 1000 \
+          -O test/diff/$file.bin
+    if [ $? -gt 0 ]; then
+        exit $((ctr+5))
+    fi
+
+    diff test/diff/$file.res output_files/$file.refine.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+6))
+    fi
+
+    # the updated binary file holds the refined roots
+    $(pwd)/msolve -F test/diff/$file.bin -o test/diff/$file.res -t 1
+    if [ $? -gt 0 ]; then
+        exit $((ctr+7))
+    fi
+
+    diff test/diff/$file.res output_files/$file.refine.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+8))
+    fi
+
+    rm test/diff/$file.res test/diff/$file.bin
+    ctr=$((ctr+20))
+done
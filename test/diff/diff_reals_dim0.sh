@@ -90,4 +90,50 @@ if [ $? -gt 0 ]; then
     exit 64
 fi
 
+# the real roots are evaluated at once by multipoint evaluation
+# if there are at least as many of them as given by -E
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -l 2 -t 1 -E 0
+if [ $? -gt 0 ]; then
+    exit 81
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 82
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -p 256 -l 2 -t 1 -E 0
+if [ $? -gt 0 ]; then
+    exit 83
+fi
+
+diff test/diff/$file.res output_files/$file.p256.res
+if [ $? -gt 0 ]; then
+    exit 84
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -l 2 -t 2 -E 0
+if [ $? -gt 0 ]; then
+    exit 101
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit 102
+fi
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -p 256 -l 2 -t 2 -E 0
+if [ $? -gt 0 ]; then
+    exit 103
+fi
+
+diff test/diff/$file.res output_files/$file.p256.res
+if [ $? -gt 0 ]; then
+    exit 104
+fi
+
 rm test/diff/$file.res
@@ -0,0 +1,43 @@
+#!/bin/bash
+
+# signature based Groebner bases (-q 1) need homogeneous input, their
+# reduced Groebner bases are compared with the ones computed by F4
+
+ctr=0
+for file in cyclic5-hom-8 cyclic5-hom-16 cyclic5-hom-31; do
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -q 1 -g 2 -t 1
+    if [ $? -gt 0 ]; then
+        exit $((ctr+1))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+2))
+    fi
+
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -q 1 -g 2 -t 2
+    if [ $? -gt 0 ]; then
+        exit $((ctr+3))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+4))
+    fi
+
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -g 2 -t 1
+    if [ $? -gt 0 ]; then
+        exit $((ctr+5))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+6))
+    fi
+
+    rm test/diff/$file.res
+    ctr=$((ctr+20))
+done
@@ -0,0 +1,47 @@
+#!/bin/bash
+
+# sparse accumulators are only used for matrices with many columns,
+# -A 0 forces them also for small examples
+
+ctr=0
+for file in eco6-16 eco6-31 eco6-qq; do
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -d 4 -P 2 -l 2 -t 1 -A 0
+    if [ $? -gt 0 ]; then
+        exit $((ctr+1))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+2))
+    fi
+
+    $(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+          -d 4 -P 2 -l 2 -t 2 -A 0
+    if [ $? -gt 0 ]; then
+        exit $((ctr+3))
+    fi
+
+    diff test/diff/$file.res output_files/$file.res
+    if [ $? -gt 0 ]; then
+        exit $((ctr+4))
+    fi
+
+    rm test/diff/$file.res
+    ctr=$((ctr+20))
+done
+
+file=nf-8
+
+$(pwd)/msolve -f input_files/$file.ms -o test/diff/$file.res \
+      -n2 -A 0
+if [ $? -gt 0 ]; then
+    exit $((ctr+1))
+fi
+
+diff test/diff/$file.res output_files/$file.res
+if [ $? -gt 0 ]; then
+    exit $((ctr+2))
+fi
+
+rm test/diff/$file.res
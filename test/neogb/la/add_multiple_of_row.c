@@ -0,0 +1,198 @@
+/* checks the SIMD kernels of the 8 and 16 bit row reductions against the
+ * scalar ones, for all SIMD extensions supported by the cpu */
+#include "../../../src/neogb/gb.c"
+
+#define MAXLEN 200
+
+static int64_t rand_cf(
+        const uint32_t fc
+        )
+{
+    return (int64_t)(rand() % fc);
+}
+
+/* random sparse row of length len with increasing columns < 4*MAXLEN */
+static void random_sparse_row(
+        hm_t *dts,
+        const len_t len
+        )
+{
+    len_t j;
+    hm_t c = 0;
+    dts[PRELOOP] = len % UNROLL;
+    dts[LENGTH]  = len;
+    for (j = 0; j < len; ++j) {
+        c += 1 + rand() % 3;
+        dts[OFFSET+j] = c;
+    }
+}
+
+static int check_kernels_ff_8(
+        const uint32_t fc,
+        const int simd
+        )
+{
+    len_t i, len;
+    int64_t dr[4*MAXLEN], dr0[4*MAXLEN];
+    cf8_t red[MAXLEN];
+    hm_t dts[OFFSET+MAXLEN];
+
+    for (len = 0; len < MAXLEN; ++len) {
+        const uint32_t mul = (uint32_t)rand_cf(fc);
+        for (i = 0; i < len; ++i) {
+            red[i] = (cf8_t)rand_cf(fc);
+        }
+        for (i = 0; i < 4*MAXLEN; ++i) {
+            dr[i] = dr0[i] = (int64_t)rand() << 8;
+        }
+        add_multiple_of_dense_row_ff_8(dr, red, len, mul, simd);
+        add_multiple_of_dense_row_ff_8_scalar(dr0, red, len, mul);
+        if (memcmp(dr, dr0, sizeof(dr)) != 0) {
+            return 1;
+        }
+        random_sparse_row(dts, len);
+        add_multiple_of_row_ff_8(dr, dts, red, mul, simd);
+        add_multiple_of_row_ff_8_scalar(dr0, dts, red, mul);
+        if (memcmp(dr, dr0, sizeof(dr)) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int check_kernels_ff_16(
+        const uint32_t fc,
+        const int simd
+        )
+{
+    len_t i, len;
+    int64_t dr[4*MAXLEN], dr0[4*MAXLEN];
+    cf16_t red[MAXLEN];
+    hm_t dts[OFFSET+MAXLEN];
+
+    for (len = 0; len < MAXLEN; ++len) {
+        const uint32_t mul = (uint32_t)rand_cf(fc);
+        for (i = 0; i < len; ++i) {
+            red[i] = (cf16_t)rand_cf(fc);
+        }
+        for (i = 0; i < 4*MAXLEN; ++i) {
+            dr[i] = dr0[i] = (int64_t)rand() << 8;
+        }
+        add_multiple_of_dense_row_ff_16(dr, red, len, mul, simd);
+        add_multiple_of_dense_row_ff_16_scalar(dr0, red, len, mul);
+        if (memcmp(dr, dr0, sizeof(dr)) != 0) {
+            return 1;
+        }
+        random_sparse_row(dts, len);
+        add_multiple_of_row_ff_16(dr, dts, red, mul, simd);
+        add_multiple_of_row_ff_16_scalar(dr0, dts, red, mul);
+        if (memcmp(dr, dr0, sizeof(dr)) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* reduces 2*ncr random dense rows by random dense pivots with the current
+ * SIMD extension, the i-th reduced row is stored from column pc on in
+ * out8 + i*ncr resp. out16 + i*ncr */
+static void dense_reduction(
+        cf8_t *out8,
+        cf16_t *out16,
+        const len_t ncr,
+        const uint32_t fc8,
+        const uint32_t fc16
+        )
+{
+    len_t i, j, pc;
+    int64_t *dr   = (int64_t *)malloc((unsigned long)ncr * sizeof(int64_t));
+    cf8_t **p8    = (cf8_t **)calloc((unsigned long)ncr, sizeof(cf8_t *));
+    cf16_t **p16  = (cf16_t **)calloc((unsigned long)ncr, sizeof(cf16_t *));
+    cf8_t *r8;
+    cf16_t *r16;
+
+    memset(out8, 0, 2 * (unsigned long)ncr * ncr * sizeof(cf8_t));
+    memset(out16, 0, 2 * (unsigned long)ncr * ncr * sizeof(cf16_t));
+    srand(ncr);
+    /* pivots for two columns out of three */
+    for (i = 0; i < ncr; ++i) {
+        if (i % 3 == 2) {
+            continue;
+        }
+        p8[i]   = (cf8_t *)malloc((unsigned long)(ncr-i) * sizeof(cf8_t));
+        p16[i]  = (cf16_t *)malloc((unsigned long)(ncr-i) * sizeof(cf16_t));
+        p8[i][0] = p16[i][0] = 1;
+        for (j = 1; j < ncr-i; ++j) {
+            p8[i][j]  = (cf8_t)rand_cf(fc8);
+            p16[i][j] = (cf16_t)rand_cf(fc16);
+        }
+    }
+    for (i = 0; i < 2*ncr; ++i) {
+        for (j = 0; j < ncr; ++j) {
+            dr[j] = rand_cf(fc8);
+        }
+        pc  = 0;
+        r8  = reduce_dense_row_by_dense_new_pivots_ff_8(dr, &pc, p8, ncr, fc8);
+        if (r8 != NULL) {
+            memcpy(out8 + i*ncr + pc, r8, (ncr-pc) * sizeof(cf8_t));
+            free(r8);
+        }
+        for (j = 0; j < ncr; ++j) {
+            dr[j] = rand_cf(fc16);
+        }
+        pc  = 0;
+        r16 = reduce_dense_row_by_dense_new_pivots_ff_16(dr, &pc, p16, ncr, fc16);
+        if (r16 != NULL) {
+            memcpy(out16 + i*ncr + pc, r16, (ncr-pc) * sizeof(cf16_t));
+            free(r16);
+        }
+    }
+    for (i = 0; i < ncr; ++i) {
+        free(p8[i]);
+        free(p16[i]);
+    }
+    free(p8);
+    free(p16);
+    free(dr);
+}
+
+int main(void)
+{
+    int simd;
+    const len_t ncr     = 150;
+    const uint32_t fc8  = 251;
+    const uint32_t fc16 = 65521;
+    const unsigned long nout = 2 * (unsigned long)ncr * ncr;
+    int ret = 0;
+
+    cf8_t *ref8   = (cf8_t *)malloc(nout * sizeof(cf8_t));
+    cf16_t *ref16 = (cf16_t *)malloc(nout * sizeof(cf16_t));
+    cf8_t *out8   = (cf8_t *)malloc(nout * sizeof(cf8_t));
+    cf16_t *out16 = (cf16_t *)malloc(nout * sizeof(cf16_t));
+
+    /* reference: scalar kernels */
+    set_simd_level(SIMD_NONE);
+    dense_reduction(ref8, ref16, ncr, fc8, fc16);
+
+    for (simd = SIMD_NONE; simd <= SIMD_AVX512; ++simd) {
+        if (set_simd_level(simd) != simd) {
+            continue;
+        }
+        srand(simd);
+        dense_reduction(out8, out16, ncr, fc8, fc16);
+        if (check_kernels_ff_8(fc8, simd) != 0
+                || check_kernels_ff_16(fc16, simd) != 0
+                || memcmp(out8, ref8, nout * sizeof(cf8_t)) != 0
+                || memcmp(out16, ref16, nout * sizeof(cf16_t)) != 0) {
+            fprintf(stderr, "%s kernels differ from scalar ones\n",
+                    simd_level_name(simd));
+            ret = 1;
+        }
+    }
+    free(ref8);
+    free(ref16);
+    free(out8);
+    free(out16);
+
+    return ret;
+}